@@ -122,7 +122,8 @@ public:
  * During normal usage, OpenColorIO tends to cache certain global information (such
  * as the contents of LUTs on disk, intermediate results, etc.). Calling this function will flush
  * all such information. The global information are related to LUT file identifications, loaded LUT
- * file content and CDL transforms from loaded CDL files.
+ * file content, CDL transforms from loaded CDL files, inverse 3D LUT approximations and GPU
+ * shaders.
  *
  * Under normal usage, this is not necessary, but it can be helpful in particular instances,
  * such as designing OCIO profiles, and wanting to re-read luts without restarting.
@@ -135,6 +136,44 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Limit the size of the global LUT file cache.
+ *
+ * When a limit is exceeded, the least recently used files are evicted from the cache. A zero value
+ * means unlimited, which is the default. The number of bytes is estimated from the LUT file sizes.
+ */
+extern OCIOEXPORT void SetFileCacheCapacity(size_t maxEntries, size_t maxBytes);
+/// Get the usage statistics of the global LUT file cache.
+extern OCIOEXPORT CacheStatistics GetFileCacheStatistics();
+
+/**
+ * \brief Limit the size of the global GPU shader cache.
+ *
+ * The shader text and the textures extracted from a GPUProcessor without dynamic properties are
+ * cached per GPUProcessor and shader description parameters (i.e. language, function name,
+ * resource prefix, etc.), so later extractions in new shader descriptions share them instead of
+ * generating them again. When a limit is exceeded, the least recently used entries are evicted
+ * from the cache. A zero value means unlimited. The default limits are 64 entries and 128 MB,
+ * the number of bytes being estimated from the shader text and texture sizes.
+ */
+extern OCIOEXPORT void SetGpuShaderCacheCapacity(size_t maxEntries, size_t maxBytes);
+/// Get the usage statistics of the global GPU shader cache.
+extern OCIOEXPORT CacheStatistics GetGpuShaderCacheStatistics();
+
+/**
+ * \brief Set the directory of the on-disk processor cache, an empty or null value disabling it.
+ *
+ * When enabled, the optimized op lists of CPU processors and of optimized processors are stored in
+ * that directory and reused by later process launches instead of optimizing the ops again. The
+ * cache key combines the Processor cache ID, the library version, the bit-depths and the
+ * optimization flags. Processors with dynamic properties are never cached to disk. The directory
+ * must exist; files are never evicted by the library. The initial value comes from the
+ * OCIO_PROCESSOR_DISK_CACHE_DIR environment variable. Disabled by OCIO_DISABLE_ALL_CACHES.
+ */
+extern OCIOEXPORT void SetProcessorDiskCacheDirectory(const char * dirname);
+/// Get the directory of the on-disk processor cache, an empty string meaning it is disabled.
+extern OCIOEXPORT std::string GetProcessorDiskCacheDirectory();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -186,6 +225,32 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Get the number of pixels the CPU processors run through the whole list of ops
+ * before moving to the next pixels.
+ *
+ * Each scanline is split into blocks of that many pixels so the intermediate RGBA float
+ * values stay in the CPU caches between two ops. Zero disables the blocking i.e. each op
+ * processes the whole scanline before the next op starts. The default value is 1024 pixels
+ * (i.e. 16 KB of RGBA float values).
+ */
+extern OCIOEXPORT unsigned GetCPUProcessorBlockSize();
+/// Set the CPU processing block size. \see GetCPUProcessorBlockSize
+extern OCIOEXPORT void SetCPUProcessorBlockSize(unsigned numPixels);
+
+/**
+ * \brief Get the grid size of the 3D LUT which approximates the inverse of a 3D LUT.
+ *
+ * The approximation is used by the GPU processors and by the OPTIMIZATION_LUT_INV_FAST
+ * optimization. The default size of 48 balances accuracy and build time; larger sizes such as 65
+ * or 129 are more accurate but take longer to build. The build is multithreaded and its result
+ * is cached per LUT and grid size until the next ClearAllCaches call. Processors already created
+ * are not affected.
+ */
+extern OCIOEXPORT unsigned GetInverseLut3DGridSize();
+/// Set the inverse 3D LUT grid size, in the [2, 129] range. \see GetInverseLut3DGridSize
+extern OCIOEXPORT void SetInverseLut3DGridSize(unsigned gridSize);
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -1372,6 +1437,19 @@ public:
      */
     bool filepathOnlyMatchesDefaultRule(const char * filePath) const;
 
+    /**
+     * \brief Get the color spaces of a list of file paths in one call.
+     *
+     * The result for each file path is identical to calling getColorSpaceFromFilepath() i.e.
+     * the color space of the first rule that matched. The colorSpaces array must hold
+     * numFilePaths entries and so does the optional ruleIndices array (which receives the
+     * index of the matching rule). The returned names are owned by the config.
+     */
+    void getColorSpacesFromFilepaths(const char * const * filePaths,
+                                     size_t numFilePaths,
+                                     const char ** colorSpaces,
+                                     size_t * ruleIndices = nullptr) const;
+
     /**
      * Given the specified string, get the longest, right-most, colorspace substring that
      * appears.
@@ -1596,6 +1674,17 @@ public:
      */
     void clearProcessorCache() noexcept;
 
+    /**
+     * \brief Limit the size of this config's Processor cache.
+     *
+     * When a limit is exceeded, the least recently used processors are evicted from the cache.
+     * A zero value means unlimited, which is the default. The number of bytes is an estimation
+     * of the memory used by the processors, mainly from their LUTs.
+     */
+    void setProcessorCacheCapacity(size_t maxEntries, size_t maxBytes) const noexcept;
+    /// Get the usage statistics of this config's Processor cache.
+    CacheStatistics getProcessorCacheStatistics() const noexcept;
+
     /// Set the ConfigIOProxy object used to provision the config and LUTs from somewhere other
     /// than the file system.  (This is set on the config's embedded Context object.)
     void setConfigIOProxy(ConfigIOProxyRcPtr ciop);
@@ -2725,6 +2814,27 @@ public:
     ConstProcessorRcPtr getOptimizedProcessor(BitDepth inBD, BitDepth outBD,
                                               OptimizationFlags oFlags) const;
 
+    /**
+     * Create a Processor where the transform at the specified index (i.e. see
+     * \ref Processor::getNumTransforms) is replaced by the transform. It is meant for
+     * interactive edits, for example changing the parameters of a grading transform in a long
+     * color transformation. The CPUProcessor instances of the returned processor only create
+     * the CPU renderers of the new transform and reuse the ones of all the other transforms.
+     * Patching again the returned processor at the index of the patched transform reuses the
+     * same work.
+     *
+     * \note The ops before and after the patched transform are optimized separately from it,
+     * so results could be slightly different from a Processor built from the complete
+     * color transformation. Only the ops before and after the patched transform could be stored
+     * in the on-disk processor cache (i.e. see \ref SetProcessorDiskCacheDirectory) so the
+     * interactive edits do not add files to it.
+     *
+     * \note The transform is built without a config so it must not reference color spaces,
+     * looks, named transforms or files with a relative path.
+     */
+    ConstProcessorRcPtr createPatchedProcessor(int index,
+                                               const ConstTransformRcPtr & transform) const;
+
     //
     // GPU Renderer
     //
@@ -2846,6 +2956,16 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Apply to an image while splitting the work across several threads.
+     *
+     * The scanlines of the image are divided into contiguous bands, one per thread, and each
+     * thread uses its own intermediate buffers. A numThreads of 0 uses all the hardware
+     * threads. The result is identical to the single-threaded apply.
+     */
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -2858,6 +2978,80 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * \brief Create a private copy of the dynamic properties holding their current values.
+     *
+     * The apply methods taking a snapshot process the pixels with the dynamic property
+     * values of the snapshot instead of the ones of this CPU processor. So several threads
+     * (or viewports) could share one CPU processor while each one renders with its own
+     * values. Only the dynamic ops are duplicated, all the other ops (e.g. the LUTs) are
+     * shared with the CPU processor.
+     */
+    DynamicPropertySnapshotRcPtr createDynamicPropertySnapshot() const;
+
+    /**
+     * \brief Apply to an image using the dynamic property values of the snapshot.
+     *
+     * The snapshot must come from this CPU processor, and a null snapshot uses the dynamic
+     * properties of the CPU processor. The snapshot is only read so it could be used by
+     * concurrent apply calls, but it must not be edited during these calls. A numThreads
+     * of 0 uses all the hardware threads.
+     */
+    void apply(const ImageDesc & imgDesc,
+               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+               unsigned numThreads = 1) const;
+    void apply(const ImageDesc & srcImgDesc,
+               ImageDesc & dstImgDesc,
+               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+               unsigned numThreads = 1) const;
+
+    /// Apply to a single pixel using the dynamic property values of the snapshot.
+    void applyRGB(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const;
+    void applyRGBA(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const;
+
+    /**
+     * \brief Enable or disable the profiling of the image apply calls.
+     *
+     * When enabled, the image apply calls accumulate the time, number of pixels and number
+     * of pixel bytes read and written by each op, as well as the time spent to pack and
+     * unpack the image scanlines to and from the intermediate RGBA 32-bit float buffers.
+     * The profiling is disabled by default.
+     *
+     * \note
+     *    To measure each op separately, the first and last ops are no longer merged with the
+     *    input and output bit-depth conversions while the profiling is enabled. Timing each
+     *    op also adds a small overhead so only enable it while investigating performance.
+     *
+     * \note
+     *    The CPU processors are cached by their \ref Processor, so the statistics accumulate
+     *    the apply calls of all the users of this instance. The single pixel applyRGB and
+     *    applyRGBA methods are not profiled.
+     */
+    void setProfilingEnabled(bool enabled) const;
+    bool isProfilingEnabled() const noexcept;
+    /// Reset all the profiling statistics to zero.
+    void resetProfiling() const;
+
+    /// Get the number of profiled ops, in processing order.
+    int getNumProfiledOps() const;
+    /// Get the type of the op (e.g. "<Lut3DOp>").
+    const char * getProfiledOpType(int index) const;
+    /**
+     * Get the metadata of the transform the op comes from. For an op from a CLF or CTF file,
+     * it contains the name and id of the process node.
+     */
+    const FormatMetadata & getProfiledOpFormatMetadata(int index) const;
+    /// Get the cumulative processing time (in seconds) of the op.
+    double getProfiledOpTime(int index) const;
+    /// Get the cumulative number of pixels processed by the op.
+    unsigned long long getProfiledOpNumPixels(int index) const;
+    /// Get the cumulative number of pixel bytes read and written by the op.
+    unsigned long long getProfiledOpNumBytes(int index) const;
+    /// Get the cumulative time (in seconds) to pack the source image scanlines.
+    double getProfiledPackTime() const;
+    /// Get the cumulative time (in seconds) to unpack to the destination image scanlines.
+    double getProfiledUnpackTime() const;
+
     CPUProcessor(const CPUProcessor &) = delete;
     CPUProcessor& operator= (const CPUProcessor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2869,6 +3063,50 @@ private:
     static void deleter(CPUProcessor * c);
 
     friend class Processor;
+    // Lets the unit tests check the CPU ops.
+    friend class CPUProcessorTestAccess;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+
+/**
+ * \brief The dynamic property values used by one or several CPUProcessor apply calls.
+ *
+ * A snapshot is created by \ref CPUProcessor::createDynamicPropertySnapshot and can only be
+ * used with that CPU processor. Its dynamic properties are decoupled from the ones of the CPU
+ * processor and from the ones of the other snapshots.
+ */
+class OCIOEXPORT DynamicPropertySnapshot
+{
+public:
+    /// Create an editable copy of the snapshot i.e. holding the same values.
+    DynamicPropertySnapshotRcPtr createEditableCopy() const;
+
+    /**
+     * The returned pointer may be used to set the value of the dynamic property of the
+     * requested type. Throws if the requested property is not found.
+     */
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type);
+    /// True if at least one dynamic property of that type exists.
+    bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
+    /// True if at least one dynamic property of any type exists and is dynamic.
+    bool isDynamic() const noexcept;
+
+    DynamicPropertySnapshot(const DynamicPropertySnapshot &) = delete;
+    DynamicPropertySnapshot & operator= (const DynamicPropertySnapshot &) = delete;
+    /// Do not use (needed only for pybind11).
+    ~DynamicPropertySnapshot();
+
+private:
+    DynamicPropertySnapshot();
+
+    static void deleter(DynamicPropertySnapshot * c);
+
+    friend class CPUProcessor;
 
     class Impl;
     Impl * m_impl;
@@ -3052,9 +3290,29 @@ public:
      */
     void setCubeSize(int cubesize);
 
+    unsigned getNumThreads() const;
+    /**
+     * Set the number of threads used to evaluate the LUT entries and, for bakeDisplayViews,
+     * to bake the display / view pairs concurrently. Default value is 1, and 0 uses all the
+     * hardware threads. The baked LUTs do not depend on the number of threads.
+     */
+    void setNumThreads(unsigned numThreads);
+
     /// Bake the LUT into the output stream.
     void bake(std::ostream & os) const;
 
+    /**
+     * Bake one LUT per display / view pair, the LUT of the pair at index i being written into
+     * outputs[i]. All the other settings (e.g. input space, looks, shaper, format) are shared
+     * by the pairs, as well as the config so the processors common to the pairs (e.g. the
+     * shaper ones) are only built once. The display / view and target space of the baker are
+     * ignored. The pairs are baked concurrently according to the number of threads.
+     */
+    void bakeDisplayViews(const char * const * displays,
+                          const char * const * views,
+                          std::ostream * const * outputs,
+                          int numDisplayViews) const;
+
     /// Get the number of LUT bakers.
     static int getNumFormats();
 
@@ -72,6 +72,10 @@ class OCIOEXPORT CPUProcessor;
 typedef OCIO_SHARED_PTR<const CPUProcessor> ConstCPUProcessorRcPtr;
 typedef OCIO_SHARED_PTR<CPUProcessor> CPUProcessorRcPtr;
 
+class OCIOEXPORT DynamicPropertySnapshot;
+typedef OCIO_SHARED_PTR<const DynamicPropertySnapshot> ConstDynamicPropertySnapshotRcPtr;
+typedef OCIO_SHARED_PTR<DynamicPropertySnapshot> DynamicPropertySnapshotRcPtr;
+
 class OCIOEXPORT GPUProcessor;
 typedef OCIO_SHARED_PTR<const GPUProcessor> ConstGPUProcessorRcPtr;
 typedef OCIO_SHARED_PTR<GPUProcessor> GPUProcessorRcPtr;
@@ -686,6 +690,13 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
+    /**
+     * Replace runs of computationally expensive ops (e.g. the ACES 2 Output Transform or the
+     * grading curves) by a log shaper and a 3D LUT when their estimated evaluation cost is
+     * much higher than the cost of the LUT (lossy).
+     */
+    OPTIMIZATION_BAKE_EXPENSIVE_OPS              = 0x20000000,
+
     /// Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -742,6 +753,23 @@ enum ProcessorCacheFlags : unsigned int
     PROCESSOR_CACHE_DEFAULT = (PROCESSOR_CACHE_ENABLED | PROCESSOR_CACHE_SHARE_DYN_PROPERTIES)
 };
 
+/**
+ * Statistics of an internal cache e.g. the processor cache of a \ref Config instance or the global
+ * LUT file cache. It helps to size the cache capacity against a memory budget. Note that the number
+ * of bytes is an estimation of the memory used by the cached entries.
+ */
+struct OCIOEXPORT CacheStatistics
+{
+    size_t m_numEntries{ 0 };   ///< Current number of entries.
+    size_t m_numBytes{ 0 };     ///< Current estimated number of bytes.
+    size_t m_maxEntries{ 0 };   ///< Maximum number of entries, 0 means unlimited.
+    size_t m_maxBytes{ 0 };     ///< Maximum estimated number of bytes, 0 means unlimited.
+
+    unsigned long long m_numHits{ 0 };      ///< Number of lookups finding an existing entry.
+    unsigned long long m_numMisses{ 0 };    ///< Number of lookups creating a new entry.
+    unsigned long long m_numEvictions{ 0 }; ///< Number of entries evicted to honor the capacity.
+};
+
 // Conversion
 
 extern OCIOEXPORT const char * BoolToString(bool val);
@@ -1005,6 +1033,14 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_PROCESSOR_DISK_CACHE_DIR
+//
+// The directory of the on-disk processor cache, used to share the optimized op lists across
+// process launches. The cache is disabled when the variable is not set (see
+// SetProcessorDiskCacheDirectory).
+extern OCIOEXPORT const char * OCIO_PROCESSOR_DISK_CACHE_DIR;
+
 
 // Archive config feature
 // Default filename (with extension) of an config.
@@ -115,6 +115,12 @@ ocio_handle_dependency(  minizip-ng REQUIRED ALLOW_INSTALL
                          RECOMMENDED_VERSION 4.0.10
                          RECOMMENDED_VERSION_REASON "Latest version tested with OCIO")
 
+###############################################################################
+
+# Threads
+# Used by the multithreaded CPU processing.
+ocio_handle_dependency(  Threads REQUIRED )
+
 ###############################################################################
 ##
 ## Optional dependencies
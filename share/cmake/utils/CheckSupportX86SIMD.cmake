@@ -51,6 +51,10 @@ else()
     if (COMPILER_SUPPORTS_AVX512)
         set(OCIO_AVX512_ARGS "-mavx512f")
     endif()    
+
+    # The AVX2 and AVX-512 flags allow the compiler to fuse multiplications and additions, so
+    # this is needed by the kernels that must give the same results as the SSE2 ones.
+    set(OCIO_NO_FP_CONTRACT_ARGS "-ffp-contract=off")
 endif()
 
 if(${OCIO_USE_AVX512} AND NOT ${COMPILER_SUPPORTS_AVX512})
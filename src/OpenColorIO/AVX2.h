@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX2
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -299,6 +300,138 @@ struct AVX2RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Apply fn(r, g, b, a) to packed RGBA float pixels, eight pixels at a time. The channel values
+// are loaded with plain loads and transposed (i.e. no gather). The leftover pixels go through a
+// zero-filled temporary buffer. Note that 'in' and 'out' could be the same buffer.
+template<typename Func>
+inline void avx2ApplyRGBA(const float * in, float * out, long numPixels, Func fn)
+{
+    __m256 r, g, b, a;
+
+    const long pixelCount = numPixels / 8 * 8;
+    const long remainder = numPixels - pixelCount;
+
+    for (long i = 0; i < pixelCount; i += 8)
+    {
+        avx2RGBATranspose_4x4_4x4(_mm256_loadu_ps(in +  0), _mm256_loadu_ps(in +  8),
+                                  _mm256_loadu_ps(in + 16), _mm256_loadu_ps(in + 24),
+                                  r, g, b, a);
+
+        fn(r, g, b, a);
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+
+        in  += 32;
+        out += 32;
+    }
+
+    if (remainder)
+    {
+        AVX2_ALIGN(float buffer[32]) = {};
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            buffer[i] = in[i];
+        }
+
+        avx2RGBATranspose_4x4_4x4(_mm256_load_ps(buffer +  0), _mm256_load_ps(buffer +  8),
+                                  _mm256_load_ps(buffer + 16), _mm256_load_ps(buffer + 24),
+                                  r, g, b, a);
+
+        fn(r, g, b, a);
+
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(buffer, r, g, b, a);
+
+        for (long i = 0; i < remainder * 4; ++i)
+        {
+            out[i] = buffer[i];
+        }
+    }
+}
+
+// The following functions are the AVX2 counterparts of sseLog2(), sseExp2() and ssePower() and
+// use the same polynomial approximations so that all the code paths produce the same results.
+// Refer to SSE.h for the details of the algorithms.
+//
+// Note: Unlike SSE.h, the constants are not global variables as their initialization would
+// otherwise run AVX2 instructions at load time, even on a CPU without AVX2.
+
+inline __m256 avx2Log2(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+    const __m256  one   = _mm256_set1_ps(1.0f);
+
+    // y = log2( x ) = log2( 2^exponent * mantissa )
+    //               = exponent + log2( mantissa )
+
+    __m256 mantissa = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), one);
+
+    __m256 log2 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps((float)+4.487361286440374006195e-2),
+                                              mantissa),
+                                _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)-2.800364054395965731506));
+
+    __m256i exponent = _mm256_sub_epi32(
+                           _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+                           _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+    //               = zf * mexp
+
+    // Compute floor(x), see sseExp2() for the handling of the negative and out of range values.
+    __m256i floor_x
+        = _mm256_add_epi32(_mm256_cvttps_epi32(x),
+                           _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x, _CMP_NLE_UQ)));
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    __m256 zf = _mm256_castsi256_ps(
+                    _mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(127)), 23));
+
+    __m256 fraction = _mm256_sub_ps(x, _mm256_cvtepi32_ps(floor_x));
+
+    // Compute exp2(fraction) using a polynomial approximation.
+    __m256 mexp = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps((float)1.353416792833547468620e-2),
+                                              fraction),
+                                _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle underflow & overflow.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OS), exp2);
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(128.0f), _CMP_GE_OS));
+
+    return exp2;
+}
+
+// Results from base values smaller than or equal to zero are mapped to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OS));
+}
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
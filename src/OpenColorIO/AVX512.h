@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX512
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -20,21 +21,116 @@
 namespace OCIO_NAMESPACE
 {
 
+// The unmasked forms of many AVX-512 intrinsics pass an undefined vector for the masked-off
+// lanes, which some compilers (e.g. GCC 12) then report as used uninitialized once inlined. The
+// following helpers use the zero-masking forms with all the lanes selected instead, which
+// compile to the same instructions without any undefined source.
+
+#define AVX512_ALL_LANES_PS ((__mmask16)0xFFFF)
+#define AVX512_ALL_LANES_PD ((__mmask8)0xFF)
+
+inline __m512 avx512_min_ps(__m512 a, __m512 b)
+{
+    return _mm512_maskz_min_ps(AVX512_ALL_LANES_PS, a, b);
+}
+
+inline __m512 avx512_max_ps(__m512 a, __m512 b)
+{
+    return _mm512_maskz_max_ps(AVX512_ALL_LANES_PS, a, b);
+}
+
+inline __m512 avx512_sqrt_ps(__m512 a)
+{
+    return _mm512_maskz_sqrt_ps(AVX512_ALL_LANES_PS, a);
+}
+
+inline __m512 avx512_unpacklo_ps(__m512 a, __m512 b)
+{
+    return _mm512_maskz_unpacklo_ps(AVX512_ALL_LANES_PS, a, b);
+}
+
+inline __m512 avx512_unpackhi_ps(__m512 a, __m512 b)
+{
+    return _mm512_maskz_unpackhi_ps(AVX512_ALL_LANES_PS, a, b);
+}
+
+inline __m512d avx512_unpacklo_pd(__m512d a, __m512d b)
+{
+    return _mm512_maskz_unpacklo_pd(AVX512_ALL_LANES_PD, a, b);
+}
+
+inline __m512d avx512_unpackhi_pd(__m512d a, __m512d b)
+{
+    return _mm512_maskz_unpackhi_pd(AVX512_ALL_LANES_PD, a, b);
+}
+
+inline __m512 avx512_cvtepi32_ps(__m512i a)
+{
+    return _mm512_maskz_cvtepi32_ps(AVX512_ALL_LANES_PS, a);
+}
+
+inline __m512i avx512_cvttps_epi32(__m512 a)
+{
+    return _mm512_maskz_cvttps_epi32(AVX512_ALL_LANES_PS, a);
+}
+
+inline __m512 avx512_cvtph_ps(__m256i a)
+{
+    return _mm512_maskz_cvtph_ps(AVX512_ALL_LANES_PS, a);
+}
+
+inline __m512i avx512_andnot_si512(__m512i a, __m512i b)
+{
+    return _mm512_maskz_andnot_epi32(AVX512_ALL_LANES_PS, a, b);
+}
+
+inline __m512 avx512_i32gather_ps(__m512i index, const float * table)
+{
+    return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), AVX512_ALL_LANES_PS, index, table, 4);
+}
+
+// The immediate operands are template arguments so that they stay constant expressions when
+// the intrinsics are macros i.e. in non-optimized builds.
+
+template<int rounding>
+inline __m512 avx512_roundscale_ps(__m512 a)
+{
+    return _mm512_maskz_roundscale_ps(AVX512_ALL_LANES_PS, a, rounding);
+}
+
+template<int rounding>
+inline __m256i avx512_cvtps_ph(__m512 a)
+{
+    return _mm512_maskz_cvtps_ph(AVX512_ALL_LANES_PS, a, rounding);
+}
+
+template<unsigned count>
+inline __m512i avx512_slli_epi32(__m512i a)
+{
+    return _mm512_maskz_slli_epi32(AVX512_ALL_LANES_PS, a, count);
+}
+
+template<unsigned count>
+inline __m512i avx512_srli_epi32(__m512i a)
+{
+    return _mm512_maskz_srli_epi32(AVX512_ALL_LANES_PS, a, count);
+}
+
 inline __m512 av512_clamp(__m512 value, const __m512& maxValue)
 {
-    value = _mm512_max_ps(value, _mm512_setzero_ps());
-    return _mm512_min_ps(value, maxValue);
+    value = avx512_max_ps(value, _mm512_setzero_ps());
+    return avx512_min_ps(value, maxValue);
 }
 
 inline __m512 avx512_movelh_ps(__m512 a, __m512 b)
 {
-    return _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(a), _mm512_castps_pd(b)));
+    return _mm512_castpd_ps(avx512_unpacklo_pd(_mm512_castps_pd(a), _mm512_castps_pd(b)));
 }
 
 inline __m512 avx512_movehl_ps(__m512 a, __m512 b)
 {
     // NOTE: this is a and b are reversed to match sse2 movhlps which is different than unpckhpd
-    return _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(b), _mm512_castps_pd(a)));
+    return _mm512_castpd_ps(avx512_unpackhi_pd(_mm512_castps_pd(b), _mm512_castps_pd(a)));
 }
 
 
@@ -62,10 +158,10 @@ inline void avx512RGBATranspose_4x4_4x4_4x4_4x4(__m512 row0,   __m512 row1,   __
     // the channel values end up with a even/odd shuffled order because of this.
     // if exact order is important more cross lane shuffling is needed
 
-    __m512 tmp0 = _mm512_unpacklo_ps(row0, row1);
-    __m512 tmp2 = _mm512_unpacklo_ps(row2, row3);
-    __m512 tmp1 = _mm512_unpackhi_ps(row0, row1);
-    __m512 tmp3 = _mm512_unpackhi_ps(row2, row3);
+    __m512 tmp0 = avx512_unpacklo_ps(row0, row1);
+    __m512 tmp2 = avx512_unpacklo_ps(row2, row3);
+    __m512 tmp1 = avx512_unpackhi_ps(row0, row1);
+    __m512 tmp3 = avx512_unpackhi_ps(row2, row3);
 
     out_r = avx512_movelh_ps(tmp0, tmp2);
     out_g = avx512_movehl_ps(tmp2, tmp0);
@@ -86,10 +182,10 @@ struct AVX512RGBAPack<BIT_DEPTH_UINT8>
     {
         __m512i rgba = _mm512_loadu_si512((const __m512i*)in);
 
-        __m512 rgba0 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(rgba)));
-        __m512 rgba1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 1)));
-        __m512 rgba2 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 2)));
-        __m512 rgba3 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 3)));
+        __m512 rgba0 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(rgba)));
+        __m512 rgba1 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 1)));
+        __m512 rgba2 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 2)));
+        __m512 rgba3 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 3)));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
     }
@@ -105,10 +201,10 @@ struct AVX512RGBAPack<BIT_DEPTH_UINT8>
         k = _mm512_int2mask(mask);
         __m512i rgba = _mm512_maskz_loadu_epi32(k, (const __m512i*)in);
 
-        __m512 rgba0 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(rgba)));
-        __m512 rgba1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 1)));
-        __m512 rgba2 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 2)));
-        __m512 rgba3 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 3)));
+        __m512 rgba0 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(rgba)));
+        __m512 rgba1 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 1)));
+        __m512 rgba2 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 2)));
+        __m512 rgba3 = avx512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(rgba, 3)));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
     }
@@ -171,10 +267,10 @@ struct AVX512RGBAPack16
         __m512i rgba_00_07 = _mm512_loadu_si512((const __m512i*)(in +  0));
         __m512i rgba_08_15 = _mm512_loadu_si512((const __m512i*)(in + 32));
 
-        __m512 rgba0 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_00_07)));
-        __m512 rgba1 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_00_07, 1)));
-        __m512 rgba2 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_08_15)));
-        __m512 rgba3 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_08_15, 1)));
+        __m512 rgba0 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_00_07)));
+        __m512 rgba1 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_00_07, 1)));
+        __m512 rgba2 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_08_15)));
+        __m512 rgba3 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_08_15, 1)));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
 
@@ -193,10 +289,10 @@ struct AVX512RGBAPack16
         k = _mm512_int2mask((mask >> 16) & 0xFFFF);
         __m512i rgba_08_15 = _mm512_maskz_loadu_epi32(k, (const __m512i*)(in + 32));
 
-        __m512 rgba0 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_00_07)));
-        __m512 rgba1 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_00_07, 1)));
-        __m512 rgba2 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_08_15)));
-        __m512 rgba3 = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_08_15, 1)));
+        __m512 rgba0 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_00_07)));
+        __m512 rgba1 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_00_07, 1)));
+        __m512 rgba2 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(rgba_08_15)));
+        __m512 rgba3 = avx512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64 (rgba_08_15, 1)));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
 
@@ -324,11 +420,11 @@ struct AVX512RGBAPack<BIT_DEPTH_F16>
         __m512i rgba_00_07 = _mm512_loadu_si512((const __m512i*)(in +  0));
         __m512i rgba_08_15 = _mm512_loadu_si512((const __m512i*)(in + 32));
 
-        __m512 rgba0 = _mm512_cvtph_ps(_mm512_castsi512_si256(rgba_00_07));
-        __m512 rgba1 = _mm512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_00_07, 1));
+        __m512 rgba0 = avx512_cvtph_ps(_mm512_castsi512_si256(rgba_00_07));
+        __m512 rgba1 = avx512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_00_07, 1));
 
-        __m512 rgba2 = _mm512_cvtph_ps(_mm512_castsi512_si256(rgba_08_15));
-        __m512 rgba3 = _mm512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_08_15, 1));
+        __m512 rgba2 = avx512_cvtph_ps(_mm512_castsi512_si256(rgba_08_15));
+        __m512 rgba3 = avx512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_08_15, 1));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
 
@@ -347,11 +443,11 @@ struct AVX512RGBAPack<BIT_DEPTH_F16>
         k = _mm512_int2mask((mask >> 16) & 0xFFFF);
         __m512i rgba_08_15 = _mm512_maskz_loadu_epi32(k, (const __m512i*)(in + 32));
 
-        __m512 rgba0 = _mm512_cvtph_ps(_mm512_castsi512_si256(rgba_00_07));
-        __m512 rgba1 = _mm512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_00_07, 1));
+        __m512 rgba0 = avx512_cvtph_ps(_mm512_castsi512_si256(rgba_00_07));
+        __m512 rgba1 = avx512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_00_07, 1));
 
-        __m512 rgba2 = _mm512_cvtph_ps(_mm512_castsi512_si256(rgba_08_15));
-        __m512 rgba3 = _mm512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_08_15, 1));
+        __m512 rgba2 = avx512_cvtph_ps(_mm512_castsi512_si256(rgba_08_15));
+        __m512 rgba3 = avx512_cvtph_ps(_mm512_extracti64x4_epi64(rgba_08_15, 1));
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(rgba0, rgba1, rgba2, rgba3, r, g, b, a);
 
@@ -363,8 +459,8 @@ struct AVX512RGBAPack<BIT_DEPTH_F16>
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(r, g, b, a, rgba0, rgba1, rgba2, rgba3);
 
-        __m512i rgba0i = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtps_ph(rgba0, 0)), _mm512_cvtps_ph(rgba1, 0), 1);
-        __m512i rgba1i = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtps_ph(rgba2, 0)), _mm512_cvtps_ph(rgba3, 0), 1);
+        __m512i rgba0i = _mm512_inserti64x4(_mm512_castsi256_si512(avx512_cvtps_ph<0>(rgba0)), avx512_cvtps_ph<0>(rgba1), 1);
+        __m512i rgba1i = _mm512_inserti64x4(_mm512_castsi256_si512(avx512_cvtps_ph<0>(rgba2)), avx512_cvtps_ph<0>(rgba3), 1);
 
         _mm512_storeu_si512((__m512i*)(out +  0), rgba0i);
         _mm512_storeu_si512((__m512i*)(out + 32), rgba1i);
@@ -382,8 +478,8 @@ struct AVX512RGBAPack<BIT_DEPTH_F16>
 
         avx512RGBATranspose_4x4_4x4_4x4_4x4(r, g, b, a, rgba0, rgba1, rgba2, rgba3);
 
-        __m512i rgba0i = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtps_ph(rgba0, 0)), _mm512_cvtps_ph(rgba1, 0), 1);
-        __m512i rgba1i = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtps_ph(rgba2, 0)), _mm512_cvtps_ph(rgba3, 0), 1);
+        __m512i rgba0i = _mm512_inserti64x4(_mm512_castsi256_si512(avx512_cvtps_ph<0>(rgba0)), avx512_cvtps_ph<0>(rgba1), 1);
+        __m512i rgba1i = _mm512_inserti64x4(_mm512_castsi256_si512(avx512_cvtps_ph<0>(rgba2)), avx512_cvtps_ph<0>(rgba3), 1);
 
         k = _mm512_int2mask((mask >> 0) & 0xFFFF);
         _mm512_mask_storeu_epi32((__m512i*)(out +  0), k, rgba0i);
@@ -460,6 +556,128 @@ struct AVX512RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Apply fn(r, g, b, a) to packed RGBA float pixels, sixteen pixels at a time. The leftover
+// pixels are processed using masked loads and stores. Note that 'in' and 'out' could be the
+// same buffer.
+template<typename Func>
+inline void avx512ApplyRGBA(const float * in, float * out, long numPixels, Func fn)
+{
+    __m512 r, g, b, a;
+
+    const long pixelCount = numPixels / 16 * 16;
+    const long remainder = numPixels - pixelCount;
+
+    for (long i = 0; i < pixelCount; i += 16)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+
+        fn(r, g, b, a);
+
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+
+        in  += 64;
+        out += 64;
+    }
+
+    if (remainder)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::LoadMasked(in, r, g, b, a, (uint32_t)remainder);
+
+        fn(r, g, b, a);
+
+        AVX512RGBAPack<BIT_DEPTH_F32>::StoreMasked(out, r, g, b, a, (uint32_t)remainder);
+    }
+}
+
+// The following functions are the AVX-512 counterparts of sseLog2(), sseExp2() and ssePower()
+// and use the same polynomial approximations so that all the code paths produce the same
+// results. Refer to SSE.h for the details of the algorithms.
+//
+// Note: Unlike SSE.h, the constants are not global variables as their initialization would
+// otherwise run AVX-512 instructions at load time, even on a CPU without AVX-512.
+
+inline __m512 avx512Log2(__m512 x)
+{
+    const __m512i emask = _mm512_set1_epi32(0x7F800000);
+
+    // y = log2( x ) = log2( 2^exponent * mantissa )
+    //               = exponent + log2( mantissa )
+
+    __m512 mantissa
+        = _mm512_castsi512_ps(
+            _mm512_or_si512(avx512_andnot_si512(emask, _mm512_castps_si512(x)),
+                            _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    __m512 log2 = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps((float)+4.487361286440374006195e-2),
+                                              mantissa),
+                                _mm512_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa),
+                         _mm512_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa),
+                         _mm512_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa),
+                         _mm512_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa),
+                         _mm512_set1_ps((float)-2.800364054395965731506));
+
+    __m512i exponent = _mm512_sub_epi32(
+                           avx512_srli_epi32<23>(_mm512_and_si512(_mm512_castps_si512(x), emask)),
+                           _mm512_set1_epi32(127));
+
+    return _mm512_add_ps(log2, avx512_cvtepi32_ps(exponent));
+}
+
+inline __m512 avx512Exp2(__m512 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+    //               = zf * mexp
+
+    // Compute floor(x), see sseExp2() for the handling of the negative and out of range values.
+    __m512i trunc_x = avx512_cvttps_epi32(x);
+    __m512i floor_x = _mm512_mask_sub_epi32(trunc_x,
+                                            _mm512_cmp_ps_mask(_mm512_setzero_ps(), x, _CMP_NLE_UQ),
+                                            trunc_x,
+                                            _mm512_set1_epi32(1));
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    __m512 zf = _mm512_castsi512_ps(
+                    avx512_slli_epi32<23>(_mm512_add_epi32(floor_x, _mm512_set1_epi32(127))));
+
+    __m512 fraction = _mm512_sub_ps(x, avx512_cvtepi32_ps(floor_x));
+
+    // Compute exp2(fraction) using a polynomial approximation.
+    __m512 mexp = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps((float)1.353416792833547468620e-2),
+                                              fraction),
+                                _mm512_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction),
+                         _mm512_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction),
+                         _mm512_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction),
+                         _mm512_set1_ps((float)1.000002593370603213644));
+
+    __m512 exp2 = _mm512_mul_ps(zf, mexp);
+
+    // Handle underflow & overflow.
+    exp2 = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(-126.0f), _CMP_LT_OS),
+                                exp2,
+                                _mm512_setzero_ps());
+    exp2 = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(128.0f), _CMP_GE_OS),
+                                exp2,
+                                _mm512_set1_ps(std::numeric_limits<float>::infinity()));
+
+    return exp2;
+}
+
+// Results from base values smaller than or equal to zero are mapped to zero.
+inline __m512 avx512Power(__m512 x, __m512 exp)
+{
+    __m512 values = avx512Exp2(_mm512_mul_ps(exp, avx512Log2(x)));
+
+    return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OS), values);
+}
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
@@ -2,13 +2,16 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "transforms/FileTransform.h"
 #include "BakingUtils.h"
 #include "MathUtils.h"
+#include "ThreadUtils.h"
 
 
 namespace OCIO_NAMESPACE
@@ -39,10 +42,12 @@ public:
     std::string m_view;
     int m_shapersize;
     int m_cubesize;
+    unsigned m_numThreads;
 
     Impl() :
         m_shapersize(-1),
-        m_cubesize(-1)
+        m_cubesize(-1),
+        m_numThreads(1)
     {
     }
 
@@ -67,6 +72,7 @@ public:
             m_view = rhs.m_view;
             m_shapersize = rhs.m_shapersize;
             m_cubesize = rhs.m_cubesize;
+            m_numThreads = rhs.m_numThreads;
         }
         return *this;
     }
@@ -234,6 +240,16 @@ int Baker::getCubeSize() const
     return getImpl()->m_cubesize;
 }
 
+void Baker::setNumThreads(unsigned numThreads)
+{
+    getImpl()->m_numThreads = numThreads;
+}
+
+unsigned Baker::getNumThreads() const
+{
+    return getImpl()->m_numThreads;
+}
+
 void Baker::bake(std::ostream & os) const
 {
     FileFormat* fmt = FormatRegistry::GetInstance().getFileFormatByName(getImpl()->m_formatName);
@@ -413,4 +429,43 @@ void Baker::bake(std::ostream & os) const
     //
 }
 
+void Baker::bakeDisplayViews(const char * const * displays,
+                             const char * const * views,
+                             std::ostream * const * outputs,
+                             int numDisplayViews) const
+{
+    if (numDisplayViews < 0 || (numDisplayViews > 0 && (!displays || !views || !outputs)))
+    {
+        throw Exception("Invalid display / view pairs to bake.");
+    }
+
+    // Spread the threads between the pairs first, and then between the LUT entries.
+    const unsigned numThreads = GetNumThreads(getNumThreads());
+    const unsigned numPairThreads = std::max(1u, std::min(numThreads, unsigned(numDisplayViews)));
+
+    // One baker per display / view pair, all sharing the same config (and hence its cache of
+    // processors).
+    std::vector<BakerRcPtr> bakers(numDisplayViews);
+    for (int idx = 0; idx < numDisplayViews; ++idx)
+    {
+        if (!outputs[idx])
+        {
+            throw Exception("Invalid output stream to bake.");
+        }
+
+        bakers[idx] = createEditableCopy();
+        bakers[idx]->setTargetSpace("");
+        bakers[idx]->setDisplayView(displays[idx], views[idx]);
+        bakers[idx]->setNumThreads(numThreads / numPairThreads);
+    }
+
+    ParallelFor(numPairThreads, numDisplayViews, [&bakers, outputs](long begin, long end)
+    {
+        for (long idx = begin; idx < end; ++idx)
+        {
+            bakers[idx]->bake(*outputs[idx]);
+        }
+    });
+}
+
 } // namespace OCIO_NAMESPACE
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+
 #include "BakingUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -130,4 +132,30 @@ void GetTargetRange(const Baker & baker, float& start, float& end)
     return GetSrcRange(baker, baker.getTargetSpace(), start, end);
 }
 
+void ApplyToLutEntries(const Baker & baker,
+                       const ConstCPUProcessorRcPtr & processor,
+                       float * rgb,
+                       long numEntries)
+{
+    // The entries are processed as an image of several rows so the rows could be split
+    // across the threads, the remaining entries forming a last shorter row.
+    static constexpr long RowSize = 1024;
+
+    const long width = std::min(numEntries, RowSize);
+    const long height = width > 0 ? numEntries / width : 0;
+
+    if (height > 0)
+    {
+        PackedImageDesc img(rgb, width, height, 3);
+        processor->apply(img, baker.getNumThreads());
+    }
+
+    const long numRemainingEntries = numEntries - width * height;
+    if (numRemainingEntries > 0)
+    {
+        PackedImageDesc img(rgb + 3 * width * height, numRemainingEntries, 1, 3);
+        processor->apply(img);
+    }
+}
+
 } // namespace OCIO_NAMESPACE
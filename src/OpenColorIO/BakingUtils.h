@@ -23,6 +23,13 @@ void GetShaperRange(const Baker & baker, float& start, float& end);
 
 void GetTargetRange(const Baker & baker, float& start, float& end);
 
+// Apply the processor in place to numEntries packed RGB float values (e.g. the entries of
+// an identity LUT), using the number of threads of the baker.
+void ApplyToLutEntries(const Baker & baker,
+                       const ConstCPUProcessorRcPtr & processor,
+                       float * rgb,
+                       long numEntries);
+
 
 } // namespace OCIO_NAMESPACE
 
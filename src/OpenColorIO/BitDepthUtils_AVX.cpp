@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthUtils_AVX.h"
+#if OCIO_USE_AVX && OCIO_USE_F16C
+
+#include <immintrin.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+void AVXConvertHalfToFloat(const half * in, float * out, long numValues)
+{
+    long i = 0;
+    for (; i + 8 <= numValues; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128((const __m128i *)(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+
+    for (; i < numValues; ++i)
+    {
+        out[i] = in[i];
+    }
+}
+
+void AVXConvertFloatToHalf(const float * in, half * out, long numValues)
+{
+    long i = 0;
+    for (; i + 8 <= numValues; i += 8)
+    {
+        const __m256 f = _mm256_loadu_ps(in + i);
+        _mm_storeu_si128((__m128i *)(out + i), _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; i < numValues; ++i)
+    {
+        out[i] = in[i];
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX && OCIO_USE_F16C
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHUTILS_AVX_H
+#define INCLUDED_OCIO_BITDEPTHUTILS_AVX_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BitDepthUtils.h"
+#include "CPUInfo.h"
+
+#if OCIO_USE_AVX && OCIO_USE_F16C
+namespace OCIO_NAMESPACE
+{
+
+// Convert numValues half values to float values using the F16C instructions.
+void AVXConvertHalfToFloat(const half * in, float * out, long numValues);
+
+// Convert numValues float values to half values (rounding to the nearest) using the F16C
+// instructions.
+void AVXConvertFloatToHalf(const float * in, half * out, long numValues);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX && OCIO_USE_F16C
+
+#endif /* INCLUDED_OCIO_BITDEPTHUTILS_AVX_H */
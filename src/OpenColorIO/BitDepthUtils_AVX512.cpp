@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthUtils_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <cstring>
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Note that the 512-bit conversions are part of AVX-512F, the AVX-512 FP16 extension is only
+// needed for the half arithmetic.
+
+void AVX512ConvertHalfToFloat(const half * in, float * out, long numValues)
+{
+    long i = 0;
+    for (; i + 16 <= numValues; i += 16)
+    {
+        const __m256i h = _mm256_loadu_si256((const __m256i *)(in + i));
+        _mm512_storeu_ps(out + i, avx512_cvtph_ps(h));
+    }
+
+    // Process the remaining values with a mask.
+    if (i < numValues)
+    {
+        const __mmask16 mask = (__mmask16)((1u << (numValues - i)) - 1u);
+
+        uint16_t tmp[16] = {};
+        memcpy(tmp, in + i, (numValues - i) * sizeof(half));
+        const __m256i h = _mm256_loadu_si256((const __m256i *)tmp);
+        _mm512_mask_storeu_ps(out + i, mask, avx512_cvtph_ps(h));
+    }
+}
+
+void AVX512ConvertFloatToHalf(const float * in, half * out, long numValues)
+{
+    long i = 0;
+    for (; i + 16 <= numValues; i += 16)
+    {
+        const __m512 f = _mm512_loadu_ps(in + i);
+        _mm256_storeu_si256((__m256i *)(out + i),
+                            avx512_cvtps_ph<_MM_FROUND_TO_NEAREST_INT>(f));
+    }
+
+    // Process the remaining values with a mask.
+    if (i < numValues)
+    {
+        const __mmask16 mask = (__mmask16)((1u << (numValues - i)) - 1u);
+
+        uint16_t tmp[16];
+        const __m512 f = _mm512_maskz_loadu_ps(mask, in + i);
+        _mm256_storeu_si256((__m256i *)tmp, avx512_cvtps_ph<_MM_FROUND_TO_NEAREST_INT>(f));
+        memcpy(out + i, tmp, (numValues - i) * sizeof(half));
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHUTILS_AVX512_H
+#define INCLUDED_OCIO_BITDEPTHUTILS_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BitDepthUtils.h"
+#include "CPUInfo.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Convert numValues half values to float values, 16 values at a time.
+void AVX512ConvertHalfToFloat(const half * in, float * out, long numValues);
+
+// Convert numValues float values to half values (rounding to the nearest), 16 values at a time.
+void AVX512ConvertFloatToHalf(const float * in, half * out, long numValues);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_BITDEPTHUTILS_AVX512_H */
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "BitDepthUtils_SSE2.h"
+
+#if OCIO_USE_SSE2
+
+#include "SSE2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+inline __m128i FloatToInt(const float * in, __m128 scale, __m128 maxValue)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in), scale), half);
+
+    // Note that _mm_max_ps returns the second operand (i.e. 0) for NaN values.
+    v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), maxValue);
+
+    return _mm_cvttps_epi32(v);
+}
+
+template<typename T>
+inline void ConvertToFloat(const T * in, float * out, float scale, long numValues)
+{
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        out[idx] = in[idx] * scale;
+    }
+}
+
+template<typename T>
+inline void ConvertFromFloat(const float * in, T * out, float scale, float maxValue,
+                             long numValues)
+{
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        const float v = in[idx] * scale + 0.5f;
+        out[idx] = (T)(v > maxValue ? maxValue : (v >= 0.0f ? v : 0.0f));
+    }
+}
+
+} // anon
+
+void SSE2ConvertToFloat(const uint8_t * in, float * out, float scale, long numValues)
+{
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128i zero = _mm_setzero_si128();
+
+    long idx = 0;
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(in + idx));
+
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+        _mm_storeu_ps(out + idx +  0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), s));
+        _mm_storeu_ps(out + idx +  4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), s));
+        _mm_storeu_ps(out + idx +  8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), s));
+        _mm_storeu_ps(out + idx + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), s));
+    }
+
+    ConvertToFloat(in + idx, out + idx, scale, numValues - idx);
+}
+
+void SSE2ConvertToFloat(const uint16_t * in, float * out, float scale, long numValues)
+{
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128i zero = _mm_setzero_si128();
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(in + idx));
+
+        _mm_storeu_ps(out + idx + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), s));
+        _mm_storeu_ps(out + idx + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), s));
+    }
+
+    ConvertToFloat(in + idx, out + idx, scale, numValues - idx);
+}
+
+void SSE2ConvertFromFloat(const float * in, uint8_t * out, float scale, float maxValue,
+                          long numValues)
+{
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128 m = _mm_set1_ps(maxValue);
+
+    long idx = 0;
+    for (; idx + 16 <= numValues; idx += 16)
+    {
+        const __m128i i0 = FloatToInt(in + idx +  0, s, m);
+        const __m128i i1 = FloatToInt(in + idx +  4, s, m);
+        const __m128i i2 = FloatToInt(in + idx +  8, s, m);
+        const __m128i i3 = FloatToInt(in + idx + 12, s, m);
+
+        // The values are already in [0, 255] so the saturations have no effect.
+        const __m128i lo = _mm_packs_epi32(i0, i1);
+        const __m128i hi = _mm_packs_epi32(i2, i3);
+
+        _mm_storeu_si128((__m128i *)(out + idx), _mm_packus_epi16(lo, hi));
+    }
+
+    ConvertFromFloat(in + idx, out + idx, scale, maxValue, numValues - idx);
+}
+
+void SSE2ConvertFromFloat(const float * in, uint16_t * out, float scale, float maxValue,
+                          long numValues)
+{
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128 m = _mm_set1_ps(maxValue);
+
+    // SSE2 only has a signed 32-bit to 16-bit saturation so the values are shifted to the
+    // signed range before the pack and shifted back after.
+    const __m128i offset32 = _mm_set1_epi32(32768);
+    const __m128i offset16 = _mm_set1_epi16(-32768);
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m128i i0 = _mm_sub_epi32(FloatToInt(in + idx + 0, s, m), offset32);
+        const __m128i i1 = _mm_sub_epi32(FloatToInt(in + idx + 4, s, m), offset32);
+
+        _mm_storeu_si128((__m128i *)(out + idx),
+                         _mm_xor_si128(_mm_packs_epi32(i0, i1), offset16));
+    }
+
+    ConvertFromFloat(in + idx, out + idx, scale, maxValue, numValues - idx);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_BITDEPTHUTILS_SSE2_H
+#define INCLUDED_OCIO_BITDEPTHUTILS_SSE2_H
+
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+#if OCIO_USE_SSE2
+namespace OCIO_NAMESPACE
+{
+
+// Convert numValues integer values to float values i.e. out = in * scale.
+void SSE2ConvertToFloat(const uint8_t * in, float * out, float scale, long numValues);
+void SSE2ConvertToFloat(const uint16_t * in, float * out, float scale, long numValues);
+
+// Convert numValues float values to integer values i.e. out = clamp(in * scale + 0.5, 0, max)
+// with a truncation to integer. NaN values become 0.
+void SSE2ConvertFromFloat(const float * in, uint8_t * out, float scale, float maxValue,
+                          long numValues);
+void SSE2ConvertFromFloat(const float * in, uint16_t * out, float scale, float maxValue,
+                          long numValues);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
+
+#endif /* INCLUDED_OCIO_BITDEPTHUTILS_SSE2_H */
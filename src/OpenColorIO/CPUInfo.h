@@ -5,6 +5,8 @@
 #ifndef CPUInfo_H
 #define CPUInfo_H
 
+#include <functional>
+
 #include <OpenColorIO/OpenColorIO.h>
 #include "CPUInfoConfig.h"
 
@@ -77,6 +79,52 @@ struct CPUInfo
 
 #undef x86_check_flags
 
+// Return the kernel of the widest instruction set supported by the CPU at runtime, or nullptr
+// if there is none. A getter is only called when the CPU supports its instruction set (as the
+// getter may be built with the instruction set flags) and a getter returning nullptr falls back
+// to the narrower instruction sets. Create the getters with the OCIO_*_KERNEL() macros below so
+// that the kernels of the instruction sets disabled at build time are never referenced.
+template<typename Func>
+Func * SelectCPUKernel(const std::function<Func *()> & sse2Getter,
+                       const std::function<Func *()> & avx2Getter,
+                       const std::function<Func *()> & avx512Getter)
+{
+    const CPUInfo & cpu = CPUInfo::instance();
+
+    Func * kernel = nullptr;
+    if (avx512Getter && cpu.hasAVX512())
+    {
+        kernel = avx512Getter();
+    }
+    if (!kernel && avx2Getter && cpu.hasAVX2())
+    {
+        kernel = avx2Getter();
+    }
+    if (!kernel && sse2Getter && cpu.hasSSE2())
+    {
+        kernel = sse2Getter();
+    }
+    return kernel;
+}
+
+#if OCIO_USE_SSE2
+#define OCIO_SSE2_KERNEL(getter) [&]() { return getter; }
+#else
+#define OCIO_SSE2_KERNEL(getter) nullptr
+#endif
+
+#if OCIO_USE_AVX2
+#define OCIO_AVX2_KERNEL(getter) [&]() { return getter; }
+#else
+#define OCIO_AVX2_KERNEL(getter) nullptr
+#endif
+
+#if OCIO_USE_AVX512
+#define OCIO_AVX512_KERNEL(getter) [&]() { return getter; }
+#else
+#define OCIO_AVX512_KERNEL(getter) nullptr
+#endif
+
 } // namespace OCIO_NAMESPACE
 
 #endif // CPUInfo_H
@@ -1,22 +1,93 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "BitDepthUtils_AVX.h"
+#include "BitDepthUtils_AVX512.h"
+#include "BitDepthUtils_SSE2.h"
+#include "CPUInfo.h"
 #include "CPUProcessor.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/matrix/MatrixOpData.h"
 #include "ops/range/RangeOpCPU.h"
+#include "ProcessorDiskCache.h"
 #include "ScanlineHelper.h"
+#include "ThreadUtils.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// 1024 RGBA float pixels i.e. 16 KB fits in the L1 data cache of most CPUs.
+std::atomic<unsigned> g_cpuProcessorBlockSize{ 1024 };
+
+} // anon
+
+unsigned GetCPUProcessorBlockSize()
+{
+    return g_cpuProcessorBlockSize;
+}
+
+void SetCPUProcessorBlockSize(unsigned numPixels)
+{
+    g_cpuProcessorBlockSize = numPixels;
+}
+
+// Vectorized versions of the integer <-> float bit-depth conversions. They return false when
+// no vectorized version is available for the types.
+
+template<typename InType, typename OutType>
+inline bool FastCastValues(const InType *, OutType *, float, float, long)
+{
+    return false;
+}
+
+#if OCIO_USE_SSE2
+
+inline bool FastCastValues(const uint8_t * in, float * out, float scale, float, long numValues)
+{
+    if (!CPUInfo::instance().hasSSE2()) return false;
+    SSE2ConvertToFloat(in, out, scale, numValues);
+    return true;
+}
+
+inline bool FastCastValues(const uint16_t * in, float * out, float scale, float, long numValues)
+{
+    if (!CPUInfo::instance().hasSSE2()) return false;
+    SSE2ConvertToFloat(in, out, scale, numValues);
+    return true;
+}
+
+inline bool FastCastValues(const float * in, uint8_t * out, float scale, float maxValue,
+                           long numValues)
+{
+    if (!CPUInfo::instance().hasSSE2()) return false;
+    SSE2ConvertFromFloat(in, out, scale, maxValue, numValues);
+    return true;
+}
+
+inline bool FastCastValues(const float * in, uint16_t * out, float scale, float maxValue,
+                           long numValues)
+{
+    if (!CPUInfo::instance().hasSSE2()) return false;
+    SSE2ConvertFromFloat(in, out, scale, maxValue, numValues);
+    return true;
+}
+
+#endif // OCIO_USE_SSE2
+
 template<BitDepth inBD, BitDepth outBD>
 class BitDepthCast : public OpCPU
 {
@@ -32,6 +103,11 @@ public:
         const InType * in = reinterpret_cast<const InType*>(inImg);
         OutType * out = reinterpret_cast<OutType*>(outImg);
 
+        if (FastCastValues(in, out, m_scale, float(BitDepthInfo<outBD>::maxValue), 4 * numPixels))
+        {
+            return;
+        }
+
         for(long pxl=0; pxl<numPixels; ++pxl)
         {
             out[0] = Converter<outBD>::CastValue(in[0] * m_scale);
@@ -63,6 +139,112 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    bool hasApplyRGB() const override { return true; }
+
+    void applyRGB(const float * in, float * out, long numPixels) const override
+    {
+        if(in!=out)
+        {
+            memcpy(out, in, 3*numPixels*sizeof(float));
+        }
+    }
+};
+
+// The half <-> float conversions are only value conversions (i.e. scale of 1) so they use the
+// hardware conversion instructions when available.
+
+typedef void (HalfToFloatFunc)(const half * in, float * out, long numValues);
+typedef void (FloatToHalfFunc)(const float * in, half * out, long numValues);
+
+void ConvertHalfToFloat(const half * in, float * out, long numValues)
+{
+    for(long i=0; i<numValues; ++i)
+    {
+        out[i] = in[i];
+    }
+}
+
+void ConvertFloatToHalf(const float * in, half * out, long numValues)
+{
+    for(long i=0; i<numValues; ++i)
+    {
+        out[i] = in[i];
+    }
+}
+
+HalfToFloatFunc * GetHalfToFloatFunc()
+{
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        return AVX512ConvertHalfToFloat;
+    }
+#endif
+
+#if OCIO_USE_AVX && OCIO_USE_F16C
+    if (CPUInfo::instance().hasAVX() && CPUInfo::instance().hasF16C())
+    {
+        return AVXConvertHalfToFloat;
+    }
+#endif
+
+    return ConvertHalfToFloat;
+}
+
+FloatToHalfFunc * GetFloatToHalfFunc()
+{
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        return AVX512ConvertFloatToHalf;
+    }
+#endif
+
+#if OCIO_USE_AVX && OCIO_USE_F16C
+    if (CPUInfo::instance().hasAVX() && CPUInfo::instance().hasF16C())
+    {
+        return AVXConvertFloatToHalf;
+    }
+#endif
+
+    return ConvertFloatToHalf;
+}
+
+template<>
+class BitDepthCast<BIT_DEPTH_F16, BIT_DEPTH_F32> : public OpCPU
+{
+public:
+    BitDepthCast() = default;
+    ~BitDepthCast() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_convert(reinterpret_cast<const half *>(inImg),
+                  reinterpret_cast<float *>(outImg),
+                  4 * numPixels);
+    }
+
+private:
+    HalfToFloatFunc * m_convert = GetHalfToFloatFunc();
+};
+
+template<>
+class BitDepthCast<BIT_DEPTH_F32, BIT_DEPTH_F16> : public OpCPU
+{
+public:
+    BitDepthCast() = default;
+    ~BitDepthCast() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_convert(reinterpret_cast<const float *>(inImg),
+                  reinterpret_cast<half *>(outImg),
+                  4 * numPixels);
+    }
+
+private:
+    FloatToHalfFunc * m_convert = GetFloatToHalfFunc();
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -128,7 +310,9 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // Either empty or the existing CPU Op (or null) of each op.
+                     const ConstOpCPURcPtrVec & reusedCPUOps)
 {
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
@@ -137,6 +321,15 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
         ConstOpRcPtr op = ops[idx];
         ConstOpDataRcPtr opData = op->data();
 
+        auto getCPUOp = [&]()
+        {
+            if (idx < reusedCPUOps.size() && reusedCPUOps[idx])
+            {
+                return reusedCPUOps[idx];
+            }
+            return op->getCPUOp(fastLogExpPow);
+        };
+
         if(idx==0)
         {
             if(opData->getType()==OpData::Lut1DType)
@@ -146,12 +339,12 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inBitDepthOp = getCPUOp();
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp());
             }
 
             if(maxOps==1)
@@ -168,21 +361,200 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outBitDepthOp = getCPUOp();
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp());
+            }
+        }
+        else
+        {
+            cpuOps.push_back(getCPUOp());
+        }
+    }
+}
+
+
+namespace
+{
+
+typedef std::chrono::steady_clock ProfileClock;
+
+inline uint64_t GetElapsedNanoseconds(const ProfileClock::time_point & start)
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        ProfileClock::now() - start).count());
+}
+
+// Wrap a CPU op to accumulate its processing statistics.
+class ProfiledOpCPU : public OpCPU
+{
+public:
+    ProfiledOpCPU() = delete;
+    ProfiledOpCPU(const ConstOpCPURcPtr & op, CPUProfileStatistics & statistics)
+        :   OpCPU()
+        ,   m_op(op)
+        ,   m_statistics(statistics)
+    {
+    }
+
+    ~ProfiledOpCPU() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        const ProfileClock::time_point start = ProfileClock::now();
+        m_op->apply(inImg, outImg, numPixels);
+        // Read and write 4 float channels per pixel.
+        m_statistics.add(GetElapsedNanoseconds(start), numPixels, 32 * numPixels);
+    }
+
+    bool hasApplyRGB() const override { return m_op->hasApplyRGB(); }
+
+    void applyRGB(const float * inImg, float * outImg, long numPixels) const override
+    {
+        const ProfileClock::time_point start = ProfileClock::now();
+        m_op->applyRGB(inImg, outImg, numPixels);
+        // Read and write 3 float channels per pixel.
+        m_statistics.add(GetElapsedNanoseconds(start), numPixels, 24 * numPixels);
+    }
+
+    bool isDynamic() const override { return m_op->isDynamic(); }
+
+    bool hasDynamicProperty(DynamicPropertyType type) const override
+    {
+        return m_op->hasDynamicProperty(type);
+    }
+
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override
+    {
+        return m_op->getDynamicProperty(type);
+    }
+
+private:
+    ConstOpCPURcPtr m_op;
+    CPUProfileStatistics & m_statistics;
+};
+
+// Number of bytes of the RGB or RGBA pixels of an image.
+uint64_t GetPixelSizeInBytes(const ImageDesc & img)
+{
+    return uint64_t(GetChannelSizeInBytes(img.getBitDepth())) * (img.getAData() ? 4 : 3);
+}
+
+// A first or last 1D LUT op also converting from or to a non 32-bit float bit-depth has no
+// 32-bit float CPU op.
+constexpr size_t InvalidCPUOpPosition = size_t(-1);
+
+// Get the position of the CPU op of each op in the CPU ops created by CreateCPUEngine() i.e.
+// 0 for the in bit-depth op, 1 to N for the N CPU ops and N + 1 for the out bit-depth op.
+std::vector<size_t> GetCPUOpPositions(const OpRcPtrVec & ops, BitDepth in, BitDepth out)
+{
+    const size_t numOps = ops.size();
+    std::vector<size_t> positions(numOps, InvalidCPUOpPosition);
+
+    size_t numCPUOps = 0;
+    bool isLastOutBitDepthOp = false;
+
+    for (size_t idx = 0; idx < numOps; ++idx)
+    {
+        const bool isFirst = idx == 0;
+        const bool isLast  = !isFirst && idx == (numOps - 1);
+
+        if (isFirst || isLast)
+        {
+            if ((isFirst ? in : out) == BIT_DEPTH_F32)
+            {
+                positions[idx] = 0;
+                isLastOutBitDepthOp = isLast;
+            }
+            else if (ConstOpRcPtr(ops[idx])->data()->getType() != OpData::Lut1DType)
+            {
+                positions[idx] = ++numCPUOps;
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            positions[idx] = ++numCPUOps;
+        }
+    }
+
+    if (isLastOutBitDepthOp)
+    {
+        positions[numOps - 1] = numCPUOps + 1;
+    }
+
+    return positions;
+}
+
+template<typename CPUOpPtr, typename CPUOpPtrVec>
+CPUOpPtr & GetCPUOpAt(size_t position, CPUOpPtr & inBitDepthOp, CPUOpPtrVec & cpuOps,
+                      CPUOpPtr & outBitDepthOp)
+{
+    if (position == 0)
+    {
+        return inBitDepthOp;
+    }
+    else if (position <= cpuOps.size())
+    {
+        return cpuOps[position - 1];
+    }
+    return outBitDepthOp;
+}
+
+// Copy the values of the dynamic properties from one CPU op to another one of the same op.
+void CopyDynamicPropertyValues(const OpCPU & src, const OpCPU & dst)
+{
+    static constexpr DynamicPropertyType types[] = {
+        DYNAMIC_PROPERTY_EXPOSURE,
+        DYNAMIC_PROPERTY_CONTRAST,
+        DYNAMIC_PROPERTY_GAMMA,
+        DYNAMIC_PROPERTY_GRADING_PRIMARY,
+        DYNAMIC_PROPERTY_GRADING_RGBCURVE,
+        DYNAMIC_PROPERTY_GRADING_HUECURVE,
+        DYNAMIC_PROPERTY_GRADING_TONE
+    };
+
+    for (const auto type : types)
+    {
+        if (!src.hasDynamicProperty(type) || !dst.hasDynamicProperty(type))
+        {
+            continue;
+        }
+
+        DynamicPropertyRcPtr srcProp = src.getDynamicProperty(type);
+        DynamicPropertyRcPtr dstProp = dst.getDynamicProperty(type);
+
+        switch (type)
+        {
+            case DYNAMIC_PROPERTY_EXPOSURE:
+            case DYNAMIC_PROPERTY_CONTRAST:
+            case DYNAMIC_PROPERTY_GAMMA:
+                DynamicPropertyValue::AsDouble(dstProp)->setValue(
+                    DynamicPropertyValue::AsDouble(srcProp)->getValue());
+                break;
+            case DYNAMIC_PROPERTY_GRADING_PRIMARY:
+                DynamicPropertyValue::AsGradingPrimary(dstProp)->setValue(
+                    DynamicPropertyValue::AsGradingPrimary(srcProp)->getValue());
+                break;
+            case DYNAMIC_PROPERTY_GRADING_RGBCURVE:
+                DynamicPropertyValue::AsGradingRGBCurve(dstProp)->setValue(
+                    DynamicPropertyValue::AsGradingRGBCurve(srcProp)->getValue());
+                break;
+            case DYNAMIC_PROPERTY_GRADING_HUECURVE:
+                DynamicPropertyValue::AsGradingHueCurve(dstProp)->setValue(
+                    DynamicPropertyValue::AsGradingHueCurve(srcProp)->getValue());
+                break;
+            case DYNAMIC_PROPERTY_GRADING_TONE:
+                DynamicPropertyValue::AsGradingTone(dstProp)->setValue(
+                    DynamicPropertyValue::AsGradingTone(srcProp)->getValue());
+                break;
         }
     }
 }
 
+} // anon
 
 ScanlineHelper * CreateScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
                                       BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
@@ -308,6 +680,48 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
 }
 
+namespace
+{
+
+// Does any op compute the color channels using the alpha channel? Only a matrix with a non-zero
+// alpha column does it, all the other ops process the alpha channel independently (if at all).
+bool IsAlphaUsedByColor(const OpRcPtrVec & ops)
+{
+    for (size_t idx = 0; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        ConstOpDataRcPtr opData = op->data();
+        if (opData->getType() == OpData::MatrixType)
+        {
+            ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(opData);
+
+            const unsigned long dim = mat->getArray().getLength();
+            const ArrayDouble::Values & m = mat->getArray().getValues();
+
+            if (m[3] != 0.0 || m[dim + 3] != 0.0 || m[2 * dim + 3] != 0.0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Is the image a packed RGB 32-bit float image (i.e. three contiguous channels per pixel)?
+bool IsPackedFloatRGB(const ImageDesc & img)
+{
+    const char * r = reinterpret_cast<const char *>(img.getRData());
+
+    return img.getBitDepth() == BIT_DEPTH_F32
+        && img.getAData() == nullptr
+        && reinterpret_cast<const char *>(img.getGData()) == r + sizeof(float)
+        && reinterpret_cast<const char *>(img.getBData()) == r + 2 * sizeof(float)
+        && img.getXStrideBytes() == ptrdiff_t(3 * sizeof(float));
+}
+
+} // anon
+
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
                        OptimizationFlags oFlags)
@@ -320,11 +734,32 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
         ops.finalize();
 
         // Optimize the ops.
-        ops.optimize(oFlags);
-        ops.optimizeForBitdepth(in, out, oFlags);
+        OptimizeFinalizedOps(ops, in, out, oFlags);
     }
+}
+
+void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
+                                  BitDepth in, BitDepth out,
+                                  OptimizationFlags oFlags)
+{
+    // Get the ops of the color transformation without the bit-depth adjustments.
+
+    OpRcPtrVec ops;
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+
+    finalizeOptimizedOps(ops, ConstOpCPURcPtrVec(), in, out, oFlags);
+}
+
+void CPUProcessor::Impl::finalizeOptimizedOps(const OpRcPtrVec & optimizedOps,
+                                              const ConstOpCPURcPtrVec & reusedCPUOps,
+                                              BitDepth in, BitDepth out,
+                                              OptimizationFlags oFlags)
+{
+    AutoMutex lock(m_mutex);
+
+    OpRcPtrVec ops = optimizedOps;
 
-    // The previous code could change the list of ops so an explicit check to empty is still needed.
+    // The optimization could remove all the ops so an explicit check to empty is needed.
     if(ops.empty())
     {
         // Needs at least one op (even an identity one) as the input and output buffers could be
@@ -336,18 +771,6 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
     {
         ops.validateDynamicProperties();
     }
-}
-
-void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
-                                  BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
-{
-    AutoMutex lock(m_mutex);
-
-    // Get the ops of the color transformation without the bit-depth adjustments.
-
-    OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -358,12 +781,45 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     // Does the color processing introduce crosstalk between the pixel channels?
     m_hasChannelCrosstalk = ops.hasChannelCrosstalk();
 
+    // The packed RGB images could skip the alpha channel only if it has no effect on the colors.
+    m_canApplyRGB = m_inBitDepth == BIT_DEPTH_F32 && m_outBitDepth == BIT_DEPTH_F32
+                    && !IsAlphaUsedByColor(ops);
+
     // Get the CPU Ops while taking care of the input and output bit-depths.
 
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp,
+                    reusedCPUOps.size() == ops.size() ? reusedCPUOps : ConstOpCPURcPtrVec());
+
+    const std::vector<size_t> positions = GetCPUOpPositions(ops, in, out);
+
+    createProfiledEngine(ops, positions);
+
+    // Keep the dynamic ops to create the dynamic property snapshots.
+
+    m_fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
+
+    m_dynamicOps.clear();
+    for (size_t idx = 0; idx < ops.size(); ++idx)
+    {
+        if (ops[idx]->isDynamic() && positions[idx] != InvalidCPUOpPosition)
+        {
+            CPUDynamicOp dynamicOp;
+            dynamicOp.m_op         = ops[idx];
+            dynamicOp.m_opIndex    = idx;
+            dynamicOp.m_position   = positions[idx];
+            dynamicOp.m_statistics = &m_opProfiles[idx]->m_statistics;
+            m_dynamicOps.push_back(dynamicOp);
+        }
+    }
+
+    // The pooled scanline helpers refer to the previous bit-depth conversion ops.
+    {
+        AutoMutex helpersLock(m_scanlineHelpersMutex);
+        m_scanlineHelpers.clear();
+    }
 
     // Compute the cache id.
 
@@ -376,92 +832,550 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+ConstOpCPURcPtrVec CPUProcessor::Impl::getCPUOps() const
+{
+    ConstOpCPURcPtrVec cpuOps{ m_inBitDepthOp };
+    cpuOps.insert(cpuOps.end(), m_cpuOps.begin(), m_cpuOps.end());
+    cpuOps.push_back(m_outBitDepthOp);
+    return cpuOps;
+}
+
+void CPUProcessor::Impl::createProfiledEngine(const OpRcPtrVec & ops,
+                                              const std::vector<size_t> & positions)
+{
+    m_opProfiles.clear();
+    m_profiledCpuOps.clear();
+
+    m_profiledInBitDepthOp = CreateGenericBitDepthHelper(m_inBitDepth, BIT_DEPTH_F32);
+    m_profiledOutBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, m_outBitDepth);
 
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+    const ConstOpCPURcPtr identity = CreateGenericBitDepthHelper(BIT_DEPTH_F32, BIT_DEPTH_F32);
+    m_profiledPackOp = std::make_shared<ProfiledOpCPU>(identity, m_packStatistics);
+    m_profiledUnpackOp = std::make_shared<ProfiledOpCPU>(identity, m_unpackStatistics);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    // Use the CPU op of each op (refer to CreateCPUEngine()) to reuse the same instances.
 
-    while(true)
+    const size_t numOps = ops.size();
+
+    for (size_t idx = 0; idx < numOps; ++idx)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        ConstOpRcPtr op = ops[idx];
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+        ConstOpCPURcPtr cpuOp;
+        if (positions[idx] != InvalidCPUOpPosition)
+        {
+            cpuOp = GetCPUOpAt(positions[idx], m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+        }
+        else
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            // The 1D LUT renderer also converts the bit-depth, so it needs a 32-bit float
+            // one (note that 1D LUTs do not have dynamic properties).
+            ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(op->data());
+            cpuOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, BIT_DEPTH_F32);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        m_opProfiles.emplace_back(new CPUOpProfile(*op));
+        m_profiledCpuOps.push_back(
+            std::make_shared<ProfiledOpCPU>(cpuOp, m_opProfiles.back()->m_statistics));
     }
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
+void CPUProcessor::Impl::resetProfiling() const noexcept
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    for (auto & profile : m_opProfiles)
+    {
+        profile->m_statistics.reset();
+    }
 
-    // Prepare the processing.
-    scanlineBuilder->init(srcImgDesc, dstImgDesc);
+    m_packStatistics.reset();
+    m_unpackStatistics.reset();
+}
+
+const CPUOpProfile & CPUProcessor::Impl::getProfiledOp(int index) const
+{
+    if (index < 0 || index >= getNumProfiledOps())
+    {
+        std::ostringstream oss;
+        oss << "Invalid profiled op index " << index << " where the number of profiled ops is "
+            << getNumProfiledOps() << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    return *m_opProfiles[index];
+}
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+CPUProcessor::Impl::~Impl() = default;
 
-    while(true)
+std::unique_ptr<ScanlineHelper> CPUProcessor::Impl::acquireScanlineHelper() const
+{
+    {
+        AutoMutex lock(m_scanlineHelpersMutex);
+
+        if (!m_scanlineHelpers.empty())
+        {
+            std::unique_ptr<ScanlineHelper> scanlineBuilder = std::move(m_scanlineHelpers.back());
+            m_scanlineHelpers.pop_back();
+            return scanlineBuilder;
+        }
+    }
+
+    return std::unique_ptr<ScanlineHelper>(
+        CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp, m_outBitDepth, m_outBitDepthOp));
+}
+
+void CPUProcessor::Impl::releaseScanlineHelper(std::unique_ptr<ScanlineHelper> && scanlineBuilder) const
+{
+    // Only keep one scanline helper per hardware thread to bound the memory footprint. The
+    // hardware thread count is only queried once as it is not cheap on some platforms.
+    static const size_t maxScanlineHelpers = GetNumThreads(0);
+
+    AutoMutex lock(m_scanlineHelpersMutex);
+
+    if (m_scanlineHelpers.size() < maxScanlineHelpers)
+    {
+        m_scanlineHelpers.push_back(std::move(scanlineBuilder));
+    }
+}
+
+void CPUProcessor::Impl::applyScanlines(const ImageDesc & srcImgDesc,
+                                        const ImageDesc * dstImgDesc,
+                                        long yBegin, long yEnd,
+                                        const DynamicPropertySnapshot::Impl * snapshot) const
+{
+    const bool profiling = m_profilingEnabled;
+
+    if (m_canApplyRGB && IsPackedFloatRGB(srcImgDesc)
+        && (!dstImgDesc || IsPackedFloatRGB(*dstImgDesc)))
+    {
+        applyRGBScanlines(srcImgDesc, dstImgDesc ? *dstImgDesc : srcImgDesc, yBegin, yEnd,
+                          profiling, snapshot);
+        return;
+    }
+
+    const ConstOpCPURcPtr & inBitDepthOp
+        = profiling ? m_profiledInBitDepthOp
+                    : (snapshot ? snapshot->m_inBitDepthOp : m_inBitDepthOp);
+    const ConstOpCPURcPtr & outBitDepthOp
+        = profiling ? m_profiledOutBitDepthOp
+                    : (snapshot ? snapshot->m_outBitDepthOp : m_outBitDepthOp);
+
+    const ConstOpCPURcPtrVec & cpuOps
+        = profiling ? (snapshot ? snapshot->m_profiledCpuOps : m_profiledCpuOps)
+                    : (snapshot ? snapshot->m_cpuOps : m_cpuOps);
+
+    // The pooled scanline helpers use the bit-depth conversions of the CPU processor, so the
+    // ones of the profiling (or of a snapshot where the first or last op is dynamic) are not
+    // pooled.
+    const bool pooled = inBitDepthOp == m_inBitDepthOp && outBitDepthOp == m_outBitDepthOp;
+
+    std::unique_ptr<ScanlineHelper> scanlineBuilder
+        = pooled ? acquireScanlineHelper()
+                 : std::unique_ptr<ScanlineHelper>(
+                       CreateScanlineHelper(m_inBitDepth, inBitDepthOp,
+                                            m_outBitDepth, outBitDepthOp));
+
+    // The packing reads the source pixels and writes RGBA float pixels, and the unpacking
+    // does the reverse.
+    const uint64_t packPixelBytes = GetPixelSizeInBytes(srcImgDesc) + 16;
+    const uint64_t unpackPixelBytes = GetPixelSizeInBytes(dstImgDesc ? *dstImgDesc : srcImgDesc) + 16;
+
+    try
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        // Prepare the processing.
+        if (dstImgDesc)
+        {
+            scanlineBuilder->init(srcImgDesc, *dstImgDesc);
+        }
+        else
+        {
+            scanlineBuilder->init(srcImgDesc);
+        }
+
+        scanlineBuilder->setScanlineRange(yBegin, yEnd);
+
+        float * rgbaBuffer = nullptr;
+        long numPixels = 0;
+
+        const size_t numOps = cpuOps.size();
+        const long blockSize = long(GetCPUProcessorBlockSize());
+
+        while(true)
+        {
+            ProfileClock::time_point start;
+            if (profiling) start = ProfileClock::now();
+
+            scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+            if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+            if (profiling)
+            {
+                m_packStatistics.add(GetElapsedNanoseconds(start), numPixels,
+                                     packPixelBytes * numPixels);
+            }
+
+            // Run all the ops on a block of pixels while it is still in the CPU caches,
+            // before moving to the next block.
+            const long numPixelsPerBlock = blockSize > 0 ? blockSize : numPixels;
+
+            for(long pxl = 0; pxl<numPixels; pxl += numPixelsPerBlock)
+            {
+                float * block = rgbaBuffer + 4 * pxl;
+                const long numBlockPixels = std::min(numPixelsPerBlock, numPixels - pxl);
+
+                for(size_t i = 0; i<numOps; ++i)
+                {
+                    cpuOps[i]->apply(block, block, numBlockPixels);
+                }
+            }
+
+            if (profiling) start = ProfileClock::now();
+
+            scanlineBuilder->finishRGBAScanline();
+
+            if (profiling)
+            {
+                m_unpackStatistics.add(GetElapsedNanoseconds(start), numPixels,
+                                       unpackPixelBytes * numPixels);
+            }
+        }
+    }
+    catch (...)
+    {
+        if (pooled)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            releaseScanlineHelper(std::move(scanlineBuilder));
         }
+        throw;
+    }
 
-        scanlineBuilder->finishRGBAScanline();
+    if (pooled)
+    {
+        releaseScanlineHelper(std::move(scanlineBuilder));
     }
 }
 
+void CPUProcessor::Impl::applyRGBScanlines(const ImageDesc & srcImgDesc,
+                                           const ImageDesc & dstImgDesc,
+                                           long yBegin, long yEnd,
+                                           bool profiling,
+                                           const DynamicPropertySnapshot::Impl * snapshot) const
+{
+    if(srcImgDesc.getWidth()!=dstImgDesc.getWidth()
+        || srcImgDesc.getHeight()!=dstImgDesc.getHeight())
+    {
+        throw Exception("Dimension inconsistency between source and destination image buffers.");
+    }
+
+    // The complete list of ops i.e. including the first and last ones.
+    const ConstOpCPURcPtrVec & cpuOps
+        = profiling ? (snapshot ? snapshot->m_profiledCpuOps : m_profiledCpuOps)
+                    : (snapshot ? snapshot->m_cpuOps : m_cpuOps);
+
+    std::vector<const OpCPU *> ops;
+    ops.reserve(cpuOps.size() + 2);
+    ops.push_back(profiling ? m_profiledPackOp.get()
+                            : (snapshot ? snapshot->m_inBitDepthOp : m_inBitDepthOp).get());
+    for (const auto & op : cpuOps)
+    {
+        ops.push_back(op.get());
+    }
+    ops.push_back(profiling ? m_profiledUnpackOp.get()
+                            : (snapshot ? snapshot->m_outBitDepthOp : m_outBitDepthOp).get());
+
+    const size_t numOps = ops.size();
+
+    // The ops without a 3-channel renderer process consecutive ops on a small RGBA buffer
+    // staying in the L1 data cache.
+    constexpr long RGBABufferSize = 256;
+    float rgbaBuffer[4 * RGBABufferSize];
+
+    const long width = dstImgDesc.getWidth();
+    const long blockSize = long(GetCPUProcessorBlockSize());
+    const long numPixelsPerBlock = blockSize > 0 ? blockSize : width;
+
+    const char * srcData = reinterpret_cast<const char *>(srcImgDesc.getRData());
+    char * dstData = reinterpret_cast<char *>(dstImgDesc.getRData());
+
+    for (long y = yBegin; y < yEnd; ++y)
+    {
+        const float * srcRow
+            = reinterpret_cast<const float *>(srcData + srcImgDesc.getYStrideBytes() * y);
+        float * dstRow = reinterpret_cast<float *>(dstData + dstImgDesc.getYStrideBytes() * y);
+
+        // Run all the ops on a block of pixels while it is still in the CPU caches, before
+        // moving to the next block.
+        for (long pxl = 0; pxl < width; pxl += numPixelsPerBlock)
+        {
+            const long numBlockPixels = std::min(numPixelsPerBlock, width - pxl);
+
+            // The first op reads the source image, the next ones process the destination
+            // image in place.
+            const float * in = srcRow + 3 * pxl;
+            float * out = dstRow + 3 * pxl;
+
+            size_t opIdx = 0;
+            while (opIdx < numOps)
+            {
+                if (ops[opIdx]->hasApplyRGB())
+                {
+                    ops[opIdx]->applyRGB(in, out, numBlockPixels);
+                    ++opIdx;
+                }
+                else
+                {
+                    size_t lastOpIdx = opIdx;
+                    while (lastOpIdx < numOps && !ops[lastOpIdx]->hasApplyRGB())
+                    {
+                        ++lastOpIdx;
+                    }
+
+                    for (long idx = 0; idx < numBlockPixels; idx += RGBABufferSize)
+                    {
+                        const long numPixels = std::min(RGBABufferSize, numBlockPixels - idx);
+
+                        ProfileClock::time_point start;
+                        if (profiling) start = ProfileClock::now();
+
+                        const float * rgbIn = in + 3 * idx;
+                        for (long p = 0; p < numPixels; ++p)
+                        {
+                            rgbaBuffer[4 * p + 0] = rgbIn[3 * p + 0];
+                            rgbaBuffer[4 * p + 1] = rgbIn[3 * p + 1];
+                            rgbaBuffer[4 * p + 2] = rgbIn[3 * p + 2];
+                            rgbaBuffer[4 * p + 3] = 0.0f;
+                        }
+
+                        if (profiling)
+                        {
+                            m_packStatistics.add(GetElapsedNanoseconds(start), numPixels,
+                                                 28 * uint64_t(numPixels));
+                        }
+
+                        for (size_t i = opIdx; i < lastOpIdx; ++i)
+                        {
+                            ops[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+                        }
+
+                        if (profiling) start = ProfileClock::now();
+
+                        float * rgbOut = out + 3 * idx;
+                        for (long p = 0; p < numPixels; ++p)
+                        {
+                            rgbOut[3 * p + 0] = rgbaBuffer[4 * p + 0];
+                            rgbOut[3 * p + 1] = rgbaBuffer[4 * p + 1];
+                            rgbOut[3 * p + 2] = rgbaBuffer[4 * p + 2];
+                        }
+
+                        if (profiling)
+                        {
+                            m_unpackStatistics.add(GetElapsedNanoseconds(start), numPixels,
+                                                   28 * uint64_t(numPixels));
+                        }
+                    }
+
+                    opIdx = lastOpIdx;
+                }
+
+                in = out;
+            }
+        }
+    }
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
+{   
+    applyScanlines(imgDesc, nullptr, 0, imgDesc.getHeight(), nullptr);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
+{
+    applyScanlines(srcImgDesc, &dstImgDesc, 0, dstImgDesc.getHeight(), nullptr);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    apply(imgDesc, nullptr, numThreads);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc,
+                               ImageDesc & dstImgDesc,
+                               unsigned numThreads) const
+{
+    apply(srcImgDesc, dstImgDesc, nullptr, numThreads);
+}
+
 void CPUProcessor::Impl::applyRGB(float * pixel) const
 {
-    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+    applyRGB(pixel, nullptr);
+}
 
-    m_inBitDepthOp->apply(v, v, 1);
+void CPUProcessor::Impl::applyRGBA(float * pixel) const
+{
+    applyRGBA(pixel, nullptr);
+}
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+DynamicPropertySnapshotRcPtr CPUProcessor::Impl::createDynamicPropertySnapshot() const
+{
+    DynamicPropertySnapshotRcPtr snapshot(new DynamicPropertySnapshot(),
+                                          &DynamicPropertySnapshot::deleter);
+
+    DynamicPropertySnapshot::Impl * impl = snapshot->getImpl();
+
+    impl->m_processor      = this;
+    impl->m_dynamicOps     = m_dynamicOps;
+    impl->m_fastLogExpPow  = m_fastLogExpPow;
+    impl->m_inBitDepthOp   = m_inBitDepthOp;
+    impl->m_cpuOps         = m_cpuOps;
+    impl->m_outBitDepthOp  = m_outBitDepthOp;
+    impl->m_profiledCpuOps = m_profiledCpuOps;
+
+    impl->duplicateDynamicOps();
+
+    return snapshot;
+}
+
+const DynamicPropertySnapshot::Impl *
+    CPUProcessor::Impl::getSnapshot(const ConstDynamicPropertySnapshotRcPtr & snapshot) const
+{
+    if (!snapshot)
     {
-        m_cpuOps[i]->apply(v, v, 1);
+        return nullptr;
     }
 
-    m_outBitDepthOp->apply(v, v, 1);
+    const DynamicPropertySnapshot::Impl * impl = snapshot->getImpl();
+    if (impl->m_processor != this)
+    {
+        throw Exception("The dynamic property snapshot does not come from this CPU processor.");
+    }
+
+    return impl;
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc,
+                               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                               unsigned numThreads) const
+{
+    const DynamicPropertySnapshot::Impl * snapshotImpl = getSnapshot(snapshot);
+
+    // Each thread processes a contiguous band of scanlines using its own ScanlineHelper
+    // and so, its own intermediate buffers.
+    ParallelFor(numThreads, imgDesc.getHeight(),
+                [this, &imgDesc, snapshotImpl](long yBegin, long yEnd)
+    {
+        applyScanlines(imgDesc, nullptr, yBegin, yEnd, snapshotImpl);
+    });
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc,
+                               ImageDesc & dstImgDesc,
+                               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                               unsigned numThreads) const
+{
+    if(srcImgDesc.getWidth()!=dstImgDesc.getWidth()
+        || srcImgDesc.getHeight()!=dstImgDesc.getHeight())
+    {
+        throw Exception("Dimension inconsistency between source and destination image buffers.");
+    }
+
+    const DynamicPropertySnapshot::Impl * snapshotImpl = getSnapshot(snapshot);
+
+    // Each thread processes a contiguous band of scanlines using its own ScanlineHelper
+    // and so, its own intermediate buffers.
+    ParallelFor(numThreads, dstImgDesc.getHeight(),
+                [this, &srcImgDesc, &dstImgDesc, snapshotImpl](long yBegin, long yEnd)
+    {
+        applyScanlines(srcImgDesc, &dstImgDesc, yBegin, yEnd, snapshotImpl);
+    });
+}
+
+void CPUProcessor::Impl::applyRGB(float * pixel,
+                                  const ConstDynamicPropertySnapshotRcPtr & snapshot) const
+{
+    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+
+    applyRGBA(v, snapshot);
 
     pixel[0] = v[0];
     pixel[1] = v[1];
     pixel[2] = v[2];
 }
 
-void CPUProcessor::Impl::applyRGBA(float * pixel) const
+void CPUProcessor::Impl::applyRGBA(float * pixel,
+                                   const ConstDynamicPropertySnapshotRcPtr & snapshot) const
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
+    const DynamicPropertySnapshot::Impl * snapshotImpl = getSnapshot(snapshot);
+
+    const ConstOpCPURcPtrVec & cpuOps = snapshotImpl ? snapshotImpl->m_cpuOps : m_cpuOps;
+
+    (snapshotImpl ? snapshotImpl->m_inBitDepthOp : m_inBitDepthOp)->apply(pixel, pixel, 1);
 
-    const size_t numOps = m_cpuOps.size();
+    const size_t numOps = cpuOps.size();
     for(size_t i = 0; i<numOps; ++i)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
+        cpuOps[i]->apply(pixel, pixel, 1);
     }
 
-    m_outBitDepthOp->apply(pixel, pixel, 1);
+    (snapshotImpl ? snapshotImpl->m_outBitDepthOp : m_outBitDepthOp)->apply(pixel, pixel, 1);
+}
+
+void DynamicPropertySnapshot::Impl::duplicateDynamicOps()
+{
+    for (const auto & dynamicOp : m_dynamicOps)
+    {
+        ConstOpCPURcPtr & cpuOp
+            = GetCPUOpAt(dynamicOp.m_position, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+
+        // The new CPU op has its own copy of the dynamic properties.
+        ConstOpCPURcPtr newCpuOp = dynamicOp.m_op->getCPUOp(m_fastLogExpPow);
+        CopyDynamicPropertyValues(*cpuOp, *newCpuOp);
+
+        cpuOp = newCpuOp;
+        m_profiledCpuOps[dynamicOp.m_opIndex]
+            = std::make_shared<ProfiledOpCPU>(newCpuOp, *dynamicOp.m_statistics);
+    }
+}
+
+bool DynamicPropertySnapshot::Impl::isDynamic() const noexcept
+{
+    for (const auto & dynamicOp : m_dynamicOps)
+    {
+        if (GetCPUOpAt(dynamicOp.m_position, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp)->isDynamic())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool DynamicPropertySnapshot::Impl::hasDynamicProperty(DynamicPropertyType type) const noexcept
+{
+    for (const auto & dynamicOp : m_dynamicOps)
+    {
+        const ConstOpCPURcPtr & cpuOp
+            = GetCPUOpAt(dynamicOp.m_position, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+        if (cpuOp->hasDynamicProperty(type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+DynamicPropertyRcPtr DynamicPropertySnapshot::Impl::getDynamicProperty(DynamicPropertyType type) const
+{
+    for (const auto & dynamicOp : m_dynamicOps)
+    {
+        const ConstOpCPURcPtr & cpuOp
+            = GetCPUOpAt(dynamicOp.m_position, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+        if (cpuOp->hasDynamicProperty(type))
+        {
+            return cpuOp->getDynamicProperty(type);
+        }
+    }
+
+    throw Exception("Cannot find dynamic property; not used by the dynamic property snapshot.");
 }
 
 
@@ -543,6 +1457,18 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc,
+                         ImageDesc & dstImgDesc,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
@@ -553,4 +1479,148 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+DynamicPropertySnapshotRcPtr CPUProcessor::createDynamicPropertySnapshot() const
+{
+    return getImpl()->createDynamicPropertySnapshot();
+}
+
+void CPUProcessor::apply(const ImageDesc & imgDesc,
+                         const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, snapshot, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc,
+                         ImageDesc & dstImgDesc,
+                         const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, snapshot, numThreads);
+}
+
+void CPUProcessor::applyRGB(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const
+{
+    getImpl()->applyRGB(pixel, snapshot);
+}
+
+void CPUProcessor::applyRGBA(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const
+{
+    getImpl()->applyRGBA(pixel, snapshot);
+}
+
+void CPUProcessor::setProfilingEnabled(bool enabled) const
+{
+    getImpl()->setProfilingEnabled(enabled);
+}
+
+bool CPUProcessor::isProfilingEnabled() const noexcept
+{
+    return getImpl()->isProfilingEnabled();
+}
+
+void CPUProcessor::resetProfiling() const
+{
+    getImpl()->resetProfiling();
+}
+
+int CPUProcessor::getNumProfiledOps() const
+{
+    return getImpl()->getNumProfiledOps();
+}
+
+const char * CPUProcessor::getProfiledOpType(int index) const
+{
+    return getImpl()->getProfiledOp(index).m_type.c_str();
+}
+
+const FormatMetadata & CPUProcessor::getProfiledOpFormatMetadata(int index) const
+{
+    return getImpl()->getProfiledOp(index).m_metadata;
+}
+
+double CPUProcessor::getProfiledOpTime(int index) const
+{
+    return getImpl()->getProfiledOp(index).m_statistics.getSeconds();
+}
+
+unsigned long long CPUProcessor::getProfiledOpNumPixels(int index) const
+{
+    return getImpl()->getProfiledOp(index).m_statistics.m_numPixels;
+}
+
+unsigned long long CPUProcessor::getProfiledOpNumBytes(int index) const
+{
+    return getImpl()->getProfiledOp(index).m_statistics.m_numBytes;
+}
+
+double CPUProcessor::getProfiledPackTime() const
+{
+    return getImpl()->getPackStatistics().getSeconds();
+}
+
+double CPUProcessor::getProfiledUnpackTime() const
+{
+    return getImpl()->getUnpackStatistics().getSeconds();
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////
+
+
+
+
+void DynamicPropertySnapshot::deleter(DynamicPropertySnapshot * c)
+{
+    delete c;
+}
+
+DynamicPropertySnapshot::DynamicPropertySnapshot()
+    :   m_impl(new Impl)
+{
+}
+
+DynamicPropertySnapshot::~DynamicPropertySnapshot()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+DynamicPropertySnapshotRcPtr DynamicPropertySnapshot::createEditableCopy() const
+{
+    DynamicPropertySnapshotRcPtr snapshot(new DynamicPropertySnapshot(),
+                                          &DynamicPropertySnapshot::deleter);
+
+    Impl * impl = snapshot->getImpl();
+
+    impl->m_processor      = getImpl()->m_processor;
+    impl->m_dynamicOps     = getImpl()->m_dynamicOps;
+    impl->m_fastLogExpPow  = getImpl()->m_fastLogExpPow;
+    impl->m_inBitDepthOp   = getImpl()->m_inBitDepthOp;
+    impl->m_cpuOps         = getImpl()->m_cpuOps;
+    impl->m_outBitDepthOp  = getImpl()->m_outBitDepthOp;
+    impl->m_profiledCpuOps = getImpl()->m_profiledCpuOps;
+
+    impl->duplicateDynamicOps();
+
+    return snapshot;
+}
+
+DynamicPropertyRcPtr DynamicPropertySnapshot::getDynamicProperty(DynamicPropertyType type)
+{
+    return getImpl()->getDynamicProperty(type);
+}
+
+bool DynamicPropertySnapshot::hasDynamicProperty(DynamicPropertyType type) const noexcept
+{
+    return getImpl()->hasDynamicProperty(type);
+}
+
+bool DynamicPropertySnapshot::isDynamic() const noexcept
+{
+    return getImpl()->isDynamic();
+}
+
 } // namespace OCIO_NAMESPACE
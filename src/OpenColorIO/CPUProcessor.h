@@ -6,6 +6,11 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
@@ -16,6 +21,89 @@ namespace OCIO_NAMESPACE
 
 class ScanlineHelper;
 
+// The cumulative statistics recorded by the profiling. The counters are atomic as several
+// apply calls (or threads of the same apply call) could update them concurrently.
+struct CPUProfileStatistics
+{
+    std::atomic<uint64_t> m_nanoseconds{ 0 };
+    std::atomic<uint64_t> m_numPixels{ 0 };
+    std::atomic<uint64_t> m_numBytes{ 0 };
+
+    void add(uint64_t nanoseconds, uint64_t numPixels, uint64_t numBytes) noexcept
+    {
+        m_nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        m_numPixels.fetch_add(numPixels, std::memory_order_relaxed);
+        m_numBytes.fetch_add(numBytes, std::memory_order_relaxed);
+    }
+
+    void reset() noexcept
+    {
+        m_nanoseconds = 0;
+        m_numPixels = 0;
+        m_numBytes = 0;
+    }
+
+    double getSeconds() const noexcept { return double(m_nanoseconds) * 1e-9; }
+};
+
+// The profiling statistics of one op with the description of its origin.
+struct CPUOpProfile
+{
+    explicit CPUOpProfile(const Op & op)
+        :   m_type(op.getInfo())
+        ,   m_metadata(op.data()->getFormatMetadata())
+    {
+    }
+
+    const std::string        m_type;
+    const FormatMetadataImpl m_metadata;
+    CPUProfileStatistics     m_statistics;
+};
+
+// A dynamic op of a CPU processor i.e. one to duplicate for a dynamic property snapshot.
+struct CPUDynamicOp
+{
+    ConstOpRcPtr           m_op;
+    // The index of the op i.e. of its profiled CPU op.
+    size_t                 m_opIndex = 0;
+    // The position of its CPU op i.e. 0 for the in bit-depth op, 1 to N for the N CPU ops
+    // and N + 1 for the out bit-depth op.
+    size_t                 m_position = 0;
+    CPUProfileStatistics * m_statistics = nullptr;
+};
+
+typedef std::vector<CPUDynamicOp> CPUDynamicOpVec;
+
+class DynamicPropertySnapshot::Impl
+{
+public:
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl & operator=(const Impl &) = delete;
+
+    ~Impl() = default;
+
+    bool isDynamic() const noexcept;
+    bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
+
+    // Replace the CPU ops of the dynamic ops by new instances, holding the same dynamic
+    // property values, so that the snapshot owns its dynamic properties.
+    void duplicateDynamicOps();
+
+    // The CPU processor the snapshot comes from (only to validate the apply calls).
+    const void *       m_processor = nullptr;
+
+    CPUDynamicOpVec    m_dynamicOps;
+    bool               m_fastLogExpPow = false;
+
+    // Copies of the CPU processor ones where only the CPU ops of the dynamic ops differ.
+    ConstOpCPURcPtr    m_inBitDepthOp;
+    ConstOpCPURcPtrVec m_cpuOps;
+    ConstOpCPURcPtr    m_outBitDepthOp;
+    ConstOpCPURcPtrVec m_profiledCpuOps;
+};
+
 class CPUProcessor::Impl
 {
 public:
@@ -23,7 +111,7 @@ public:
     Impl(const Impl &) = delete;
     Impl& operator=(const Impl &) = delete;
 
-    ~Impl() = default;
+    ~Impl();
 
     // Note: The in and out bit-depths must be equal for isNoOp to be true.
     bool isNoOp() const noexcept { return m_isNoOp; }
@@ -46,18 +134,83 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    // Split the scanlines of the image across numThreads threads (0 means all the
+    // hardware threads).
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     // Note that the method only accepts one packed RGB and 32-bit float pixel.
     void applyRGB(float * pixel) const;
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
     void applyRGBA(float * pixel) const;
 
+    DynamicPropertySnapshotRcPtr createDynamicPropertySnapshot() const;
+
+    // The apply methods using the dynamic properties of the snapshot (or the ones of the CPU
+    // processor when the snapshot is null).
+    void apply(const ImageDesc & imgDesc,
+               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+               unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc,
+               ImageDesc & dstImgDesc,
+               const ConstDynamicPropertySnapshotRcPtr & snapshot,
+               unsigned numThreads) const;
+    void applyRGB(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const;
+    void applyRGBA(float * pixel, const ConstDynamicPropertySnapshotRcPtr & snapshot) const;
+
+    void setProfilingEnabled(bool enabled) const noexcept { m_profilingEnabled = enabled; }
+    bool isProfilingEnabled() const noexcept { return m_profilingEnabled; }
+    void resetProfiling() const noexcept;
+
+    int getNumProfiledOps() const noexcept { return int(m_opProfiles.size()); }
+    const CPUOpProfile & getProfiledOp(int index) const;
+    const CPUProfileStatistics & getPackStatistics() const noexcept { return m_packStatistics; }
+    const CPUProfileStatistics & getUnpackStatistics() const noexcept { return m_unpackStatistics; }
+
     ////////////////////////////////////////////
     //
     // Functions not exposed to the OCIO public API.
 
     void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
 
+    // Same as finalize() for ops which are already finalized and optimized. The reusedCPUOps are
+    // either empty or hold, for each op, the CPU op to use instead of creating a new one (a
+    // null entry creates a new one).
+    void finalizeOptimizedOps(const OpRcPtrVec & ops,
+                              const ConstOpCPURcPtrVec & reusedCPUOps,
+                              BitDepth in, BitDepth out,
+                              OptimizationFlags oFlags);
+
+    // All the CPU ops in order, including the input and output bit-depth conversions.
+    ConstOpCPURcPtrVec getCPUOps() const;
+
 private:
+    // Get a scanline helper from the pool, or create a new one if the pool is empty.
+    std::unique_ptr<ScanlineHelper> acquireScanlineHelper() const;
+    // Give back a scanline helper so that its buffers are reused by a later apply call.
+    void releaseScanlineHelper(std::unique_ptr<ScanlineHelper> && scanlineBuilder) const;
+
+    // Create the CPU ops used while the profiling is enabled.
+    void createProfiledEngine(const OpRcPtrVec & ops, const std::vector<size_t> & positions);
+
+    // Throws if the snapshot does not come from this CPU processor.
+    const DynamicPropertySnapshot::Impl *
+        getSnapshot(const ConstDynamicPropertySnapshotRcPtr & snapshot) const;
+
+    // Process the [yBegin, yEnd) scanlines from srcImgDesc to dstImgDesc, or in place
+    // when dstImgDesc is null. The CPU ops of the snapshot are used when not null.
+    void applyScanlines(const ImageDesc & srcImgDesc,
+                        const ImageDesc * dstImgDesc,
+                        long yBegin, long yEnd,
+                        const DynamicPropertySnapshot::Impl * snapshot) const;
+    // Process in place the [yBegin, yEnd) scanlines of packed RGB 32-bit float images i.e.
+    // without the conversion to the intermediate RGBA buffer.
+    void applyRGBScanlines(const ImageDesc & srcImgDesc,
+                           const ImageDesc & dstImgDesc,
+                           long yBegin, long yEnd,
+                           bool profiling,
+                           const DynamicPropertySnapshot::Impl * snapshot) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
@@ -68,8 +221,36 @@ private:
     bool               m_isNoOp = false;
     bool               m_isIdentity = false;
     bool               m_hasChannelCrosstalk = true;
+    // Could the packed RGB 32-bit float images be processed without the alpha channel?
+    bool               m_canApplyRGB = false;
     std::string        m_cacheID;
     Mutex              m_mutex;
+
+    // The dynamic ops to duplicate when creating a dynamic property snapshot.
+    CPUDynamicOpVec    m_dynamicOps;
+    bool               m_fastLogExpPow = false;
+
+    // While the profiling is enabled, the image apply calls use the following CPU ops instead,
+    // i.e. the bit-depth conversions are not merged with the first and last ops, and each op
+    // records its statistics. Note that the ops are shared with the CPU ops above (when
+    // possible) so they use the same dynamic properties.
+    mutable std::atomic<bool> m_profilingEnabled{ false };
+    ConstOpCPURcPtr    m_profiledInBitDepthOp;
+    ConstOpCPURcPtrVec m_profiledCpuOps;
+    ConstOpCPURcPtr    m_profiledOutBitDepthOp;
+    // The bit-depth conversions recording their statistics as the packing and unpacking of
+    // the packed RGB 32-bit float images.
+    ConstOpCPURcPtr    m_profiledPackOp;
+    ConstOpCPURcPtr    m_profiledUnpackOp;
+
+    std::vector<std::unique_ptr<CPUOpProfile>> m_opProfiles;
+    mutable CPUProfileStatistics m_packStatistics;
+    mutable CPUProfileStatistics m_unpackStatistics;
+
+    // The scanline helpers (and their intermediate buffers) not currently used by an apply
+    // call. Keeping them alive avoids any allocation in the steady-state apply path.
+    mutable std::vector<std::unique_ptr<ScanlineHelper>> m_scanlineHelpers;
+    mutable Mutex      m_scanlineHelpersMutex;
 };
 
 } // namespace OCIO_NAMESPACE
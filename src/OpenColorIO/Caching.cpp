@@ -5,6 +5,8 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "GPUProcessor.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "transforms/CDLTransform.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
@@ -16,6 +18,7 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_PROCESSOR_DISK_CACHE_DIR = "OCIO_PROCESSOR_DISK_CACHE_DIR";
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -25,5 +28,7 @@ void ClearAllCaches()
 {
     ClearPathCaches();
     ClearFileTransformCaches();
+    ClearLut3DInverseCaches();
+    ClearGpuShaderCaches();
 }
 } // namespace OCIO_NAMESPACE
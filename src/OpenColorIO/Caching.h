@@ -6,6 +6,7 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <list>
 #include <map>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -21,6 +22,10 @@ namespace OCIO_NAMESPACE
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
 // of its length & where changes occur (e.g. absolute filepaths are inefficient). 
+//
+// The cache is unbounded by default. An optional capacity, in number of entries and/or in
+// estimated bytes, evicts the least recently used entries. As entries are usually shared pointers,
+// an evicted entry stays alive as long as a caller still holds it.
 template<typename KeyType, typename EntryType>
 class GenericCache
 {
@@ -47,6 +52,10 @@ public:
         AutoMutex lock(m_mutex);
 
         m_entries.clear();
+        m_usages.clear();
+        m_lru.clear();
+        m_stats.m_numEntries = 0;
+        m_stats.m_numBytes   = 0;
     }
 
     inline void enable(bool enable) noexcept
@@ -58,6 +67,25 @@ public:
 
     inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
 
+    // Set the maximum number of entries and the maximum number of (estimated) bytes of the cache,
+    // zero meaning unlimited. The least recently used entries are evicted if needed.
+    void setCapacity(size_t maxEntries, size_t maxBytes) noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        m_stats.m_maxEntries = maxEntries;
+        m_stats.m_maxBytes   = maxBytes;
+
+        evict();
+    }
+
+    CacheStatistics getStatistics() const noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        return m_stats;
+    }
+
     // Get and lock the mutex before accessing to a cache entry.
     Mutex & lock() noexcept { return m_mutex; }
 
@@ -68,12 +96,55 @@ public:
         return isEnabled() && m_entries.end() != m_entries.find(key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
+    // Get a cache entry. It creates the cache entry if not existing, which could evict the least
+    // recently used entries (i.e. any previously returned reference is then invalid).
     // To only use when lock is on to protect the cache access.
     EntryType & operator[](const KeyType & key) noexcept
     {
         static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        if (!isEnabled())
+        {
+            return dummy;
+        }
+
+        auto usage = m_usages.find(key);
+        if (usage != m_usages.end())
+        {
+            ++m_stats.m_numHits;
+
+            // Move the entry to the front of the LRU list.
+            m_lru.splice(m_lru.begin(), m_lru, usage->second.m_lruPos);
+            return m_entries[key];
+        }
+
+        ++m_stats.m_numMisses;
+
+        m_lru.push_front(key);
+        m_usages[key] = Usage{ m_lru.begin(), DefaultEntrySize };
+        m_stats.m_numBytes += DefaultEntrySize;
+        ++m_stats.m_numEntries;
+
+        EntryType & entry = m_entries[key];
+
+        evict();
+
+        return entry;
+    }
+
+    // Set the estimated memory footprint of an existing entry (i.e. by default an entry only
+    // accounts for the size of its key & value types). Entries in excess are then evicted.
+    // To only use when lock is on to protect the cache access.
+    void setEntrySize(const KeyType & key, size_t numBytes) noexcept
+    {
+        auto usage = m_usages.find(key);
+        if (usage != m_usages.end())
+        {
+            m_stats.m_numBytes -= usage->second.m_numBytes;
+            m_stats.m_numBytes += numBytes;
+            usage->second.m_numBytes = numBytes;
+
+            evict();
+        }
     }
 
     Iterator begin() noexcept { return m_entries.begin(); }
@@ -89,8 +160,43 @@ protected:
     bool m_enabled = true;
 
 private:
-    Mutex m_mutex;
+    static constexpr size_t DefaultEntrySize = sizeof(KeyType) + sizeof(EntryType);
+
+    // Evict the least recently used entries in excess. The most recently used entry is always
+    // kept even if it alone exceeds the capacity.
+    void evict() noexcept
+    {
+        while (m_lru.size() > 1
+               && ((m_stats.m_maxEntries > 0 && m_stats.m_numEntries > m_stats.m_maxEntries)
+                   || (m_stats.m_maxBytes > 0 && m_stats.m_numBytes > m_stats.m_maxBytes)))
+        {
+            const KeyType & key = m_lru.back();
+
+            auto usage = m_usages.find(key);
+            m_stats.m_numBytes -= usage->second.m_numBytes;
+            --m_stats.m_numEntries;
+            ++m_stats.m_numEvictions;
+
+            m_entries.erase(key);
+            m_usages.erase(usage);
+            m_lru.pop_back();
+        }
+    }
+
+    struct Usage
+    {
+        typename std::list<KeyType>::iterator m_lruPos;
+        size_t m_numBytes;
+    };
+
+    mutable Mutex m_mutex;
     Entries m_entries;
+
+    // The most recently used keys are at the front of the list.
+    std::list<KeyType> m_lru;
+    std::map<KeyType, Usage> m_usages;
+
+    CacheStatistics m_stats;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
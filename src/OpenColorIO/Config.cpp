@@ -252,6 +252,22 @@ static const unsigned int LastSupportedMinorVersion[] = {0, // Version 1
 
 } // namespace
 
+// The processor cache mutexes both the map and each entry individually so that a slow
+// processor creation (e.g. LUT file loading) does not block the lookups of the other entries.
+// Only the creation of the *same* processor is serialized.
+
+struct ProcessorCacheEntry
+{
+    Mutex mutex;
+    // Written under both mutexes (i.e. the entry one & the cache one) so it could be read
+    // under any of them.
+    ProcessorRcPtr processor;
+
+    ProcessorCacheEntry() = default;
+};
+
+typedef OCIO_SHARED_PTR<ProcessorCacheEntry> ProcessorCacheEntryRcPtr;
+
 class Config::Impl
 {
 public:
@@ -330,7 +346,7 @@ public:
     FileRulesRcPtr m_fileRules;
 
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
-    mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    mutable ProcessorCache<std::size_t, ProcessorCacheEntryRcPtr> m_processorCache;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -452,6 +468,9 @@ public:
 
             m_processorCache.clear();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+
+            const CacheStatistics stats = rhs.m_processorCache.getStatistics();
+            m_processorCache.setCapacity(stats.m_maxEntries, stats.m_maxBytes);
         }
         return *this;
     }
@@ -1109,7 +1128,7 @@ public:
 
 
 // Instantiate the cache with the right types.
-extern template class ProcessorCache<std::size_t, ProcessorRcPtr>;
+template class ProcessorCache<std::size_t, ProcessorCacheEntryRcPtr>;
 
 
 ///////////////////////////////////////////////////////////////////////////
@@ -4664,6 +4683,18 @@ bool Config::filepathOnlyMatchesDefaultRule(const char * filePath) const
                                                                              filePath ? filePath : "");
 }
 
+void Config::getColorSpacesFromFilepaths(const char * const * filePaths,
+                                         size_t numFilePaths,
+                                         const char ** colorSpaces,
+                                         size_t * ruleIndices) const
+{
+    getImpl()->m_fileRules->getImpl()->getColorSpacesFromFilepaths(*this,
+                                                                   filePaths,
+                                                                   numFilePaths,
+                                                                   colorSpaces,
+                                                                   ruleIndices);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 //  GetProcessor
@@ -4821,8 +4852,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -4832,13 +4861,32 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // Only hold the cache mutex to find or create the entry.
+        ProcessorCacheEntryRcPtr entry;
+        {
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+
+            // As the entry is a shared pointer instance, having an empty one means that the entry
+            // does not exist in the cache. So, it provides a fast existence check & access in one
+            // call.
+            ProcessorCacheEntryRcPtr & cacheEntry = getImpl()->m_processorCache[key];
+            if (!cacheEntry)
+            {
+                cacheEntry = std::make_shared<ProcessorCacheEntry>();
+            }
+            entry = cacheEntry;
+        }
+
+        // Other threads requesting the same processor wait here until it is created, the ones
+        // requesting different processors are not blocked.
+        AutoMutex lock(entry->mutex);
+        if (!entry->processor)
         {
+            // In case of failure the entry stays empty so the next request tries again.
             ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
 
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
             {
@@ -4854,23 +4902,29 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                 // compare the two contexts before doing the lengthy Processor::getCacheID()
                 // computation.
 
-                for (auto & entry : getImpl()->m_processorCache)
+                for (auto & cacheEntry : getImpl()->m_processorCache)
                 {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
+                    if (cacheEntry.second && cacheEntry.second->processor
+                        && 0 == strcmp(cacheEntry.second->processor->getCacheID(),
+                                       proc->getCacheID()))
                     {
-                        processor = entry.second;
+                        entry->processor = cacheEntry.second->processor;
                         break;
                     }
                 }
             }
 
-            if (!processor)
+            if (!entry->processor)
             {
-                processor = proc;
+                entry->processor = proc;
+
+                // Note that a reused processor keeps the default size as its memory is already
+                // accounted for by the other entry.
+                getImpl()->m_processorCache.setEntrySize(key, proc->getImpl()->getMemorySize());
             }
         }
 
-        return processor;
+        return entry->processor;
     }
     else
     {
@@ -5337,6 +5391,16 @@ void Config::clearProcessorCache() noexcept
     getImpl()->m_processorCache.clear();
 }
 
+void Config::setProcessorCacheCapacity(size_t maxEntries, size_t maxBytes) const noexcept
+{
+    getImpl()->m_processorCache.setCapacity(maxEntries, maxBytes);
+}
+
+CacheStatistics Config::getProcessorCacheStatistics() const noexcept
+{
+    return getImpl()->m_processorCache.getStatistics();
+}
+
 ///////////////////////////////////////////////////////////////////////////
 //  Config::Impl
 
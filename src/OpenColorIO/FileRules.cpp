@@ -260,7 +260,8 @@ std::string BuildRegularExpression(const char * filePathPattern, const char * fi
     return res;
 }
 
-void ValidateRegularExpression(const char * regex)
+// Throws an exception if the expression is ill-formed.
+std::regex CompileRegularExpression(const char * regex)
 {
     if (!regex || !*regex)
     {
@@ -269,8 +270,7 @@ void ValidateRegularExpression(const char * regex)
 
     try
     {
-        // Throws an exception if the expression is ill-formed.
-        const std::regex reg(regex);
+        return std::regex(regex);
     }
     catch (std::regex_error & ex)
     {
@@ -284,10 +284,69 @@ void ValidateRegularExpression(const char * regex)
     }
 }
 
-void ValidateRegularExpression(const char * filePathPattern, const char * fileNameExtension)
+std::regex CompileRegularExpression(const char * filePathPattern, const char * fileNameExtension)
 {
     const std::string exp = BuildRegularExpression(filePathPattern, fileNameExtension);
-    ValidateRegularExpression(exp.c_str());
+    return CompileRegularExpression(exp.c_str());
+}
+
+// Is the glob character converted to a regular expression construct (refer to
+// ConvertToRegularExpression()) i.e. not matching itself?
+inline bool IsGlobSpecialCharacter(char c)
+{
+    return c == '*' || c == '?' || c == '[' || c == ']' || c == '\\';
+}
+
+// Get the literal start of the glob pattern (i.e. before any special character) that all the
+// matching file paths start with.
+std::string GetGlobLiteralPrefix(const std::string & globPattern)
+{
+    size_t idx = 0;
+    while (idx < globPattern.size() && !IsGlobSpecialCharacter(globPattern[idx]))
+    {
+        ++idx;
+    }
+    return globPattern.substr(0, idx);
+}
+
+// Get the lower case extension that all the matching file paths end with (i.e. case
+// insensitive), or an empty string if the extension glob pattern is not a literal.
+std::string GetGlobLiteralExtension(const std::string & globExtension)
+{
+    for (char c : globExtension)
+    {
+        if (IsGlobSpecialCharacter(c))
+        {
+            return "";
+        }
+    }
+    return StringUtils::Lower(globExtension);
+}
+
+// Case insensitive check of the file path extension where the extension is in lower case.
+bool EndsWithExtension(const char * path, size_t pathLength, const std::string & extension)
+{
+    // The extension also needs the dot.
+    if (pathLength < extension.size() + 1)
+    {
+        return false;
+    }
+
+    const char * pathExtension = path + pathLength - extension.size();
+    if (pathExtension[-1] != '.')
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; idx < extension.size(); ++idx)
+    {
+        if (StringUtils::Lower(static_cast<unsigned char>(pathExtension[idx])) 
+                != static_cast<unsigned char>(extension[idx]))
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 }
@@ -329,6 +388,8 @@ public:
             m_pattern   = "*";
             m_extension = "*";
             m_type      = FILE_RULE_GLOB;
+
+            m_compiledRegex = CompileRegularExpression(m_pattern.c_str(), m_extension.c_str());
         }
     }
 
@@ -343,6 +404,10 @@ public:
         rule->m_regex      = m_regex;
         rule->m_type       = m_type;
 
+        rule->m_compiledRegex    = m_compiledRegex;
+        rule->m_literalPrefix    = m_literalPrefix;
+        rule->m_literalExtension = m_literalExtension;
+
         return rule;
     }
 
@@ -376,10 +441,11 @@ public:
             {
                 throw Exception("File rules: The file name pattern is empty.");
             }
-            ValidateRegularExpression(pattern, m_extension.c_str());
+            m_compiledRegex = CompileRegularExpression(pattern, m_extension.c_str());
             m_pattern = pattern;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            updateLiterals();
         }
     }
 
@@ -408,10 +474,11 @@ public:
             {
                 throw Exception("File rules: The file extension pattern is empty.");
             }
-            ValidateRegularExpression(m_pattern.c_str(), extension);
+            m_compiledRegex = CompileRegularExpression(m_pattern.c_str(), extension);
             m_extension = extension;
             m_regex = "";
             m_type = FILE_RULE_GLOB;
+            updateLiterals();
         }
     }
 
@@ -436,11 +503,12 @@ public:
         }
         else
         {
-            ValidateRegularExpression(regex);
+            m_compiledRegex = CompileRegularExpression(regex);
             m_regex = regex;
             m_pattern = "";
             m_extension = "";
             m_type = FILE_RULE_REGEX;
+            updateLiterals();
         }
     }
 
@@ -469,38 +537,49 @@ public:
         }
     }
 
-    bool matches(const Config & config, const char * path) const
+    // Return the color space if the rule matches the file path, or null otherwise. Note that
+    // the path search rule returns the color space name found in the file path.
+    const char * match(const Config & config, const char * path, size_t pathLength) const
     {
         switch (m_type)
         {
         case FILE_RULE_DEFAULT:
-            return true;
+            return m_colorSpace.c_str();
         case FILE_RULE_PARSE_FILEPATH:
         {
             const int rightMostColorSpaceIndex = ParseColorSpaceFromString(config, path);
             if (rightMostColorSpaceIndex >= 0)
             {
-                m_colorSpace = config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL,
-                                                               COLORSPACE_ALL,
-                                                               rightMostColorSpaceIndex);
-                return true;
+                return config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL,
+                                                       COLORSPACE_ALL,
+                                                       rightMostColorSpaceIndex);
             }
-            return false;
+            return nullptr;
         }
         case FILE_RULE_REGEX:
         {
-            const std::regex reg(m_regex.c_str());
-            return regex_match(path, reg);
+            return std::regex_match(path, m_compiledRegex) ? m_colorSpace.c_str() : nullptr;
         }
         case FILE_RULE_GLOB:
         {
-            const std::string exp = BuildRegularExpression(m_pattern.c_str(),
-                                                           m_extension.c_str());
-            const std::regex reg(exp.c_str());
-            return regex_match(path, reg);
+            // Quickly reject the file paths not having the literal start or extension of
+            // the glob patterns before using the regular expression.
+            if (!m_literalPrefix.empty()
+                && (pathLength < m_literalPrefix.size()
+                    || 0 != std::strncmp(path, m_literalPrefix.c_str(), m_literalPrefix.size())))
+            {
+                return nullptr;
+            }
+            if (!m_literalExtension.empty()
+                && !EndsWithExtension(path, pathLength, m_literalExtension))
+            {
+                return nullptr;
+            }
+
+            return std::regex_match(path, m_compiledRegex) ? m_colorSpace.c_str() : nullptr;
         }
         }
-        return false;
+        return nullptr;
     }
 
     void validate(const Config & cfg) const
@@ -526,12 +605,32 @@ public:
 
 private:
 
+    void updateLiterals()
+    {
+        if (m_type == FILE_RULE_GLOB)
+        {
+            m_literalPrefix    = GetGlobLiteralPrefix(m_pattern);
+            m_literalExtension = GetGlobLiteralExtension(m_extension);
+        }
+        else
+        {
+            m_literalPrefix.clear();
+            m_literalExtension.clear();
+        }
+    }
+
     std::string m_name;
-    mutable std::string m_colorSpace;
+    std::string m_colorSpace;
     std::string m_pattern;
     std::string m_extension;
     std::string m_regex;
     RuleType m_type{ FILE_RULE_GLOB };
+
+    // The regular expression is compiled once when the rule changes. The glob rules also
+    // keep the literal start and extension that the matching file paths must have.
+    std::regex m_compiledRegex;
+    std::string m_literalPrefix;
+    std::string m_literalExtension;
 };
 
 FileRules::FileRules()
@@ -632,13 +731,16 @@ void FileRules::Impl::validateNewRule(size_t ruleIndex, const char * name) const
 const char * FileRules::Impl::getRuleFromFilepath(const Config & config, const char * filePath,
                                                   size_t & ruleIndex) const
 {
+    const size_t pathLength = std::strlen(filePath);
+
     const auto numRules = m_rules.size();
     for (size_t i = 0; i < numRules; ++i)
     {
-        if (m_rules[i]->matches(config, filePath))
+        const char * colorSpace = m_rules[i]->match(config, filePath, pathLength);
+        if (colorSpace)
         {
             ruleIndex = i;
-            return m_rules[i]->getColorSpace();
+            return colorSpace;
         }
     }
     // Should not be reached since the default rule always matches.
@@ -907,6 +1009,40 @@ bool FileRules::Impl::filepathOnlyMatchesDefaultRule(const Config & config, cons
     return (rulePos + 1) == m_rules.size();
 }
 
+void FileRules::Impl::getColorSpacesFromFilepaths(const Config & config,
+                                                  const char * const * filePaths,
+                                                  size_t numFilePaths,
+                                                  const char ** colorSpaces,
+                                                  size_t * ruleIndices) const
+{
+    if (numFilePaths == 0)
+    {
+        return;
+    }
+
+    if (!filePaths)
+    {
+        throw Exception("File rules: the list of file paths is null.");
+    }
+
+    if (!colorSpaces)
+    {
+        throw Exception("File rules: the list of color spaces is null.");
+    }
+
+    for (size_t idx = 0; idx < numFilePaths; ++idx)
+    {
+        size_t ruleIndex = 0;
+        colorSpaces[idx] = getRuleFromFilepath(config,
+                                               filePaths[idx] ? filePaths[idx] : "",
+                                               ruleIndex);
+        if (ruleIndices)
+        {
+            ruleIndices[idx] = ruleIndex;
+        }
+    }
+}
+
 std::ostream & operator<< (std::ostream & os, const FileRules & fr)
 {
     const size_t numRules = fr.getNumEntries();
@@ -59,6 +59,13 @@ public:
 
     bool filepathOnlyMatchesDefaultRule(const Config & config, const char * filePath) const;
 
+    // Classify a list of file paths in one call. The rule indices are optional.
+    void getColorSpacesFromFilepaths(const Config & config,
+                                     const char * const * filePaths,
+                                     size_t numFilePaths,
+                                     const char ** colorSpaces,
+                                     size_t * ruleIndices) const;
+
     void validate(const Config & cfg) const;
 
 private:
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
 #include "GPUProcessor.h"
 #include "GpuShader.h"
 #include "GpuShaderUtils.h"
@@ -67,7 +68,94 @@ void WriteShaderFooter(GpuShaderCreatorRcPtr & shaderCreator)
     shaderCreator->addToFunctionFooterShaderCode(ss.string().c_str());
 }
 
+struct ShaderCacheEntry
+{
+    Mutex m_mutex;
+    GpuShaderDescRcPtr m_shaderDesc;
+};
+
+typedef OCIO_SHARED_PTR<ShaderCacheEntry> ShaderCacheEntryRcPtr;
+
+// The shader program information (i.e. shader text and textures) of the same processor is shared
+// by all the shader descriptions having the same parameters (e.g. a review service building the
+// shaders of the same color transformations for many sessions). An entry holds its textures
+// (i.e. about 3.3 MB for a 65 grid size 3D LUT), so the cache is bounded in bytes as well as in
+// entries.
+class ShaderCache : public GenericCache<std::string, ShaderCacheEntryRcPtr>
+{
+public:
+    ShaderCache()
+    {
+        setCapacity(MaxEntries, MaxBytes);
+    }
+
+    static constexpr size_t MaxEntries = 64;
+    static constexpr size_t MaxBytes   = 128 * 1024 * 1024;
+};
+
+ShaderCache g_shaderCache;
+
+std::string GetShaderCacheKey(const GpuShaderDesc & shaderDesc, const std::string & processorID)
+{
+    std::ostringstream oss;
+    oss << shaderDesc.getCacheID()
+        << " uid " << shaderDesc.getUniqueID()
+        << " width " << shaderDesc.getTextureMaxWidth()
+        << " 1D " << shaderDesc.getAllowTexture1D()
+        << " set " << shaderDesc.getDescriptorSetIndex()
+        << " binding " << shaderDesc.getTextureBindingStart()
+        << " " << processorID;
+    return oss.str();
+}
+
+size_t GetShaderDescSize(const GpuShaderDesc & shaderDesc)
+{
+    size_t numBytes = std::strlen(shaderDesc.getShaderText());
+
+    for (unsigned idx = 0; idx < shaderDesc.getNumTextures(); ++idx)
+    {
+        const char * textureName = nullptr;
+        const char * samplerName = nullptr;
+        unsigned width = 0, height = 0;
+        GpuShaderDesc::TextureType channel = GpuShaderDesc::TEXTURE_RGB_CHANNEL;
+        GpuShaderDesc::TextureDimensions dimensions = GpuShaderDesc::TEXTURE_1D;
+        Interpolation interpolation = INTERP_LINEAR;
+        shaderDesc.getTexture(idx, textureName, samplerName, width, height,
+                              channel, dimensions, interpolation);
+
+        numBytes += width * height * (channel == GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1)
+                    * sizeof(float);
+    }
+
+    for (unsigned idx = 0; idx < shaderDesc.getNum3DTextures(); ++idx)
+    {
+        const char * textureName = nullptr;
+        const char * samplerName = nullptr;
+        unsigned edgelen = 0;
+        Interpolation interpolation = INTERP_LINEAR;
+        shaderDesc.get3DTexture(idx, textureName, samplerName, edgelen, interpolation);
+
+        numBytes += edgelen * edgelen * edgelen * 3 * sizeof(float);
+    }
+
+    return numBytes;
+}
+
+}
+
+void ClearGpuShaderCaches()
+{
+    g_shaderCache.clear();
+}
+
+void SetGpuShaderCacheCapacity(size_t maxEntries, size_t maxBytes)
+{
+    g_shaderCache.setCapacity(maxEntries, maxBytes);
+}
 
+CacheStatistics GetGpuShaderCacheStatistics()
+{
+    return g_shaderCache.getStatistics();
 }
 
 void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags)
@@ -101,6 +189,57 @@ void GPUProcessor::Impl::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCrea
 {
     AutoMutex lock(m_mutex);
 
+    // Only the processors without dynamic properties (i.e. no uniforms) extracted in a new shader
+    // description from the library use the shader cache, as the custom shader creators could
+    // rely on their own methods being called.
+
+    GenericGpuShaderDescRcPtr shaderDesc = DynamicPtrCast<GenericGpuShaderDesc>(shaderCreator);
+
+    ShaderCacheEntryRcPtr entry;
+    std::string key;
+    if (shaderDesc && !m_ops.isDynamic() && shaderDesc->isEmpty())
+    {
+        AutoMutex guard(g_shaderCache.lock());
+
+        if (g_shaderCache.isEnabled())
+        {
+            key = GetShaderCacheKey(*shaderDesc, m_cacheID);
+
+            ShaderCacheEntryRcPtr & cacheEntry = g_shaderCache[key];
+            if (!cacheEntry)
+            {
+                cacheEntry = std::make_shared<ShaderCacheEntry>();
+            }
+            entry = cacheEntry;
+        }
+    }
+
+    if (!entry)
+    {
+        createShaderInfo(shaderCreator);
+        return;
+    }
+
+    AutoMutex entryLock(entry->m_mutex);
+
+    if (entry->m_shaderDesc)
+    {
+        shaderDesc->copyShaderInfo(*DynamicPtrCast<GenericGpuShaderDesc>(entry->m_shaderDesc));
+        return;
+    }
+
+    createShaderInfo(shaderCreator);
+
+    GpuShaderDescRcPtr cachedDesc = GenericGpuShaderDesc::Create();
+    DynamicPtrCast<GenericGpuShaderDesc>(cachedDesc)->copyShaderInfo(*shaderDesc);
+    entry->m_shaderDesc = cachedDesc;
+
+    AutoMutex guard(g_shaderCache.lock());
+    g_shaderCache.setEntrySize(key, GetShaderDescSize(*shaderDesc));
+}
+
+void GPUProcessor::Impl::createShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
+{
     // Create the shader program information.
     for(const auto & op : m_ops)
     {
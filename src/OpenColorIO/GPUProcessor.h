@@ -38,6 +38,9 @@ public:
     void finalize(const OpRcPtrVec & rawOps, OptimizationFlags oFlags);
 
 private:
+    // Extract the shader program information from the ops i.e. without the shader cache.
+    void createShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const;
+
     OpRcPtrVec    m_ops;
     bool          m_isNoOp = false;
     bool          m_hasChannelCrosstalk = true;
@@ -46,6 +49,9 @@ private:
 };
 
 
+// Clear the cache of shader program information shared between the shader descriptions.
+void ClearGpuShaderCaches();
+
 } // namespace OCIO_NAMESPACE
 
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -20,10 +21,9 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
-static void  CreateArray(const float * buf,
-                         unsigned w, unsigned h, unsigned d,
-                         GpuShaderDesc::TextureType type,
-                         std::vector<float> & res)
+static std::shared_ptr<const std::vector<float>> CreateArray(const float * buf,
+                                                             unsigned w, unsigned h, unsigned d,
+                                                             GpuShaderDesc::TextureType type)
 {
     if(buf==nullptr)
     {
@@ -32,8 +32,7 @@ static void  CreateArray(const float * buf,
 
     const size_t size
         = w * h * d * (type==GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1);
-    res.resize(size);
-    std::memcpy(&res[0], buf, size * sizeof(float));
+    return std::make_shared<const std::vector<float>>(buf, buf + size);
 }
 
 std::size_t alignOffset(std::size_t offset, std::size_t alignment)
@@ -102,7 +101,7 @@ public:
             // An unfortunate copy is mandatory to allow the creation of a GPU shader cache.
             // The cache needs a decoupling of the processor and shader instances forbidding
             // shared naked pointer usage.
-            CreateArray(v, m_width, m_height, m_depth, m_type, m_values);
+            m_values = CreateArray(v, m_width, m_height, m_depth, m_type);
         }
 
         std::string m_textureName;
@@ -114,7 +113,8 @@ public:
         unsigned m_dimensions;
         Interpolation m_interp;
 
-        std::vector<float> m_values;
+        // Shared by the copies of the texture (e.g. the GPU shader cache).
+        std::shared_ptr<const std::vector<float>> m_values;
 
         Texture() = delete;
     };
@@ -265,7 +265,7 @@ public:
         }
 
         const Texture & t = m_textures[index];
-        values   = &t.m_values[0];
+        values   = t.m_values->data();
     }
 
     unsigned add3DTexture(const char * textureName,
@@ -322,7 +322,7 @@ public:
         }
 
         const Texture & t = m_textures3D[index];
-        values = &t.m_values[0];
+        values = t.m_values->data();
     }
 
     unsigned getNumUniforms() const
@@ -591,6 +591,51 @@ void GenericGpuShaderDesc::get3DTextureValues(unsigned index, const float *& val
     getImplGeneric()->get3DTextureValues(index, values);
 }
 
+bool GenericGpuShaderDesc::isEmpty() const noexcept
+{
+    const GpuShaderCreator::Impl * impl = getImpl();
+
+    return impl->m_parameterDeclarations.empty()
+           && impl->m_textureDeclarations.empty()
+           && impl->m_helperMethods.empty()
+           && impl->m_functionHeader.empty()
+           && impl->m_functionBody.empty()
+           && impl->m_functionFooter.empty()
+           && !impl->m_shaderCode
+           && impl->m_dynamicProperties.empty()
+           && getImplGeneric()->m_textures.empty()
+           && getImplGeneric()->m_textures3D.empty()
+           && getImplGeneric()->m_uniforms.empty();
+}
+
+void GenericGpuShaderDesc::copyShaderInfo(const GenericGpuShaderDesc & other)
+{
+    GpuShaderCreator::Impl * impl = getImpl();
+    const GpuShaderCreator::Impl * otherImpl = other.getImpl();
+
+    AutoMutex lock(impl->m_cacheIDMutex);
+
+    impl->m_numResources = otherImpl->m_numResources;
+
+    impl->m_parameterDeclarations = otherImpl->m_parameterDeclarations;
+    impl->m_textureDeclarations   = otherImpl->m_textureDeclarations;
+    impl->m_helperMethods         = otherImpl->m_helperMethods;
+    impl->m_functionHeader        = otherImpl->m_functionHeader;
+    impl->m_functionBody          = otherImpl->m_functionBody;
+    impl->m_functionFooter        = otherImpl->m_functionFooter;
+
+    impl->m_classWrappingInterface = otherImpl->m_classWrappingInterface->clone();
+
+    impl->m_shaderCode   = otherImpl->m_shaderCode;
+    impl->m_shaderCodeID = otherImpl->m_shaderCodeID;
+
+    impl->m_cacheID.clear();
+
+    // The texture copies share the values.
+    getImplGeneric()->m_textures   = other.getImplGeneric()->m_textures;
+    getImplGeneric()->m_textures3D = other.getImplGeneric()->m_textures3D;
+}
+
 void GenericGpuShaderDesc::Deleter(GenericGpuShaderDesc* c)
 {
     delete c;
@@ -5,12 +5,94 @@
 #define INCLUDED_OCIO_GPU_SHADER_H
 
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "GpuShaderClassWrapper.h"
+#include "Mutex.h"
+
 
 namespace OCIO_NAMESPACE
 {
 
+class GpuShaderCreator::Impl
+{
+public:
+    std::string m_uid; // Custom uid if needed.
+    GpuLanguage m_language = GPU_LANGUAGE_GLSL_1_2;
+    std::string m_functionName;
+    std::string m_resourcePrefix;
+    std::string m_pixelName;
+    unsigned m_numResources = 0;
+
+    mutable std::string m_cacheID;
+    mutable Mutex m_cacheIDMutex;
+
+    std::string m_parameterDeclarations;
+    std::string m_textureDeclarations;
+    std::string m_helperMethods;
+    std::string m_functionHeader;
+    std::string m_functionBody;
+    std::string m_functionFooter;
+
+    // The complete shader program, shared by the shader descriptions coming from the GPU shader
+    // cache (refer to GPUProcessor.cpp).
+    std::shared_ptr<const std::string> m_shaderCode;
+    std::string m_shaderCodeID;
+
+    std::vector<DynamicPropertyRcPtr> m_dynamicProperties;
+    
+    std::unique_ptr<GpuShaderClassWrapper> m_classWrappingInterface;
+
+    unsigned m_descriptorSetIndex = 0;
+    unsigned m_textureBindingStart = 1;
+
+    Impl()
+        :   m_functionName("OCIOMain")
+        ,   m_resourcePrefix("ocio")
+        ,   m_pixelName("outColor")
+        ,   m_classWrappingInterface(GpuShaderClassWrapper::CreateClassWrapper(m_language))
+    {
+    }
+
+    ~Impl() = default;
+
+    Impl(const Impl & rhs) = delete;
+
+    Impl& operator= (const Impl & rhs)
+    {
+        if (this != &rhs)
+        {
+            m_uid            = rhs.m_uid;
+            m_language       = rhs.m_language;
+            m_functionName   = rhs.m_functionName;
+            m_resourcePrefix = rhs.m_resourcePrefix;
+            m_pixelName      = rhs.m_pixelName;
+            m_numResources   = rhs.m_numResources;
+            m_cacheID        = rhs.m_cacheID;
+
+            m_parameterDeclarations = rhs.m_parameterDeclarations;
+            m_textureDeclarations   = rhs.m_textureDeclarations;
+            m_helperMethods         = rhs.m_helperMethods;
+            m_functionHeader        = rhs.m_functionHeader;
+            m_functionBody          = rhs.m_functionBody;
+            m_functionFooter        = rhs.m_functionFooter;
+            
+            m_classWrappingInterface = rhs.m_classWrappingInterface->clone();
+
+            m_descriptorSetIndex = rhs.m_descriptorSetIndex;
+            m_textureBindingStart = rhs.m_textureBindingStart;
+
+            m_shaderCode = nullptr;
+            m_shaderCodeID.clear();
+        }
+        return *this;
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////
 
 // GenericGpuShaderDesc
@@ -83,6 +165,15 @@ public:
                       Interpolation & interpolation) const override;
     void get3DTextureValues(unsigned index, const float *& value) const override;
 
+    // True if nothing was extracted yet in the shader description i.e. no shader code, textures,
+    // uniforms or dynamic properties.
+    bool isEmpty() const noexcept;
+
+    // Copy the shader program information (i.e. the shader code, the textures and the number of
+    // resources) of another shader description. The shader text and the texture values are
+    // shared, not copied. Note that the uniforms and the dynamic properties are not copied.
+    void copyShaderInfo(const GenericGpuShaderDesc & other);
+
 private:
 
     GenericGpuShaderDesc();
@@ -100,6 +191,8 @@ private:
     const ImplGeneric * getImplGeneric() const { return m_implGeneric; }
 };
 
+typedef OCIO_SHARED_PTR<GenericGpuShaderDesc> GenericGpuShaderDescRcPtr;
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -9,89 +9,14 @@
 #include "DynamicProperty.h"
 #include "GpuShader.h"
 #include "GpuShaderUtils.h"
-#include "GpuShaderClassWrapper.h"
 #include "HashUtils.h"
 #include "Logging.h"
-#include "Mutex.h"
 #include "utils/StringUtils.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
-class GpuShaderCreator::Impl
-{
-public:
-    std::string m_uid; // Custom uid if needed.
-    GpuLanguage m_language = GPU_LANGUAGE_GLSL_1_2;
-    std::string m_functionName;
-    std::string m_resourcePrefix;
-    std::string m_pixelName;
-    unsigned m_numResources = 0;
-
-    mutable std::string m_cacheID;
-    mutable Mutex m_cacheIDMutex;
-
-    std::string m_parameterDeclarations;
-    std::string m_textureDeclarations;
-    std::string m_helperMethods;
-    std::string m_functionHeader;
-    std::string m_functionBody;
-    std::string m_functionFooter;
-
-    std::string m_shaderCode;
-    std::string m_shaderCodeID;
-
-    std::vector<DynamicPropertyRcPtr> m_dynamicProperties;
-    
-    std::unique_ptr<GpuShaderClassWrapper> m_classWrappingInterface;
-
-    unsigned m_descriptorSetIndex = 0;
-    unsigned m_textureBindingStart = 1;
-
-    Impl()
-        :   m_functionName("OCIOMain")
-        ,   m_resourcePrefix("ocio")
-        ,   m_pixelName("outColor")
-        ,   m_classWrappingInterface(GpuShaderClassWrapper::CreateClassWrapper(m_language))
-    {
-    }
-
-    ~Impl() = default;
-
-    Impl(const Impl & rhs) = delete;
-
-    Impl& operator= (const Impl & rhs)
-    {
-        if (this != &rhs)
-        {
-            m_uid            = rhs.m_uid;
-            m_language       = rhs.m_language;
-            m_functionName   = rhs.m_functionName;
-            m_resourcePrefix = rhs.m_resourcePrefix;
-            m_pixelName      = rhs.m_pixelName;
-            m_numResources   = rhs.m_numResources;
-            m_cacheID        = rhs.m_cacheID;
-
-            m_parameterDeclarations = rhs.m_parameterDeclarations;
-            m_textureDeclarations   = rhs.m_textureDeclarations;
-            m_helperMethods         = rhs.m_helperMethods;
-            m_functionHeader        = rhs.m_functionHeader;
-            m_functionBody          = rhs.m_functionBody;
-            m_functionFooter        = rhs.m_functionFooter;
-            
-            m_classWrappingInterface = rhs.m_classWrappingInterface->clone();
-
-            m_descriptorSetIndex = rhs.m_descriptorSetIndex;
-            m_textureBindingStart = rhs.m_textureBindingStart;
-
-            m_shaderCode.clear();
-            m_shaderCodeID.clear();
-        }
-        return *this;
-    }
-};
-
 GpuShaderCreator::GpuShaderCreator()
     :   m_impl(new GpuShaderDesc::Impl)
 {
@@ -328,28 +253,28 @@ void GpuShaderCreator::createShaderText(const char * shaderParameterDeclarations
 {
     AutoMutex lock(getImpl()->m_cacheIDMutex);
 
-    getImpl()->m_shaderCode.clear();
+    std::string shaderCode;
 
     if (getImpl()->m_language == GPU_LANGUAGE_GLSL_VK_4_6 && (shaderParameterDeclarations && *shaderParameterDeclarations))
     {
-        getImpl()->m_shaderCode += "layout (set = "+std::to_string(getImpl()->m_descriptorSetIndex) +
-                                   ", binding = 0) uniform " +
-                                   getImpl()->m_functionName + "_Parameters\n{\n";
+        shaderCode += "layout (set = "+std::to_string(getImpl()->m_descriptorSetIndex) +
+                      ", binding = 0) uniform " +
+                      getImpl()->m_functionName + "_Parameters\n{\n";
     }
-    getImpl()->m_shaderCode += (shaderParameterDeclarations && *shaderParameterDeclarations) ? shaderParameterDeclarations : "";
+    shaderCode += (shaderParameterDeclarations && *shaderParameterDeclarations) ? shaderParameterDeclarations : "";
     if (getImpl()->m_language == GPU_LANGUAGE_GLSL_VK_4_6 && (shaderParameterDeclarations && *shaderParameterDeclarations))
     {
-        getImpl()->m_shaderCode += "\n};\n";
+        shaderCode += "\n};\n";
     }
 
-    getImpl()->m_shaderCode += (shaderTextureDeclarations   && *shaderTextureDeclarations)  ? shaderTextureDeclarations : "";
-    getImpl()->m_shaderCode += (shaderHelperMethods         && *shaderHelperMethods)        ? shaderHelperMethods       : "";
-    getImpl()->m_shaderCode += (shaderFunctionHeader        && *shaderFunctionHeader)       ? shaderFunctionHeader      : "";
-    getImpl()->m_shaderCode += (shaderFunctionBody          && *shaderFunctionBody)         ? shaderFunctionBody        : "";
-    getImpl()->m_shaderCode += (shaderFunctionFooter        && *shaderFunctionFooter)       ? shaderFunctionFooter      : "";
+    shaderCode += (shaderTextureDeclarations   && *shaderTextureDeclarations)  ? shaderTextureDeclarations : "";
+    shaderCode += (shaderHelperMethods         && *shaderHelperMethods)        ? shaderHelperMethods       : "";
+    shaderCode += (shaderFunctionHeader        && *shaderFunctionHeader)       ? shaderFunctionHeader      : "";
+    shaderCode += (shaderFunctionBody          && *shaderFunctionBody)         ? shaderFunctionBody        : "";
+    shaderCode += (shaderFunctionFooter        && *shaderFunctionFooter)       ? shaderFunctionFooter      : "";
 
-    getImpl()->m_shaderCodeID = CacheIDHash(getImpl()->m_shaderCode.c_str(),
-                                            getImpl()->m_shaderCode.length());
+    getImpl()->m_shaderCodeID = CacheIDHash(shaderCode.c_str(), shaderCode.length());
+    getImpl()->m_shaderCode = std::make_shared<const std::string>(std::move(shaderCode));
 
     getImpl()->m_cacheID.clear();
 }
@@ -390,7 +315,7 @@ void GpuShaderCreator::finalize()
         oss << std::endl
             << "**" << std::endl
             << "GPU Fragment Shader program" << std::endl
-            << getImpl()->m_shaderCode << std::endl;
+            << *getImpl()->m_shaderCode << std::endl;
 
         LogDebug(oss.str());
     }
@@ -422,7 +347,7 @@ GpuShaderCreatorRcPtr GpuShaderDesc::clone() const
 
 const char * GpuShaderDesc::getShaderText() const noexcept
 {
-    return getImpl()->m_shaderCode.c_str();
+    return getImpl()->m_shaderCode ? getImpl()->m_shaderCode->c_str() : "";
 }
 
 } // namespace OCIO_NAMESPACE
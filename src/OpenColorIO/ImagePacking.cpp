@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -11,69 +12,324 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ImagePacking.h"
+#include "ImagePacking_SSE2.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
 
+// The channel layouts having a dedicated copy loop.
+enum ChannelLayout
+{
+    CHANNEL_LAYOUT_STRIDED = 0, // Any layout, each channel is accessed through its own stride.
+    CHANNEL_LAYOUT_PLANAR,      // Each channel is in its own contiguous buffer.
+    CHANNEL_LAYOUT_INTERLEAVED  // The channels of a pixel are contiguous e.g. BGRA, RGB.
+};
+
+// Find the layout of the image channels. For the interleaved layout, the pixel stride and the
+// channel offsets (from the first channel in memory) are returned in number of Type elements
+// and the offset is -1 when the channel is missing.
 template<typename Type>
-void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
-                                          Type * inBitDepthBuffer,
-                                          float * outputBuffer,
-                                          int outputBufferSize,
-                                          long imagePixelStartIndex)
+ChannelLayout GetChannelLayout(const GenericImageDesc & img,
+                               ptrdiff_t & pixelStride,
+                               ptrdiff_t (&offsets)[4],
+                               ptrdiff_t & baseOffset)
 {
-    if(outputBuffer==nullptr)
+    const ptrdiff_t typeSize = ptrdiff_t(sizeof(Type));
+    const ptrdiff_t xStrideBytes = img.m_xStrideBytes;
+
+    if (xStrideBytes == typeSize)
     {
-        throw Exception("Invalid output image buffer");
+        return CHANNEL_LAYOUT_PLANAR;
     }
 
-    const long imgWidth  = srcImg.m_width;
-    const long imgHeight = srcImg.m_height;
-    const long imgPixels = imgWidth * imgHeight;
+    if (xStrideBytes <= 0 || (xStrideBytes % typeSize) != 0)
+    {
+        return CHANNEL_LAYOUT_STRIDED;
+    }
 
-    if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+    const char * channels[4] = { img.m_rData, img.m_gData, img.m_bData, img.m_aData };
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(channels[0]);
+    for (int c = 1; c < 4; ++c)
     {
-        throw Exception("Invalid output image position.");
+        if (channels[c])
+        {
+            base = std::min(base, reinterpret_cast<uintptr_t>(channels[c]));
+        }
+    }
+
+    for (int c = 0; c < 4; ++c)
+    {
+        offsets[c] = -1;
+        if (channels[c])
+        {
+            const uintptr_t diff = reinterpret_cast<uintptr_t>(channels[c]) - base;
+            if (diff >= uintptr_t(xStrideBytes) || (diff % typeSize) != 0)
+            {
+                return CHANNEL_LAYOUT_STRIDED;
+            }
+            offsets[c] = ptrdiff_t(diff) / typeSize;
+        }
+    }
+
+    pixelStride = xStrideBytes / typeSize;
+    baseOffset  = -offsets[0] * typeSize;
+
+    return CHANNEL_LAYOUT_INTERLEAVED;
+}
+
+template<typename Type>
+void PackPlanar(const Type * r, const Type * g, const Type * b, const Type * a,
+                Type * rgba, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        rgba[4 * idx + 0] = r[idx];
+        rgba[4 * idx + 1] = g[idx];
+        rgba[4 * idx + 2] = b[idx];
+        rgba[4 * idx + 3] = a ? a[idx] : (Type)0.0f;
     }
+}
+
+template<typename Type>
+void UnpackPlanar(const Type * rgba, Type * r, Type * g, Type * b, Type * a, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        r[idx] = rgba[4 * idx + 0];
+        g[idx] = rgba[4 * idx + 1];
+        b[idx] = rgba[4 * idx + 2];
+        if (a) a[idx] = rgba[4 * idx + 3];
+    }
+}
+
+#if OCIO_USE_SSE2
+
+// The SSE2 versions only move bits so the half channels use the 16-bit integer version.
+
+template<typename Type> struct SSE2Type { typedef Type Type_t; };
+template<> struct SSE2Type<half> { typedef uint16_t Type_t; };
+
+template<typename Type>
+void PackPlanarSSE2(const Type * r, const Type * g, const Type * b, const Type * a,
+                    Type * rgba, long numPixels)
+{
+    typedef typename SSE2Type<Type>::Type_t T;
 
+    SSE2PackPlanarRGBA(reinterpret_cast<const T *>(r), reinterpret_cast<const T *>(g),
+                       reinterpret_cast<const T *>(b), reinterpret_cast<const T *>(a),
+                       reinterpret_cast<T *>(rgba), numPixels);
+}
+
+template<typename Type>
+void UnpackPlanarSSE2(const Type * rgba, Type * r, Type * g, Type * b, Type * a, long numPixels)
+{
+    typedef typename SSE2Type<Type>::Type_t T;
+
+    SSE2UnpackPlanarRGBA(reinterpret_cast<const T *>(rgba),
+                         reinterpret_cast<T *>(r), reinterpret_cast<T *>(g),
+                         reinterpret_cast<T *>(b), reinterpret_cast<T *>(a), numPixels);
+}
+
+#endif // OCIO_USE_SSE2
+
+template<typename Type, int stride>
+void PackInterleaved(const Type * in, const ptrdiff_t (&offsets)[4], ptrdiff_t pixelStride,
+                     Type * rgba, long numPixels)
+{
+    // A compile-time stride (i.e. when stride != 0) lets the compiler unroll the loop.
+    const ptrdiff_t s = stride ? stride : pixelStride;
+
+    const ptrdiff_t r = offsets[0];
+    const ptrdiff_t g = offsets[1];
+    const ptrdiff_t b = offsets[2];
+    const ptrdiff_t a = offsets[3];
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const Type * pxl = in + idx * s;
+
+        rgba[4 * idx + 0] = pxl[r];
+        rgba[4 * idx + 1] = pxl[g];
+        rgba[4 * idx + 2] = pxl[b];
+        rgba[4 * idx + 3] = a >= 0 ? pxl[a] : (Type)0.0f;
+    }
+}
+
+template<typename Type, int stride>
+void UnpackInterleaved(const Type * rgba, const ptrdiff_t (&offsets)[4], ptrdiff_t pixelStride,
+                       Type * out, long numPixels)
+{
+    const ptrdiff_t s = stride ? stride : pixelStride;
+
+    const ptrdiff_t r = offsets[0];
+    const ptrdiff_t g = offsets[1];
+    const ptrdiff_t b = offsets[2];
+    const ptrdiff_t a = offsets[3];
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        Type * pxl = out + idx * s;
+
+        pxl[r] = rgba[4 * idx + 0];
+        pxl[g] = rgba[4 * idx + 1];
+        pxl[b] = rgba[4 * idx + 2];
+        if (a >= 0) pxl[a] = rgba[4 * idx + 3];
+    }
+}
+
+// Reorder the channels of one scanline from an arbitrary channel ordering to a RGBA buffer.
+template<typename Type>
+void CopyToRGBA(const GenericImageDesc & srcImg,
+                long yIndex,
+                long xIndex,
+                Type * rgba,
+                long numPixels)
+{
     const ptrdiff_t xStrideBytes = srcImg.m_xStrideBytes;
     const ptrdiff_t yStrideBytes = srcImg.m_yStrideBytes;
 
-    const long yIndex = imagePixelStartIndex / imgWidth;
-    long xIndex = imagePixelStartIndex % imgWidth;
-
     // Figure out our initial ptr positions
-    char * rRow = srcImg.m_rData + yStrideBytes * yIndex;
-    char * gRow = srcImg.m_gData + yStrideBytes * yIndex;
-    char * bRow = srcImg.m_bData + yStrideBytes * yIndex;
-    char * aRow = nullptr;
+    const ptrdiff_t startBytes = yStrideBytes * yIndex + xStrideBytes * xIndex;
+
+    const Type * rPtr = reinterpret_cast<const Type*>(srcImg.m_rData + startBytes);
+    const Type * gPtr = reinterpret_cast<const Type*>(srcImg.m_gData + startBytes);
+    const Type * bPtr = reinterpret_cast<const Type*>(srcImg.m_bData + startBytes);
+    const Type * aPtr = srcImg.m_aData
+                        ? reinterpret_cast<const Type*>(srcImg.m_aData + startBytes) : nullptr;
 
-    Type * rPtr = reinterpret_cast<Type*>(rRow + xStrideBytes * xIndex);
-    Type * gPtr = reinterpret_cast<Type*>(gRow + xStrideBytes * xIndex);
-    Type * bPtr = reinterpret_cast<Type*>(bRow + xStrideBytes * xIndex);
-    Type * aPtr = nullptr;
+    ptrdiff_t pixelStride = 0, baseOffset = 0;
+    ptrdiff_t offsets[4];
 
-    if(srcImg.m_aData)
+    switch (GetChannelLayout<Type>(srcImg, pixelStride, offsets, baseOffset))
     {
-        aRow = srcImg.m_aData + yStrideBytes * yIndex;
-        aPtr = reinterpret_cast<Type*>(aRow + xStrideBytes*xIndex);
+        case CHANNEL_LAYOUT_PLANAR:
+        {
+#if OCIO_USE_SSE2
+            if (CPUInfo::instance().hasSSE2())
+            {
+                PackPlanarSSE2(rPtr, gPtr, bPtr, aPtr, rgba, numPixels);
+                return;
+            }
+#endif
+            PackPlanar(rPtr, gPtr, bPtr, aPtr, rgba, numPixels);
+            return;
+        }
+        case CHANNEL_LAYOUT_INTERLEAVED:
+        {
+            const Type * in = reinterpret_cast<const Type*>(
+                reinterpret_cast<const char*>(rPtr) + baseOffset);
+
+            if (pixelStride == 3)
+            {
+                PackInterleaved<Type, 3>(in, offsets, pixelStride, rgba, numPixels);
+            }
+            else if (pixelStride == 4)
+            {
+                PackInterleaved<Type, 4>(in, offsets, pixelStride, rgba, numPixels);
+            }
+            else
+            {
+                PackInterleaved<Type, 0>(in, offsets, pixelStride, rgba, numPixels);
+            }
+            return;
+        }
+        case CHANNEL_LAYOUT_STRIDED:
+        default:
+            break;
     }
 
-    // Process one single, complete scanline.
-    int pixelsCopied = 0;
-    while(pixelsCopied < outputBufferSize)
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        // Reorder channels from arbitrary channel ordering to RGBA.
+        rgba[4*idx+0] = *rPtr;
+        rgba[4*idx+1] = *gPtr;
+        rgba[4*idx+2] = *bPtr;
+        rgba[4*idx+3] = aPtr ? *aPtr : (Type)0.0f;
+
+        rPtr = reinterpret_cast<const Type*>(reinterpret_cast<const char*>(rPtr) + xStrideBytes);
+        gPtr = reinterpret_cast<const Type*>(reinterpret_cast<const char*>(gPtr) + xStrideBytes);
+        bPtr = reinterpret_cast<const Type*>(reinterpret_cast<const char*>(bPtr) + xStrideBytes);
+        if(aPtr)
+        {
+            aPtr = reinterpret_cast<const Type*>(
+                reinterpret_cast<const char*>(aPtr) + xStrideBytes);
+        }
+    }
+}
+
+// Copy one scanline from a RGBA buffer to an arbitrary channel ordering.
+template<typename Type>
+void CopyFromRGBA(GenericImageDesc & dstImg,
+                  long yIndex,
+                  long xIndex,
+                  const Type * rgba,
+                  long numPixels)
+{
+    const ptrdiff_t xStrideBytes = dstImg.m_xStrideBytes;
+    const ptrdiff_t yStrideBytes = dstImg.m_yStrideBytes;
+
+    // Figure out our initial ptr positions
+    const ptrdiff_t startBytes = yStrideBytes * yIndex + xStrideBytes * xIndex;
+
+    Type * rPtr = reinterpret_cast<Type*>(dstImg.m_rData + startBytes);
+    Type * gPtr = reinterpret_cast<Type*>(dstImg.m_gData + startBytes);
+    Type * bPtr = reinterpret_cast<Type*>(dstImg.m_bData + startBytes);
+    Type * aPtr = dstImg.m_aData ? reinterpret_cast<Type*>(dstImg.m_aData + startBytes) : nullptr;
+
+    ptrdiff_t pixelStride = 0, baseOffset = 0;
+    ptrdiff_t offsets[4];
+
+    switch (GetChannelLayout<Type>(dstImg, pixelStride, offsets, baseOffset))
     {
-        // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
-        inBitDepthBuffer[4*pixelsCopied+0] = *rPtr;
-        inBitDepthBuffer[4*pixelsCopied+1] = *gPtr;
-        inBitDepthBuffer[4*pixelsCopied+2] = *bPtr;
-        inBitDepthBuffer[4*pixelsCopied+3] = aPtr ? *aPtr : (Type)0.0f;
+        case CHANNEL_LAYOUT_PLANAR:
+        {
+#if OCIO_USE_SSE2
+            if (CPUInfo::instance().hasSSE2())
+            {
+                UnpackPlanarSSE2(rgba, rPtr, gPtr, bPtr, aPtr, numPixels);
+                return;
+            }
+#endif
+            UnpackPlanar(rgba, rPtr, gPtr, bPtr, aPtr, numPixels);
+            return;
+        }
+        case CHANNEL_LAYOUT_INTERLEAVED:
+        {
+            Type * out = reinterpret_cast<Type*>(reinterpret_cast<char*>(rPtr) + baseOffset);
+
+            if (pixelStride == 3)
+            {
+                UnpackInterleaved<Type, 3>(rgba, offsets, pixelStride, out, numPixels);
+            }
+            else if (pixelStride == 4)
+            {
+                UnpackInterleaved<Type, 4>(rgba, offsets, pixelStride, out, numPixels);
+            }
+            else
+            {
+                UnpackInterleaved<Type, 0>(rgba, offsets, pixelStride, out, numPixels);
+            }
+            return;
+        }
+        case CHANNEL_LAYOUT_STRIDED:
+        default:
+            break;
+    }
 
-        pixelsCopied++;
-        xIndex++;
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        // Copy from RGBA buffer to arbitrary channel ordering.
+        *rPtr = rgba[4*idx];
+        *gPtr = rgba[4*idx+1];
+        *bPtr = rgba[4*idx+2];
+        if(aPtr) *aPtr = rgba[4*idx+3];
 
         rPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(rPtr) + xStrideBytes);
         gPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(gPtr) + xStrideBytes);
@@ -83,9 +339,39 @@ void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
             aPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(aPtr) + xStrideBytes);
         }
     }
+}
+
+} // anon
+
+template<typename Type>
+void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
+                                          Type * inBitDepthBuffer,
+                                          float * outputBuffer,
+                                          int outputBufferSize,
+                                          long imagePixelStartIndex)
+{
+    if(outputBuffer==nullptr)
+    {
+        throw Exception("Invalid output image buffer");
+    }
+
+    const long imgWidth  = srcImg.m_width;
+    const long imgHeight = srcImg.m_height;
+    const long imgPixels = imgWidth * imgHeight;
+
+    if(imagePixelStartIndex<0 || imagePixelStartIndex>=imgPixels)
+    {
+        throw Exception("Invalid output image position.");
+    }
+
+    const long yIndex = imagePixelStartIndex / imgWidth;
+    const long xIndex = imagePixelStartIndex % imgWidth;
+
+    // Process one single, complete scanline.
+    CopyToRGBA(srcImg, yIndex, xIndex, inBitDepthBuffer, outputBufferSize);
 
     // Convert from the input bit-depth to F32 (i.e always in RGBA).
-    srcImg.m_bitDepthOp->apply(&inBitDepthBuffer[0], outputBuffer, pixelsCopied);
+    srcImg.m_bitDepthOp->apply(&inBitDepthBuffer[0], outputBuffer, outputBufferSize);
 }
 
 template<>
@@ -109,53 +395,14 @@ void Generic<float>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
         throw Exception("Invalid output image position.");
     }
 
-    const ptrdiff_t xStrideBytes = srcImg.m_xStrideBytes;
-    const ptrdiff_t yStrideBytes = srcImg.m_yStrideBytes;
-
     const long yIndex = imagePixelStartIndex / imgWidth;
-    long xIndex = imagePixelStartIndex % imgWidth;
-
-    // Figure out our initial ptr positions
-    char * rRow = srcImg.m_rData + yStrideBytes * yIndex;
-    char * gRow = srcImg.m_gData + yStrideBytes * yIndex;
-    char * bRow = srcImg.m_bData + yStrideBytes * yIndex;
-    char * aRow = nullptr;
-
-    float * rPtr = reinterpret_cast<float*>(rRow + xStrideBytes * xIndex);
-    float * gPtr = reinterpret_cast<float*>(gRow + xStrideBytes * xIndex);
-    float * bPtr = reinterpret_cast<float*>(bRow + xStrideBytes * xIndex);
-    float * aPtr = nullptr;
-
-    if(srcImg.m_aData)
-    {
-        aRow = srcImg.m_aData + yStrideBytes * yIndex;
-        aPtr = reinterpret_cast<float*>(aRow + xStrideBytes*xIndex);
-    }
+    const long xIndex = imagePixelStartIndex % imgWidth;
 
     // Process one single, complete scanline.
-    int pixelsCopied = 0;
-    while(pixelsCopied < outputBufferSize)
-    {
-        // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
-        outputBuffer[4*pixelsCopied+0] = *rPtr;
-        outputBuffer[4*pixelsCopied+1] = *gPtr;
-        outputBuffer[4*pixelsCopied+2] = *bPtr;
-        outputBuffer[4*pixelsCopied+3] = aPtr ? *aPtr : 0.0f;
-
-        pixelsCopied++;
-        xIndex++;
-
-        rPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(rPtr) + xStrideBytes);
-        gPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(gPtr) + xStrideBytes);
-        bPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(bPtr) + xStrideBytes);
-        if(aPtr)
-        {
-            aPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(aPtr) + xStrideBytes);
-        }
-    }
+    CopyToRGBA(srcImg, yIndex, xIndex, outputBuffer, outputBufferSize);
 
     // In the float specialization, the BitDepthOp is the first Op of the color processing.
-    srcImg.m_bitDepthOp->apply(&outputBuffer[0], &outputBuffer[0], pixelsCopied);
+    srcImg.m_bitDepthOp->apply(&outputBuffer[0], &outputBuffer[0], outputBufferSize);
 }
 
 template<typename Type>
@@ -179,53 +426,14 @@ void Generic<Type>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
         return;
     }
 
-    const ptrdiff_t xStrideBytes = dstImg.m_xStrideBytes;
-    const ptrdiff_t yStrideBytes = dstImg.m_yStrideBytes;
-
     const long yIndex = imagePixelStartIndex / imgWidth;
-    long xIndex = imagePixelStartIndex % imgWidth;
-
-    // Figure out our initial ptr positions
-    char * rRow = dstImg.m_rData + yStrideBytes * yIndex;
-    char * gRow = dstImg.m_gData + yStrideBytes * yIndex;
-    char * bRow = dstImg.m_bData + yStrideBytes * yIndex;
-    char * aRow = nullptr;
-
-    Type * rPtr = reinterpret_cast<Type*>(rRow + xStrideBytes * xIndex);
-    Type * gPtr = reinterpret_cast<Type*>(gRow + xStrideBytes * xIndex);
-    Type * bPtr = reinterpret_cast<Type*>(bRow + xStrideBytes * xIndex);
-    Type * aPtr = nullptr;
-
-    if(dstImg.m_aData)
-    {
-        aRow = dstImg.m_aData + yStrideBytes * yIndex;
-        aPtr = reinterpret_cast<Type*>(aRow + xStrideBytes * xIndex);
-    }
+    const long xIndex = imagePixelStartIndex % imgWidth;
 
     // Convert from F32 to the output bit-depth (i.e always RGBA).
     dstImg.m_bitDepthOp->apply(&inputBuffer[0], &outBitDepthBuffer[0], numPixelsToUnpack);
 
     // Process one single, complete scanline.
-    int pixelsCopied = 0;
-    while(pixelsCopied < numPixelsToUnpack)
-    {
-        // Copy from RGBA buffer to arbitrary channel ordering.
-        *rPtr = outBitDepthBuffer[4*pixelsCopied];
-        *gPtr = outBitDepthBuffer[4*pixelsCopied+1];
-        *bPtr = outBitDepthBuffer[4*pixelsCopied+2];
-        if(aPtr) *aPtr = outBitDepthBuffer[4*pixelsCopied+3];
-
-        pixelsCopied++;
-        xIndex++;
-
-        rPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(rPtr) + xStrideBytes);
-        gPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(gPtr) + xStrideBytes);
-        bPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(bPtr) + xStrideBytes);
-        if(aPtr)
-        {
-            aPtr = reinterpret_cast<Type*>(reinterpret_cast<char*>(aPtr) + xStrideBytes);
-        }
-    }
+    CopyFromRGBA(dstImg, yIndex, xIndex, outBitDepthBuffer, numPixelsToUnpack);
 }
 
 template<>
@@ -249,53 +457,14 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
         return;
     }
 
-    const ptrdiff_t xStrideBytes = dstImg.m_xStrideBytes;
-    const ptrdiff_t yStrideBytes = dstImg.m_yStrideBytes;
-
     const long yIndex = imagePixelStartIndex / imgWidth;
-    long xIndex = imagePixelStartIndex % imgWidth;
-
-    // Figure out our initial ptr positions
-    char * rRow = dstImg.m_rData + yStrideBytes * yIndex;
-    char * gRow = dstImg.m_gData + yStrideBytes * yIndex;
-    char * bRow = dstImg.m_bData + yStrideBytes * yIndex;
-    char * aRow = nullptr;
-
-    float * rPtr = reinterpret_cast<float*>(rRow + xStrideBytes * xIndex);
-    float * gPtr = reinterpret_cast<float*>(gRow + xStrideBytes * xIndex);
-    float * bPtr = reinterpret_cast<float*>(bRow + xStrideBytes * xIndex);
-    float * aPtr = nullptr;
-
-    if(dstImg.m_aData)
-    {
-        aRow = dstImg.m_aData + yStrideBytes * yIndex;
-        aPtr = reinterpret_cast<float*>(aRow + xStrideBytes * xIndex);
-    }
+    const long xIndex = imagePixelStartIndex % imgWidth;
 
     // In the float specialization, the BitDepthOp is the last Op of the color processing.
     dstImg.m_bitDepthOp->apply(&inputBuffer[0], &inputBuffer[0], numPixelsToUnpack);
 
     // Process one single, complete scanline.
-    int pixelsCopied = 0;
-    while(pixelsCopied < numPixelsToUnpack)
-    {
-        // Copy from RGBA buffer to arbitrary channel ordering.
-        *rPtr = inputBuffer[4*pixelsCopied];
-        *gPtr = inputBuffer[4*pixelsCopied+1];
-        *bPtr = inputBuffer[4*pixelsCopied+2];
-        if(aPtr) *aPtr = inputBuffer[4*pixelsCopied+3];
-
-        pixelsCopied++;
-        xIndex++;
-
-        rPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(rPtr) + xStrideBytes);
-        gPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(gPtr) + xStrideBytes);
-        bPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(bPtr) + xStrideBytes);
-        if(aPtr)
-        {
-            aPtr = reinterpret_cast<float*>(reinterpret_cast<char*>(aPtr) + xStrideBytes);
-        }
-    }
+    CopyFromRGBA(dstImg, yIndex, xIndex, inputBuffer, numPixelsToUnpack);
 }
 
 
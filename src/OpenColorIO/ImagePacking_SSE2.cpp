@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ImagePacking_SSE2.h"
+
+#if OCIO_USE_SSE2
+
+#include "SSE2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Process the remaining pixels i.e. the ones not filling a complete SIMD register.
+
+template<typename T>
+inline void PackPlanarRGBA(const T * r, const T * g, const T * b, const T * a,
+                           T * rgba, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        rgba[4 * idx + 0] = r[idx];
+        rgba[4 * idx + 1] = g[idx];
+        rgba[4 * idx + 2] = b[idx];
+        rgba[4 * idx + 3] = a ? a[idx] : T(0);
+    }
+}
+
+template<typename T>
+inline void UnpackPlanarRGBA(const T * rgba, T * r, T * g, T * b, T * a, long numPixels)
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        r[idx] = rgba[4 * idx + 0];
+        g[idx] = rgba[4 * idx + 1];
+        b[idx] = rgba[4 * idx + 2];
+        if (a) a[idx] = rgba[4 * idx + 3];
+    }
+}
+
+} // anon
+
+void SSE2PackPlanarRGBA(const float * r, const float * g, const float * b, const float * a,
+                        float * rgba, long numPixels)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 p0 = _mm_loadu_ps(r + idx);
+        __m128 p1 = _mm_loadu_ps(g + idx);
+        __m128 p2 = _mm_loadu_ps(b + idx);
+        __m128 p3 = a ? _mm_loadu_ps(a + idx) : _mm_setzero_ps();
+
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        _mm_storeu_ps(rgba + 4 * idx +  0, p0);
+        _mm_storeu_ps(rgba + 4 * idx +  4, p1);
+        _mm_storeu_ps(rgba + 4 * idx +  8, p2);
+        _mm_storeu_ps(rgba + 4 * idx + 12, p3);
+    }
+
+    PackPlanarRGBA(r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                   rgba + 4 * idx, numPixels - idx);
+}
+
+void SSE2PackPlanarRGBA(const uint16_t * r, const uint16_t * g, const uint16_t * b,
+                        const uint16_t * a, uint16_t * rgba, long numPixels)
+{
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m128i R = _mm_loadu_si128((const __m128i *)(r + idx));
+        const __m128i G = _mm_loadu_si128((const __m128i *)(g + idx));
+        const __m128i B = _mm_loadu_si128((const __m128i *)(b + idx));
+        const __m128i A = a ? _mm_loadu_si128((const __m128i *)(a + idx)) : _mm_setzero_si128();
+
+        // r0 g0 r1 g1 ... & b0 a0 b1 a1 ...
+        const __m128i rg0 = _mm_unpacklo_epi16(R, G);
+        const __m128i rg1 = _mm_unpackhi_epi16(R, G);
+        const __m128i ba0 = _mm_unpacklo_epi16(B, A);
+        const __m128i ba1 = _mm_unpackhi_epi16(B, A);
+
+        __m128i * out = (__m128i *)(rgba + 4 * idx);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi32(rg0, ba0));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi32(rg0, ba0));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi32(rg1, ba1));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi32(rg1, ba1));
+    }
+
+    PackPlanarRGBA(r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                   rgba + 4 * idx, numPixels - idx);
+}
+
+void SSE2PackPlanarRGBA(const uint8_t * r, const uint8_t * g, const uint8_t * b,
+                        const uint8_t * a, uint8_t * rgba, long numPixels)
+{
+    long idx = 0;
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        const __m128i R = _mm_loadu_si128((const __m128i *)(r + idx));
+        const __m128i G = _mm_loadu_si128((const __m128i *)(g + idx));
+        const __m128i B = _mm_loadu_si128((const __m128i *)(b + idx));
+        const __m128i A = a ? _mm_loadu_si128((const __m128i *)(a + idx)) : _mm_setzero_si128();
+
+        const __m128i rg0 = _mm_unpacklo_epi8(R, G);
+        const __m128i rg1 = _mm_unpackhi_epi8(R, G);
+        const __m128i ba0 = _mm_unpacklo_epi8(B, A);
+        const __m128i ba1 = _mm_unpackhi_epi8(B, A);
+
+        __m128i * out = (__m128i *)(rgba + 4 * idx);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(rg0, ba0));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg0, ba0));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(rg1, ba1));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(rg1, ba1));
+    }
+
+    PackPlanarRGBA(r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                   rgba + 4 * idx, numPixels - idx);
+}
+
+void SSE2UnpackPlanarRGBA(const float * rgba,
+                          float * r, float * g, float * b, float * a, long numPixels)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 p0 = _mm_loadu_ps(rgba + 4 * idx +  0);
+        __m128 p1 = _mm_loadu_ps(rgba + 4 * idx +  4);
+        __m128 p2 = _mm_loadu_ps(rgba + 4 * idx +  8);
+        __m128 p3 = _mm_loadu_ps(rgba + 4 * idx + 12);
+
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        _mm_storeu_ps(r + idx, p0);
+        _mm_storeu_ps(g + idx, p1);
+        _mm_storeu_ps(b + idx, p2);
+        if (a) _mm_storeu_ps(a + idx, p3);
+    }
+
+    UnpackPlanarRGBA(rgba + 4 * idx, r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                     numPixels - idx);
+}
+
+void SSE2UnpackPlanarRGBA(const uint16_t * rgba,
+                          uint16_t * r, uint16_t * g, uint16_t * b, uint16_t * a,
+                          long numPixels)
+{
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        const __m128i * in = (const __m128i *)(rgba + 4 * idx);
+
+        // Two 16-bit interleaving passes followed by a 64-bit one de-interleave the channels.
+        const __m128i p0 = _mm_loadu_si128(in + 0);
+        const __m128i p1 = _mm_loadu_si128(in + 1);
+        const __m128i p2 = _mm_loadu_si128(in + 2);
+        const __m128i p3 = _mm_loadu_si128(in + 3);
+
+        // r0 r2 g0 g2 b0 b2 a0 a2 ...
+        const __m128i t0 = _mm_unpacklo_epi16(p0, p1);
+        const __m128i t1 = _mm_unpackhi_epi16(p0, p1);
+        const __m128i t2 = _mm_unpacklo_epi16(p2, p3);
+        const __m128i t3 = _mm_unpackhi_epi16(p2, p3);
+
+        // r0 r1 r2 r3 g0 g1 g2 g3 & b0 b1 b2 b3 a0 a1 a2 a3
+        const __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+        const __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+        const __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+        const __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+
+        _mm_storeu_si128((__m128i *)(r + idx), _mm_unpacklo_epi64(u0, u2));
+        _mm_storeu_si128((__m128i *)(g + idx), _mm_unpackhi_epi64(u0, u2));
+        _mm_storeu_si128((__m128i *)(b + idx), _mm_unpacklo_epi64(u1, u3));
+        if (a) _mm_storeu_si128((__m128i *)(a + idx), _mm_unpackhi_epi64(u1, u3));
+    }
+
+    UnpackPlanarRGBA(rgba + 4 * idx, r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                     numPixels - idx);
+}
+
+void SSE2UnpackPlanarRGBA(const uint8_t * rgba,
+                          uint8_t * r, uint8_t * g, uint8_t * b, uint8_t * a, long numPixels)
+{
+    long idx = 0;
+    for (; idx + 16 <= numPixels; idx += 16)
+    {
+        const __m128i * in = (const __m128i *)(rgba + 4 * idx);
+
+        // Three 8-bit interleaving passes followed by a 64-bit one de-interleave the channels.
+        const __m128i p0 = _mm_loadu_si128(in + 0);
+        const __m128i p1 = _mm_loadu_si128(in + 1);
+        const __m128i p2 = _mm_loadu_si128(in + 2);
+        const __m128i p3 = _mm_loadu_si128(in + 3);
+
+        const __m128i t0 = _mm_unpacklo_epi8(p0, p1);
+        const __m128i t1 = _mm_unpackhi_epi8(p0, p1);
+        const __m128i t2 = _mm_unpacklo_epi8(p2, p3);
+        const __m128i t3 = _mm_unpackhi_epi8(p2, p3);
+
+        const __m128i u0 = _mm_unpacklo_epi8(t0, t1);
+        const __m128i u1 = _mm_unpackhi_epi8(t0, t1);
+        const __m128i u2 = _mm_unpacklo_epi8(t2, t3);
+        const __m128i u3 = _mm_unpackhi_epi8(t2, t3);
+
+        // r0 ... r7 g0 ... g7 & b0 ... b7 a0 ... a7
+        const __m128i v0 = _mm_unpacklo_epi8(u0, u1);
+        const __m128i v1 = _mm_unpackhi_epi8(u0, u1);
+        const __m128i v2 = _mm_unpacklo_epi8(u2, u3);
+        const __m128i v3 = _mm_unpackhi_epi8(u2, u3);
+
+        _mm_storeu_si128((__m128i *)(r + idx), _mm_unpacklo_epi64(v0, v2));
+        _mm_storeu_si128((__m128i *)(g + idx), _mm_unpackhi_epi64(v0, v2));
+        _mm_storeu_si128((__m128i *)(b + idx), _mm_unpacklo_epi64(v1, v3));
+        if (a) _mm_storeu_si128((__m128i *)(a + idx), _mm_unpackhi_epi64(v1, v3));
+    }
+
+    UnpackPlanarRGBA(rgba + 4 * idx, r + idx, g + idx, b + idx, a ? a + idx : nullptr,
+                     numPixels - idx);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
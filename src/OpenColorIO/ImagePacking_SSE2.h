@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_IMAGEPACKING_SSE2_H
+#define INCLUDED_OCIO_IMAGEPACKING_SSE2_H
+
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+#if OCIO_USE_SSE2
+namespace OCIO_NAMESPACE
+{
+
+// Interleave the planar channels into a packed RGBA buffer. The alpha channel is set to zero
+// when the alpha plane is null. The half planes use the uint16_t version.
+void SSE2PackPlanarRGBA(const float * r, const float * g, const float * b, const float * a,
+                        float * rgba, long numPixels);
+void SSE2PackPlanarRGBA(const uint16_t * r, const uint16_t * g, const uint16_t * b,
+                        const uint16_t * a, uint16_t * rgba, long numPixels);
+void SSE2PackPlanarRGBA(const uint8_t * r, const uint8_t * g, const uint8_t * b,
+                        const uint8_t * a, uint8_t * rgba, long numPixels);
+
+// De-interleave a packed RGBA buffer into planar channels. The alpha channel is skipped when
+// the alpha plane is null.
+void SSE2UnpackPlanarRGBA(const float * rgba,
+                          float * r, float * g, float * b, float * a, long numPixels);
+void SSE2UnpackPlanarRGBA(const uint16_t * rgba,
+                          uint16_t * r, uint16_t * g, uint16_t * b, uint16_t * a,
+                          long numPixels);
+void SSE2UnpackPlanarRGBA(const uint8_t * rgba,
+                          uint8_t * r, uint8_t * g, uint8_t * b, uint8_t * a, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
+
+#endif /* INCLUDED_OCIO_IMAGEPACKING_SSE2_H */
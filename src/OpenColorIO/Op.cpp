@@ -26,6 +26,16 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasApplyRGB() const
+{
+    return false;
+}
+
+void OpCPU::applyRGB(const float * /* inImg */, float * /* outImg */, long /* numPixels */) const
+{
+    throw Exception("Op does not implement the packed RGB processing.");
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -45,6 +45,12 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Some ops also have a 3-channel renderer processing packed RGB 32-bit float buffers
+    // (i.e. without alpha) so these images could be processed in place. The alpha channel is
+    // then considered to be zero. Note that applyRGB() throws if hasApplyRGB() is false.
+    virtual bool hasApplyRGB() const;
+    virtual void applyRGB(const float * inImg, float * outImg, long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
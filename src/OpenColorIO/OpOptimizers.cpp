@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <sstream>
 
@@ -10,8 +11,14 @@
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
+#include "ops/exponent/ExponentOp.h"
+#include "ops/fixedfunction/FixedFunctionOpData.h"
+#include "ops/gamma/GammaOpData.h"
+#include "ops/log/LogOp.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOp.h"
 
 namespace OCIO_NAMESPACE
@@ -593,6 +600,378 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+// The following code replaces runs of expensive ops (e.g. the ACES 2 Output Transform, or the
+// grading curves) by a sampled 3D LUT.  A run is only replaced when its estimated evaluation
+// cost is much higher than the cost of the LUT look-up.  As the ops usually process
+// scene-linear values, the LUT is preceded by a log shaper.
+
+// Above this estimated cost, a run of ops is replaced by a shaper and a 3D LUT.
+constexpr unsigned BAKE_COST_THRESHOLD = 40;
+
+// Grid size of the 3D LUT replacing a run of ops.
+constexpr unsigned long BAKE_LUT3D_GRID_SIZE = 65;
+
+// The log shaper covers the [2^BAKE_SHAPER_MIN_STOP, 2^BAKE_SHAPER_MAX_STOP] range.  Below that
+// range, a linear segment reserves BAKE_SHAPER_TOE_STOPS of the LUT domain to small and
+// negative values.
+constexpr double BAKE_SHAPER_MIN_STOP  = -6.;
+constexpr double BAKE_SHAPER_MAX_STOP  = 12.;
+constexpr double BAKE_SHAPER_TOE_STOPS = 2.;
+
+// Estimate the per pixel cost of the CPU evaluation of an op, a matrix costing about 1.
+unsigned EstimateOpCost(const ConstOpRcPtr & op)
+{
+    auto opData = op->data();
+
+    switch (opData->getType())
+    {
+    case OpData::MatrixType:
+    case OpData::RangeType:
+    case OpData::ExponentType:
+        return 1;
+
+    case OpData::Lut1DType:
+        return 2;
+
+    case OpData::CDLType:
+    case OpData::ExposureContrastType:
+    case OpData::GammaType:
+    case OpData::LogType:
+    case OpData::GradingPrimaryType:
+        return 4;
+
+    case OpData::Lut3DType:
+        return 6;
+
+    case OpData::GradingRGBCurveType:
+        return 12;
+
+    case OpData::GradingToneType:
+        return 20;
+
+    case OpData::GradingHueCurveType:
+        return 40;
+
+    case OpData::FixedFunctionType:
+    {
+        auto ffData = OCIO_DYNAMIC_POINTER_CAST<const FixedFunctionOpData>(opData);
+        switch (ffData->getStyle())
+        {
+        case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
+        case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
+            return 100;
+
+        case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_FWD:
+        case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_INV:
+            return 60;
+
+        case FixedFunctionOpData::ACES_RGB_TO_JMh_20:
+        case FixedFunctionOpData::ACES_JMh_TO_RGB_20:
+        case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_FWD:
+        case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_INV:
+            return 20;
+
+        case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
+        case FixedFunctionOpData::ACES_RED_MOD_03_INV:
+        case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
+        case FixedFunctionOpData::ACES_RED_MOD_10_INV:
+        case FixedFunctionOpData::ACES_GLOW_03_FWD:
+        case FixedFunctionOpData::ACES_GLOW_03_INV:
+        case FixedFunctionOpData::ACES_GLOW_10_FWD:
+        case FixedFunctionOpData::ACES_GLOW_10_INV:
+        case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
+        case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
+        case FixedFunctionOpData::ACES_GAMUT_COMP_13_FWD:
+        case FixedFunctionOpData::ACES_GAMUT_COMP_13_INV:
+        case FixedFunctionOpData::REC2100_SURROUND_FWD:
+        case FixedFunctionOpData::REC2100_SURROUND_INV:
+        case FixedFunctionOpData::RGB_TO_HSV:
+        case FixedFunctionOpData::HSV_TO_RGB:
+        case FixedFunctionOpData::XYZ_TO_xyY:
+        case FixedFunctionOpData::xyY_TO_XYZ:
+        case FixedFunctionOpData::XYZ_TO_uvY:
+        case FixedFunctionOpData::uvY_TO_XYZ:
+        case FixedFunctionOpData::XYZ_TO_LUV:
+        case FixedFunctionOpData::LUV_TO_XYZ:
+        case FixedFunctionOpData::LIN_TO_PQ:
+        case FixedFunctionOpData::PQ_TO_LIN:
+        case FixedFunctionOpData::LIN_TO_GAMMA_LOG:
+        case FixedFunctionOpData::GAMMA_LOG_TO_LIN:
+        case FixedFunctionOpData::LIN_TO_DOUBLE_LOG:
+        case FixedFunctionOpData::DOUBLE_LOG_TO_LIN:
+        case FixedFunctionOpData::RGB_TO_HSY_LIN:
+        case FixedFunctionOpData::RGB_TO_HSY_LOG:
+        case FixedFunctionOpData::RGB_TO_HSY_VID:
+        case FixedFunctionOpData::HSY_LIN_TO_RGB:
+        case FixedFunctionOpData::HSY_LOG_TO_RGB:
+        case FixedFunctionOpData::HSY_VID_TO_RGB:
+            return 8;
+        }
+        break;
+    }
+
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        break;
+    }
+
+    return 0;
+}
+
+// Only the ops processing RGB values, without any dynamic property, can be baked.
+bool IsBakeable(const ConstOpRcPtr & op)
+{
+    if (op->isDynamic())
+    {
+        return false;
+    }
+
+    auto opData = op->data();
+    switch (opData->getType())
+    {
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        return false;
+
+    // A 3D LUT preserves the alpha channel so the ops changing it can not be baked.
+
+    case OpData::MatrixType:
+    {
+        auto matrixData = OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(opData);
+        return !matrixData->hasAlpha();
+    }
+
+    case OpData::ExponentType:
+    {
+        auto expData = OCIO_DYNAMIC_POINTER_CAST<const ExponentOpData>(opData);
+        return expData->m_exp4[3] == 1.;
+    }
+
+    case OpData::GammaType:
+    {
+        auto gammaData = OCIO_DYNAMIC_POINTER_CAST<const GammaOpData>(opData);
+        return gammaData->isAlphaComponentIdentity();
+    }
+
+    case OpData::CDLType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingHueCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::Lut1DType:
+    case OpData::Lut3DType:
+    case OpData::RangeType:
+        return true;
+    }
+
+    return false;
+}
+
+// Some fixed functions convert to and from color spaces that are not RGB-like (e.g. JMh or HSV)
+// so their values can not go through the shaper, nor be interpolated (e.g. a hue wraps around).
+// Return whether the values are RGB-like after the op.
+bool IsRGBDomainAfter(const ConstOpRcPtr & op, bool isRGBDomainBefore)
+{
+    auto opData = op->data();
+    if (opData->getType() != OpData::FixedFunctionType)
+    {
+        return isRGBDomainBefore;
+    }
+
+    auto ffData = OCIO_DYNAMIC_POINTER_CAST<const FixedFunctionOpData>(opData);
+    switch (ffData->getStyle())
+    {
+    case FixedFunctionOpData::RGB_TO_HSV:
+    case FixedFunctionOpData::XYZ_TO_xyY:
+    case FixedFunctionOpData::XYZ_TO_uvY:
+    case FixedFunctionOpData::XYZ_TO_LUV:
+    case FixedFunctionOpData::ACES_RGB_TO_JMh_20:
+    case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_FWD:
+    case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_INV:
+    case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_FWD:
+    case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_INV:
+    case FixedFunctionOpData::RGB_TO_HSY_LIN:
+    case FixedFunctionOpData::RGB_TO_HSY_LOG:
+    case FixedFunctionOpData::RGB_TO_HSY_VID:
+        return false;
+
+    case FixedFunctionOpData::HSV_TO_RGB:
+    case FixedFunctionOpData::xyY_TO_XYZ:
+    case FixedFunctionOpData::uvY_TO_XYZ:
+    case FixedFunctionOpData::LUV_TO_XYZ:
+    case FixedFunctionOpData::ACES_JMh_TO_RGB_20:
+    case FixedFunctionOpData::HSY_LIN_TO_RGB:
+    case FixedFunctionOpData::HSY_LOG_TO_RGB:
+    case FixedFunctionOpData::HSY_VID_TO_RGB:
+        return true;
+
+    case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
+    case FixedFunctionOpData::ACES_RED_MOD_03_INV:
+    case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
+    case FixedFunctionOpData::ACES_RED_MOD_10_INV:
+    case FixedFunctionOpData::ACES_GLOW_03_FWD:
+    case FixedFunctionOpData::ACES_GLOW_03_INV:
+    case FixedFunctionOpData::ACES_GLOW_10_FWD:
+    case FixedFunctionOpData::ACES_GLOW_10_INV:
+    case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
+    case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
+    case FixedFunctionOpData::ACES_GAMUT_COMP_13_FWD:
+    case FixedFunctionOpData::ACES_GAMUT_COMP_13_INV:
+    case FixedFunctionOpData::REC2100_SURROUND_FWD:
+    case FixedFunctionOpData::REC2100_SURROUND_INV:
+    case FixedFunctionOpData::LIN_TO_PQ:
+    case FixedFunctionOpData::PQ_TO_LIN:
+    case FixedFunctionOpData::LIN_TO_GAMMA_LOG:
+    case FixedFunctionOpData::GAMMA_LOG_TO_LIN:
+    case FixedFunctionOpData::LIN_TO_DOUBLE_LOG:
+    case FixedFunctionOpData::DOUBLE_LOG_TO_LIN:
+    case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
+    case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
+        return isRGBDomainBefore;
+    }
+
+    return isRGBDomainBefore;
+}
+
+// A range clamping to [0, 1] already limits the values to the 3D LUT domain.
+bool IsClampingToUnitRange(const ConstOpRcPtr & op)
+{
+    auto opData = op->data();
+    if (opData->getType() != OpData::RangeType)
+    {
+        return false;
+    }
+
+    auto rangeData = OCIO_DYNAMIC_POINTER_CAST<const RangeOpData>(opData);
+    return rangeData->hasMinOutValue() && rangeData->getMinOutValue() >= 0.
+        && rangeData->hasMaxOutValue() && rangeData->getMaxOutValue() <= 1.;
+}
+
+LogOpDataRcPtr MakeBakeShaper()
+{
+    // Camera style log (i.e. with a linear segment) from scene-linear to [0, 1].
+    const double logSlope  = 1. / (BAKE_SHAPER_MAX_STOP - BAKE_SHAPER_MIN_STOP
+                                   + BAKE_SHAPER_TOE_STOPS);
+    const double logOffset = (BAKE_SHAPER_TOE_STOPS - BAKE_SHAPER_MIN_STOP) * logSlope;
+    const double linBreak  = std::pow(2., BAKE_SHAPER_MIN_STOP);
+
+    const LogOpData::Params params{ logSlope, logOffset, 1., 0., linBreak };
+    return std::make_shared<LogOpData>(2., params, params, params, TRANSFORM_DIR_FORWARD);
+}
+
+// Replace the ops in [start, end) by a 3D LUT, preceded by a log shaper if requested.
+// Return the number of ops replacing them.
+unsigned BakeOps(OpRcPtrVec & opVec, size_t start, size_t end, bool useShaper)
+{
+    OpRcPtrVec evalOps;
+
+    LogOpDataRcPtr shaper;
+    if (useShaper)
+    {
+        shaper = MakeBakeShaper();
+        CreateLogOp(evalOps, shaper, TRANSFORM_DIR_INVERSE);
+    }
+
+    for (size_t idx = start; idx < end; ++idx)
+    {
+        evalOps.push_back(opVec[idx]->clone());
+    }
+
+    // Send the identity LUT values (i.e. the shaper domain) through the inverse shaper
+    // and the ops.
+    auto lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, BAKE_LUT3D_GRID_SIZE);
+
+    Array::Values & values = lut->getArray().getValues();
+    const long numPixels = long(BAKE_LUT3D_GRID_SIZE * BAKE_LUT3D_GRID_SIZE * BAKE_LUT3D_GRID_SIZE);
+    EvalTransform(&values[0], &values[0], numPixels, evalOps);
+
+    OpRcPtrVec lutOps;
+    if (useShaper)
+    {
+        CreateLogOp(lutOps, shaper, TRANSFORM_DIR_FORWARD);
+    }
+    CreateLut3DOp(lutOps, lut, TRANSFORM_DIR_FORWARD);
+    FinalizeOps(lutOps);
+
+    opVec.erase(opVec.begin() + start, opVec.begin() + end);
+    opVec.insert(opVec.begin() + start, lutOps.begin(), lutOps.end());
+
+    return static_cast<unsigned>(lutOps.size());
+}
+
+// Replace the runs of consecutive expensive ops by a 3D LUT.  Return the number of replaced runs.
+int BakeExpensiveOps(OpRcPtrVec & opVec)
+{
+    int count = 0;
+
+    // The input values are RGB-like.
+    bool isRGBDomain = true;
+
+    size_t start = 0;
+    while (start < opVec.size())
+    {
+        ConstOpRcPtr startOp = opVec[start];
+        if (!isRGBDomain || !IsBakeable(startOp))
+        {
+            isRGBDomain = IsRGBDomainAfter(startOp, isRGBDomain);
+            ++start;
+            continue;
+        }
+
+        // Find the longest run of bakeable ops starting & ending with RGB-like values.
+        size_t end = start;
+        size_t runEnd = start;
+        bool isRGBDomainInRun = true;
+        while (end < opVec.size() && IsBakeable(opVec[end]))
+        {
+            isRGBDomainInRun = IsRGBDomainAfter(opVec[end], isRGBDomainInRun);
+            ++end;
+            if (isRGBDomainInRun)
+            {
+                runEnd = end;
+            }
+        }
+
+        // A leading clamp to [0, 1] is kept so no shaper is needed.
+        size_t runStart = start;
+        const bool useShaper = !IsClampingToUnitRange(startOp);
+        if (!useShaper)
+        {
+            ++runStart;
+        }
+
+        unsigned cost = 0;
+        bool hasCrosstalk = false;
+        for (size_t idx = runStart; idx < runEnd; ++idx)
+        {
+            ConstOpRcPtr op = opVec[idx];
+            cost += EstimateOpCost(op);
+            hasCrosstalk = hasCrosstalk || op->hasChannelCrosstalk();
+        }
+
+        // Separable runs are better optimized using a 1D LUT (see OptimizeSeparablePrefix()).
+        if (runEnd > runStart && hasCrosstalk && cost > BAKE_COST_THRESHOLD)
+        {
+            start = runStart + BakeOps(opVec, runStart, runEnd, useShaper);
+            ++count;
+        }
+        else
+        {
+            // Skip the run, taking care of a trailing non RGB-like part.
+            for (size_t idx = start; idx < std::max(runEnd, start + 1); ++idx)
+            {
+                isRGBDomain = IsRGBDomainAfter(opVec[idx], isRGBDomain);
+            }
+            start = std::max(runEnd, start + 1);
+        }
+    }
+
+    return count;
+}
 } // namespace
 
 void OpRcPtrVec::finalize()
@@ -723,6 +1102,10 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         ++passes;
     }
 
+    // Replace what remains expensive by LUTs (lossy).
+    const int total_baked = HasFlag(oFlags, OPTIMIZATION_BAKE_EXPENSIVE_OPS)
+                          ? BakeExpensiveOps(*this) : 0;
+
     if (passes == MAX_OPTIMIZATION_PASSES)
     {
         std::ostringstream os;
@@ -749,7 +1132,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         os << total_identityops << " identity ops replaced, ";
         os << total_inverseops << " inverse op pairs removed, ";
         os << total_combines << " ops combined, ";
-        os << total_inverses << " ops inverted\n";
+        os << total_inverses << " ops inverted, ";
+        os << total_baked << " op runs baked\n";
         os << SerializeOpVec(*this, 4);
         LogDebug(os.str());
     }
@@ -13,8 +13,11 @@
 #include "HashUtils.h"
 #include "Logging.h"
 #include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
+#include "ProcessorDiskCache.h"
 #include "TransformBuilder.h"
 #include "utils/StringUtils.h"
 
@@ -185,6 +188,12 @@ ConstProcessorRcPtr Processor::getOptimizedProcessor(BitDepth inBD, BitDepth out
     return getImpl()->getOptimizedProcessor(inBD, outBD, oFlags);
 }
 
+ConstProcessorRcPtr Processor::createPatchedProcessor(int index,
+                                                      const ConstTransformRcPtr & transform) const
+{
+    return getImpl()->createPatchedProcessor(index, transform);
+}
+
 ConstGPUProcessorRcPtr Processor::getDefaultGPUProcessor() const
 {
     return getImpl()->getDefaultGPUProcessor();
@@ -247,6 +256,9 @@ Processor::Impl & Processor::Impl::operator=(const Impl & rhs)
 
         m_cacheFlags = rhs.m_cacheFlags;
 
+        // The copy could then modify its ops.
+        m_patch = nullptr;
+
         const bool enableCaches
             = (m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED;
 
@@ -272,6 +284,29 @@ bool Processor::Impl::hasChannelCrosstalk() const
     return m_ops.hasChannelCrosstalk();
 }
 
+size_t Processor::Impl::getMemorySize() const
+{
+    size_t numBytes = sizeof(Processor::Impl);
+
+    for (ConstOpRcPtr op : m_ops)
+    {
+        numBytes += sizeof(Op);
+
+        // The LUTs are by far the largest ops.
+        ConstOpDataRcPtr data = op->data();
+        if (auto lut1d = DynamicPtrCast<const Lut1DOpData>(data))
+        {
+            numBytes += lut1d->getArray().getValues().size() * sizeof(float);
+        }
+        else if (auto lut3d = DynamicPtrCast<const Lut3DOpData>(data))
+        {
+            numBytes += lut3d->getArray().getValues().size() * sizeof(float);
+        }
+    }
+
+    return numBytes;
+}
+
 ConstProcessorMetadataRcPtr Processor::Impl::getProcessorMetadata() const
 {
     return m_metadata;
@@ -377,9 +412,10 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         ProcessorRcPtr proc = Create();
         *proc->getImpl() = procImpl;
 
+        // The ops of a patched processor are not cached to disk, refer to getPatchedOps().
         proc->getImpl()->m_ops.finalize();
-        proc->getImpl()->m_ops.optimize(oFlags);
-        proc->getImpl()->m_ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags);
+        OptimizeFinalizedOps(proc->getImpl()->m_ops, inBitDepth, outBitDepth, oFlags,
+                             !procImpl.m_patch);
         proc->getImpl()->m_ops.validateDynamicProperties();
 
         return proc;
@@ -417,6 +453,151 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
     }
 }
 
+ConstProcessorRcPtr Processor::Impl::createPatchedProcessor(int index,
+                                                            const ConstTransformRcPtr & transform) const
+{
+    if (index < 0 || index >= getNumTransforms())
+    {
+        std::ostringstream oss;
+        oss << "Processor patch: invalid transform index " << index
+            << ", the processor has " << getNumTransforms() << " transforms.";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (!transform)
+    {
+        throw Exception("Processor patch: the transform is null.");
+    }
+
+    transform->validate();
+
+    // Build the ops without any config, refer to the method documentation.
+
+    ConstConfigRcPtr config = Config::CreateRaw();
+
+    OpRcPtrVec newOps;
+    BuildOps(newOps, *config, config->getCurrentContext(), transform, TRANSFORM_DIR_FORWARD);
+    newOps.finalize();
+
+    const size_t idx = static_cast<size_t>(index);
+
+    // Patching again the patched ops only changes the middle ops so the work done on the other
+    // ops is still valid.
+
+    ProcessorPatchRcPtr patch;
+    if (m_patch
+        && idx >= m_patch->m_numPrefixOps
+        && idx < m_ops.size() - m_patch->m_numSuffixOps)
+    {
+        patch = m_patch;
+    }
+    else
+    {
+        patch = std::make_shared<ProcessorPatch>();
+        patch->m_numPrefixOps = idx;
+        patch->m_numSuffixOps = m_ops.size() - idx - 1;
+    }
+
+    ProcessorRcPtr proc = Create();
+    *proc->getImpl() = *this;
+
+    OpRcPtrVec & ops = proc->getImpl()->m_ops;
+    ops.erase(ops.begin() + idx);
+    ops.insert(ops.begin() + idx, newOps.begin(), newOps.end());
+    ops.validateDynamicProperties();
+
+    proc->getImpl()->m_patch = patch;
+
+    return proc;
+}
+
+void Processor::Impl::getPatchedOps(OpRcPtrVec & ops,
+                                    ConstOpCPURcPtrVec & cpuOps,
+                                    BitDepth inBitDepth,
+                                    BitDepth outBitDepth,
+                                    OptimizationFlags oFlags) const
+{
+    const size_t numPrefixOps = m_patch->m_numPrefixOps;
+    const size_t numSuffixOps = m_patch->m_numSuffixOps;
+
+    auto OptimizeSegment = [&](OpRcPtrVec::const_iterator first,
+                               OpRcPtrVec::const_iterator last,
+                               BitDepth in,
+                               BitDepth out) -> ProcessorPatch::Segment
+    {
+        ProcessorPatch::Segment segment;
+
+        segment.m_ops.insert(segment.m_ops.begin(), first, last);
+        if (!segment.m_ops.empty())
+        {
+            segment.m_ops.finalize();
+            OptimizeFinalizedOps(segment.m_ops, in, out, oFlags);
+        }
+
+        const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
+        for (const auto & op : segment.m_ops)
+        {
+            segment.m_cpuOps.push_back(op->isDynamic() ? ConstOpCPURcPtr()
+                                                       : op->getCPUOp(fastLogExpPow));
+        }
+
+        return segment;
+    };
+
+    ProcessorPatch::Segments segments;
+    {
+        AutoMutex guard(m_patch->m_mutex);
+
+        std::ostringstream oss;
+        oss << inBitDepth << outBitDepth << oFlags;
+
+        const std::size_t key = std::hash<std::string>{}(oss.str());
+
+        auto it = m_patch->m_segments.find(key);
+        if (it == m_patch->m_segments.end())
+        {
+            ProcessorPatch::Segments newSegments;
+            newSegments.m_prefix = OptimizeSegment(m_ops.begin(),
+                                                   m_ops.begin() + numPrefixOps,
+                                                   inBitDepth,
+                                                   BIT_DEPTH_F32);
+            newSegments.m_suffix = OptimizeSegment(m_ops.end() - numSuffixOps,
+                                                   m_ops.end(),
+                                                   BIT_DEPTH_F32,
+                                                   outBitDepth);
+
+            it = m_patch->m_segments.emplace(key, newSegments).first;
+        }
+
+        segments = it->second;
+    }
+
+    // Only the patched ops are optimized & have new CPU ops. They are not cached to disk as
+    // each interactive edit would otherwise add a new file to the on-disk cache directory.
+
+    OpRcPtrVec middle;
+    middle.insert(middle.begin(), m_ops.begin() + numPrefixOps, m_ops.end() - numSuffixOps);
+    if (!middle.empty())
+    {
+        middle.finalize();
+        OptimizeFinalizedOps(middle,
+                             numPrefixOps == 0 ? inBitDepth : BIT_DEPTH_F32,
+                             numSuffixOps == 0 ? outBitDepth : BIT_DEPTH_F32,
+                             oFlags,
+                             false);
+    }
+
+    ops = segments.m_prefix.m_ops;
+    ops += middle;
+    ops += segments.m_suffix.m_ops;
+
+    cpuOps = segments.m_prefix.m_cpuOps;
+    cpuOps.resize(cpuOps.size() + middle.size());
+    cpuOps.insert(cpuOps.end(),
+                  segments.m_suffix.m_cpuOps.begin(),
+                  segments.m_suffix.m_cpuOps.end());
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 ConstGPUProcessorRcPtr Processor::Impl::getDefaultGPUProcessor() const
@@ -524,13 +705,24 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
                                                                  OptimizationFlags oFlags) const
 {
     // Helper method.
-    auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              BitDepth inBitDepth,
-                              BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+    auto CreateProcessor = [this](const OpRcPtrVec & ops,
+                                  BitDepth inBitDepth,
+                                  BitDepth outBitDepth,
+                                  OptimizationFlags oFlags) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
-        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        if (m_patch)
+        {
+            OpRcPtrVec optimizedOps;
+            ConstOpCPURcPtrVec cpuOps;
+            getPatchedOps(optimizedOps, cpuOps, inBitDepth, outBitDepth, oFlags);
+            cpu->getImpl()->finalizeOptimizedOps(optimizedOps, cpuOps,
+                                                 inBitDepth, outBitDepth, oFlags);
+        }
+        else
+        {
+            cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        }
         return cpu;
     };
 
@@ -5,6 +5,8 @@
 #ifndef INCLUDED_OCIO_PROCESSOR_H
 #define INCLUDED_OCIO_PROCESSOR_H
 
+#include <map>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
@@ -15,6 +17,37 @@
 
 namespace OCIO_NAMESPACE
 {
+
+// Shared by the processors created by Processor::createPatchedProcessor() where only the ops in
+// the middle of the list differ. The ops before (i.e. prefix) and after (i.e. suffix) the
+// patched ops are optimized once and keep their CPU ops.
+struct ProcessorPatch
+{
+    size_t m_numPrefixOps = 0;
+    size_t m_numSuffixOps = 0;
+
+    struct Segment
+    {
+        // The optimized ops.
+        OpRcPtrVec m_ops;
+        // The CPU op of each optimized op or null for dynamic ops (as the dynamic properties are
+        // decoupled for each CPU processor instance).
+        ConstOpCPURcPtrVec m_cpuOps;
+    };
+
+    struct Segments
+    {
+        Segment m_prefix;
+        Segment m_suffix;
+    };
+
+    Mutex m_mutex;
+    // The segments for each combination of bit-depths and optimization flags.
+    std::map<std::size_t, Segments> m_segments;
+};
+
+typedef OCIO_SHARED_PTR<ProcessorPatch> ProcessorPatchRcPtr;
+
 class Processor::Impl
 {
 private:
@@ -29,6 +62,9 @@ private:
 
     ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
 
+    // Only set for the processors created by createPatchedProcessor().
+    ProcessorPatchRcPtr m_patch;
+
     // Speedup GPU & CPU Processor accesses by using a cache.
     mutable ProcessorCache<std::size_t, ProcessorRcPtr>    m_optProcessorCache;
     mutable ProcessorCache<std::size_t, GPUProcessorRcPtr> m_gpuProcessorCache;
@@ -43,6 +79,9 @@ public:
     bool isNoOp() const;
     bool hasChannelCrosstalk() const;
 
+    // Estimation of the memory used by the ops (mainly the LUT values).
+    size_t getMemorySize() const;
+
     ConstProcessorMetadataRcPtr getProcessorMetadata() const;
 
     const FormatMetadata & getFormatMetadata() const;
@@ -64,6 +103,9 @@ public:
                                               BitDepth outBD,
                                               OptimizationFlags oFlags) const;
 
+    ConstProcessorRcPtr createPatchedProcessor(int index,
+                                               const ConstTransformRcPtr & transform) const;
+
     // Get an optimized GPU processor instance for F32 images with default optimizations.
     ConstGPUProcessorRcPtr getDefaultGPUProcessor() const;
 
@@ -108,6 +150,13 @@ public:
 protected:
     ConstGPUProcessorRcPtr getGPUProcessor(const OpRcPtrVec & gpuOps,
                                            OptimizationFlags oFlags) const;
+
+    // Get the optimized ops with the CPU op of each op to reuse (or null) for a patched processor.
+    void getPatchedOps(OpRcPtrVec & ops,
+                       ConstOpCPURcPtrVec & cpuOps,
+                       BitDepth inBitDepth,
+                       BitDepth outBitDepth,
+                       OptimizationFlags oFlags) const;
 };
 
 } // namespace OCIO_NAMESPACE
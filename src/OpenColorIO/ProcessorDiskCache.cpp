@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include <pystring.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "fileformats/FileFormatBinaryOps.h"
+#include "HashUtils.h"
+#include "Logging.h"
+#include "Mutex.h"
+#include "Platform.h"
+#include "ProcessorDiskCache.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+Mutex g_diskCacheMutex;
+std::string g_diskCacheDirectory;
+bool g_diskCacheInitialized = false;
+
+// Initialize the directory from the env. variable on first use. The mutex must be locked.
+void InitializeDiskCacheDirectory()
+{
+    if (!g_diskCacheInitialized)
+    {
+        Platform::Getenv(OCIO_PROCESSOR_DISK_CACHE_DIR, g_diskCacheDirectory);
+        g_diskCacheInitialized = true;
+    }
+}
+
+std::string GetDiskCacheDirectory()
+{
+    static const bool envDisableAllCaches = Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES);
+    if (envDisableAllCaches)
+    {
+        return "";
+    }
+
+    AutoMutex lock(g_diskCacheMutex);
+    InitializeDiskCacheDirectory();
+    return g_diskCacheDirectory;
+}
+
+bool LoadOps(OpRcPtrVec & ops, const std::string & filename)
+{
+    std::ifstream istream = Platform::CreateInputFileStream(filename.c_str(),
+                                                            std::ios_base::in | std::ios_base::binary);
+    if (!istream.good())
+    {
+        return false;
+    }
+
+    try
+    {
+        OpRcPtrVec loadedOps;
+        ReadOpsFromBinary(loadedOps, istream, filename);
+        loadedOps.finalize();
+
+        loadedOps.getFormatMetadata() = ops.getFormatMetadata();
+        ops = loadedOps;
+        return true;
+    }
+    catch (const std::exception & ex)
+    {
+        std::ostringstream oss;
+        oss << "Ignoring the on-disk processor cache file '" << filename << "': " << ex.what();
+        LogDebug(oss.str());
+    }
+
+    return false;
+}
+
+void SaveOps(const OpRcPtrVec & ops, const std::string & filename)
+{
+    // Write to a unique temporary file in the same directory and then rename it, so that
+    // concurrent processes never read a partially written file.
+    std::random_device rd;
+    std::ostringstream tmp;
+    tmp << filename << "." << std::hex << rd()
+        << std::hash<std::thread::id>{}(std::this_thread::get_id()) << ".tmp";
+    const std::string tmpFilename = tmp.str();
+
+    try
+    {
+        {
+            std::ofstream ostream(Platform::filenameToUTF(tmpFilename).c_str(),
+                                  std::ios_base::out | std::ios_base::binary);
+            if (!ostream.good())
+            {
+                return;
+            }
+
+            WriteOpsToBinary(ops, ostream);
+
+            ostream.close();
+            if (ostream.fail())
+            {
+                throw Exception("Could not write the file.");
+            }
+        }
+
+        if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)
+        {
+            // Another process may have already saved the same ops.
+            std::remove(tmpFilename.c_str());
+        }
+    }
+    catch (const std::exception & ex)
+    {
+        std::remove(tmpFilename.c_str());
+
+        std::ostringstream oss;
+        oss << "Could not save the on-disk processor cache file '" << filename << "': "
+            << ex.what();
+        LogDebug(oss.str());
+    }
+}
+
+} // anon.
+
+void SetProcessorDiskCacheDirectory(const char * dirname)
+{
+    AutoMutex lock(g_diskCacheMutex);
+    g_diskCacheDirectory   = dirname ? dirname : "";
+    g_diskCacheInitialized = true;
+}
+
+std::string GetProcessorDiskCacheDirectory()
+{
+    // Copy the directory under the lock as another thread could change it.
+    AutoMutex lock(g_diskCacheMutex);
+    InitializeDiskCacheDirectory();
+    return g_diskCacheDirectory;
+}
+
+std::string GetProcessorDiskCacheKey(const OpRcPtrVec & ops,
+                                     BitDepth in, BitDepth out,
+                                     OptimizationFlags oFlags)
+{
+    // Dynamic properties can not be saved as their values would be frozen.
+    if (ops.empty() || ops.isDynamic())
+    {
+        return "";
+    }
+
+    // The inverse 3D LUT grid size changes the optimized ops of inverse 3D LUTs.
+    std::ostringstream oss;
+    oss << GetVersion() << " " << ops.getCacheID() << " " << in << " " << out
+        << " " << GetInverseLut3DGridSize() << " " << std::hex << oFlags;
+
+    const std::string fullstr = oss.str();
+    return CacheIDHash(fullstr.c_str(), fullstr.size());
+}
+
+void OptimizeFinalizedOps(OpRcPtrVec & ops, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                          bool useDiskCache)
+{
+    const std::string dirname = useDiskCache ? GetDiskCacheDirectory() : std::string();
+
+    std::string filename;
+    if (!dirname.empty())
+    {
+        const std::string key = GetProcessorDiskCacheKey(ops, in, out, oFlags);
+        if (!key.empty())
+        {
+            filename = pystring::os::path::join(dirname, key + ".ociob");
+            if (LoadOps(ops, filename))
+            {
+                return;
+            }
+        }
+    }
+
+    ops.optimize(oFlags);
+    ops.optimizeForBitdepth(in, out, oFlags);
+
+    if (!filename.empty() && !ops.empty())
+    {
+        SaveOps(ops, filename);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
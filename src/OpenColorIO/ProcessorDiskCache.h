@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PROCESSORDISKCACHE_H
+#define INCLUDED_OCIO_PROCESSORDISKCACHE_H
+
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Compute the on-disk cache key of finalized ops once optimized for the bit-depths and flags.
+// An empty key means the ops can not be cached to disk.
+std::string GetProcessorDiskCacheKey(const OpRcPtrVec & ops,
+                                     BitDepth in, BitDepth out,
+                                     OptimizationFlags oFlags);
+
+// Optimize the finalized ops (i.e. optimize() then optimizeForBitdepth()). When the on-disk
+// processor cache is enabled, the optimized ops are loaded from a previous process launch if
+// available, otherwise they are saved for the next ones. Any disk cache error silently falls
+// back to the regular optimization. The disk cache is skipped when useDiskCache is false.
+void OptimizeFinalizedOps(OpRcPtrVec & ops, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                          bool useDiskCache = true);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_PROCESSORDISKCACHE_H
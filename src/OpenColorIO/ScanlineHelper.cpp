@@ -43,6 +43,7 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
     ,   m_useDstBuffer(false)
 {
 }
@@ -60,6 +61,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
         throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
 
+    m_yEnd = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = GetOptimizationMode(m_dstImg);
 
@@ -89,6 +92,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
 
@@ -98,8 +103,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
 
     if(!m_useDstBuffer)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
+        // Note that the CPUProcessor reuses the scanline helpers across apply calls
+        // so the resize only allocates when the image gets wider.
 
         const long bufferSize = 4 * m_dstImg.m_width;
 
@@ -109,6 +114,18 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     }
 }
 
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setScanlineRange(long yBegin, long yEnd)
+{
+    if(yBegin<0 || yBegin>yEnd || yEnd>m_dstImg.m_height)
+    {
+        throw Exception("Invalid scanline range.");
+    }
+
+    m_yIndex = int(yBegin);
+    m_yEnd   = yEnd;
+}
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 {
@@ -120,7 +137,7 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
 {
     // Note that only a line-by-line processing is done on the image buffer.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
@@ -37,6 +37,10 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Restrict the processing to the [yBegin, yEnd) scanlines of the image. It must be
+    // called after init() which selects all the scanlines.
+    virtual void setScanlineRange(long yBegin, long yEnd) = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
@@ -56,6 +60,8 @@ public:
     void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override;
     void init(const ImageDesc & img) override;
 
+    void setScanlineRange(long yBegin, long yEnd) override;
+
     ~GenericScanlineHelper() override;
 
     // Copy from the src image to our scanline, in our preferred
@@ -91,6 +97,9 @@ private:
     // The index of the current line to process.
     int m_yIndex;
 
+    // The index of the line after the last one to process.
+    long m_yEnd;
+
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
     // and m_outBitDepthBuffer).
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ThreadUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+unsigned GetNumThreads(unsigned numThreads)
+{
+    if (numThreads == 0)
+    {
+        // Note that hardware_concurrency() could return 0 if the value is not computable.
+        numThreads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(numThreads, 1u);
+}
+
+unsigned GetNumThreadsForItems(long numItems, long minItemsPerThread)
+{
+    const long maxThreads = numItems / std::max(minItemsPerThread, 1L);
+    return unsigned(std::max(1L, std::min(long(GetNumThreads(0)), maxThreads)));
+}
+
+void ParallelFor(unsigned numThreads, long numItems, const std::function<void(long, long)> & fn)
+{
+    if (numItems <= 0)
+    {
+        return;
+    }
+
+    const long numChunks = std::min(long(GetNumThreads(numThreads)), numItems);
+
+    if (numChunks == 1)
+    {
+        fn(0, numItems);
+        return;
+    }
+
+    // Distribute the remainder over the first chunks so that sizes differ by at most one item.
+    const long chunkSize = numItems / numChunks;
+    const long remainder = numItems % numChunks;
+
+    auto chunkBegin = [chunkSize, remainder](long chunk) -> long
+    {
+        return chunk * chunkSize + std::min(chunk, remainder);
+    };
+
+    Mutex mutex;
+    std::exception_ptr firstException;
+
+    auto processChunk = [&](long chunk)
+    {
+        try
+        {
+            fn(chunkBegin(chunk), chunkBegin(chunk + 1));
+        }
+        catch (...)
+        {
+            AutoMutex lock(mutex);
+            if (!firstException)
+            {
+                firstException = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks - 1);
+
+    long chunk = 1;
+    try
+    {
+        for (; chunk < numChunks; ++chunk)
+        {
+            threads.emplace_back(processChunk, chunk);
+        }
+    }
+    catch (...)
+    {
+        // The system could not create more threads so the calling thread processes
+        // the remaining chunks.
+    }
+
+    processChunk(0);
+
+    for (; chunk < numChunks; ++chunk)
+    {
+        processChunk(chunk);
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADUTILS_H
+#define INCLUDED_OCIO_THREADUTILS_H
+
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Returns the number of threads to use for a requested number of threads, where zero means
+// all the hardware threads. The result is always at least one.
+unsigned GetNumThreads(unsigned numThreads);
+
+// Returns the number of threads to use for processing numItems with all the hardware threads,
+// while giving each thread at least minItemsPerThread items. The result is always at least one.
+unsigned GetNumThreadsForItems(long numItems, long minItemsPerThread);
+
+// Splits the [0, numItems) range into at most numThreads contiguous chunks and calls
+// fn(begin, end) for each of them from its own thread. The calling thread processes the first
+// chunk. Once all the threads are joined, the first exception thrown by any chunk is rethrown.
+void ParallelFor(unsigned numThreads, long numItems, const std::function<void(long, long)> & fn);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
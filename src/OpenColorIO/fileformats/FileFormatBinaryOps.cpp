@@ -0,0 +1,734 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "fileformats/FileFormatBinaryOps.h"
+#include "fileformats/FileFormatCTF.h"
+#include "fileformats/FormatMetadata.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "OpBuilders.h"
+#include "Platform.h"
+#include "transforms/FileTransform.h"
+
+
+/*
+
+The OCIO binary op list is a compact, versioned container of an op list, mainly intended to
+persist optimized processors and baked LUT packs. Reading it is I/O-bound: the LUT values are
+stored as raw 32-bit floats in the in-memory layout of the Lut1DOpData and Lut3DOpData arrays
+(i.e. no text parsing), starting on a 64-byte boundary so that the blocks of a memory-mapped
+file are suitably aligned for the SIMD renderers.
+
+All values use the native byte order, which is recorded in the header. The layout is:
+
+    char[8]   magic "OCIOBOPS"
+    uint32    version
+    uint32    byte order marker 0x01020304
+    metadata  processor metadata
+    uint32    number of records
+    records
+
+where a record starts with a uint32 type:
+
+    RECORD_CTF:    uint64 size, followed by a CTF document holding the op (used for all the
+                   ops without an array), written with enough digits to restore the op
+                   parameters exactly.
+    RECORD_LUT1D:  metadata, uint32 interpolation, direction, half flags, hue adjust,
+                   file output bit-depth, length and number of color components,
+                   padding to 64 bytes, then float[length * 3].
+    RECORD_LUT3D:  metadata, uint32 interpolation, direction, file output bit-depth and
+                   grid size, padding to 64 bytes, then float[gridSize^3 * 3] (blue-fastest).
+    RECORD_MATRIX: metadata, uint32 direction, file input and output bit-depths, then
+                   double[16] coefficients and double[4] offsets.
+
+A string is a uint32 size followed by the characters, and a metadata is its name, value,
+uint32 number of attributes, the attribute (name, value) pairs, uint32 number of children and
+the children metadata.
+
+*/
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+constexpr char BINARY_OPS_MAGIC[8] = { 'O', 'C', 'I', 'O', 'B', 'O', 'P', 'S' };
+constexpr uint32_t BINARY_OPS_VERSION = 1;
+constexpr uint32_t BINARY_OPS_BYTE_ORDER = 0x01020304;
+constexpr size_t BINARY_OPS_ARRAY_ALIGNMENT = 64;
+
+// Limits used to reject corrupted files before allocating memory.
+constexpr uint32_t BINARY_OPS_MAX_LUT1D_LENGTH = 1024 * 1024;
+constexpr unsigned BINARY_OPS_MAX_METADATA_DEPTH = 64;
+
+enum RecordType : uint32_t
+{
+    RECORD_CTF    = 0,
+    RECORD_LUT1D  = 1,
+    RECORD_LUT3D  = 2,
+    RECORD_MATRIX = 3
+};
+
+class BinaryWriter
+{
+public:
+    BinaryWriter() = delete;
+    BinaryWriter(const BinaryWriter &) = delete;
+    BinaryWriter & operator=(const BinaryWriter &) = delete;
+
+    explicit BinaryWriter(std::ostream & ostream)
+        : m_ostream(ostream)
+    {
+    }
+
+    void writeBytes(const void * data, size_t size)
+    {
+        m_ostream.write(reinterpret_cast<const char *>(data), size);
+        m_offset += size;
+    }
+
+    void writeUInt32(uint32_t value) { writeBytes(&value, sizeof(value)); }
+    void writeUInt64(uint64_t value) { writeBytes(&value, sizeof(value)); }
+
+    void writeString(const std::string & str)
+    {
+        writeUInt32(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+    void writeMetadata(const FormatMetadata & metadata)
+    {
+        writeString(metadata.getElementName());
+        writeString(metadata.getElementValue());
+
+        const int numAttributes = metadata.getNumAttributes();
+        writeUInt32(static_cast<uint32_t>(numAttributes));
+        for (int i = 0; i < numAttributes; ++i)
+        {
+            writeString(metadata.getAttributeName(i));
+            writeString(metadata.getAttributeValue(i));
+        }
+
+        const int numChildren = metadata.getNumChildrenElements();
+        writeUInt32(static_cast<uint32_t>(numChildren));
+        for (int i = 0; i < numChildren; ++i)
+        {
+            writeMetadata(metadata.getChildElement(i));
+        }
+    }
+
+    // Pad with zeros up to the next array boundary.
+    void align()
+    {
+        static const char zeros[BINARY_OPS_ARRAY_ALIGNMENT] = { 0 };
+        const size_t remainder = m_offset % BINARY_OPS_ARRAY_ALIGNMENT;
+        if (remainder)
+        {
+            writeBytes(zeros, BINARY_OPS_ARRAY_ALIGNMENT - remainder);
+        }
+    }
+
+private:
+    std::ostream & m_ostream;
+    size_t m_offset = 0;
+};
+
+class BinaryReader
+{
+public:
+    BinaryReader() = delete;
+    BinaryReader(const BinaryReader &) = delete;
+    BinaryReader & operator=(const BinaryReader &) = delete;
+
+    BinaryReader(std::istream & istream, const std::string & filePath)
+        : m_istream(istream)
+        , m_filePath(filePath)
+    {
+    }
+
+    [[noreturn]] void throwError(const std::string & error) const
+    {
+        std::ostringstream oss;
+        oss << "Error parsing OCIO binary op list (" << m_filePath << "). " << error;
+        throw Exception(oss.str().c_str());
+    }
+
+    void readBytes(void * data, size_t size)
+    {
+        m_istream.read(reinterpret_cast<char *>(data), size);
+        if (static_cast<size_t>(m_istream.gcount()) != size)
+        {
+            throwError("Unexpected end of file.");
+        }
+        m_offset += size;
+    }
+
+    uint32_t readUInt32()
+    {
+        uint32_t value = 0;
+        readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t readUInt64()
+    {
+        uint64_t value = 0;
+        readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    // Read in chunks so that a corrupted size fails at the end of the file rather than
+    // allocating a huge buffer.
+    std::string readString(uint64_t size)
+    {
+        std::string str;
+        char chunk[4096];
+        while (size > 0)
+        {
+            const size_t len = static_cast<size_t>(std::min<uint64_t>(size, sizeof(chunk)));
+            readBytes(chunk, len);
+            str.append(chunk, len);
+            size -= len;
+        }
+        return str;
+    }
+
+    std::string readString() { return readString(readUInt32()); }
+
+    void readMetadata(FormatMetadata & metadata, unsigned depth = 0)
+    {
+        if (depth > BINARY_OPS_MAX_METADATA_DEPTH)
+        {
+            throwError("Too many nested metadata elements.");
+        }
+
+        // The root element has a reserved name and no value.
+        const std::string name  = readString();
+        const std::string value = readString();
+        if (depth > 0)
+        {
+            metadata.setElementName(name.c_str());
+            metadata.setElementValue(value.c_str());
+        }
+
+        const uint32_t numAttributes = readUInt32();
+        for (uint32_t i = 0; i < numAttributes; ++i)
+        {
+            const std::string name = readString();
+            const std::string value = readString();
+            metadata.addAttribute(name.c_str(), value.c_str());
+        }
+
+        const uint32_t numChildren = readUInt32();
+        for (uint32_t i = 0; i < numChildren; ++i)
+        {
+            metadata.addChildElement("tmp", "");
+            readMetadata(metadata.getChildElement(metadata.getNumChildrenElements() - 1),
+                         depth + 1);
+        }
+    }
+
+    void align()
+    {
+        const size_t remainder = m_offset % BINARY_OPS_ARRAY_ALIGNMENT;
+        if (remainder)
+        {
+            char padding[BINARY_OPS_ARRAY_ALIGNMENT];
+            readBytes(padding, BINARY_OPS_ARRAY_ALIGNMENT - remainder);
+        }
+    }
+
+    TransformDirection readDirection()
+    {
+        const uint32_t dir = readUInt32();
+        if (dir != TRANSFORM_DIR_FORWARD && dir != TRANSFORM_DIR_INVERSE)
+        {
+            throwError("Invalid transform direction.");
+        }
+        return static_cast<TransformDirection>(dir);
+    }
+
+    // Read an enumeration value, throwing if it is not one of the valid values.
+    template<typename T>
+    T readEnum(std::initializer_list<T> validValues, const char * name)
+    {
+        const uint32_t value = readUInt32();
+        for (const T validValue : validValues)
+        {
+            if (value == static_cast<uint32_t>(validValue))
+            {
+                return validValue;
+            }
+        }
+
+        std::ostringstream oss;
+        oss << "Invalid " << name << " " << value << ".";
+        throwError(oss.str());
+    }
+
+    Interpolation readInterpolation()
+    {
+        return readEnum({ INTERP_UNKNOWN, INTERP_NEAREST, INTERP_LINEAR, INTERP_TETRAHEDRAL,
+                          INTERP_CUBIC, INTERP_DEFAULT, INTERP_BEST },
+                        "interpolation");
+    }
+
+    BitDepth readBitDepth()
+    {
+        return readEnum({ BIT_DEPTH_UNKNOWN, BIT_DEPTH_UINT8, BIT_DEPTH_UINT10, BIT_DEPTH_UINT12,
+                          BIT_DEPTH_UINT14, BIT_DEPTH_UINT16, BIT_DEPTH_UINT32, BIT_DEPTH_F16,
+                          BIT_DEPTH_F32 },
+                        "bit-depth");
+    }
+
+    const std::string & getFilePath() const { return m_filePath; }
+
+private:
+    std::istream & m_istream;
+    const std::string m_filePath;
+    size_t m_offset = 0;
+};
+
+void WriteLut1D(BinaryWriter & writer, const Lut1DOpData & lut)
+{
+    const auto & array = lut.getArray();
+
+    writer.writeUInt32(RECORD_LUT1D);
+    writer.writeMetadata(lut.getFormatMetadata());
+    writer.writeUInt32(static_cast<uint32_t>(lut.getInterpolation()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getDirection()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getHalfFlags()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getHueAdjust()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getFileOutputBitDepth()));
+    writer.writeUInt32(static_cast<uint32_t>(array.getLength()));
+    writer.writeUInt32(static_cast<uint32_t>(array.getNumColorComponents()));
+
+    writer.align();
+    writer.writeBytes(array.getValues().data(), array.getValues().size() * sizeof(float));
+}
+
+ConstOpDataRcPtr ReadLut1D(BinaryReader & reader)
+{
+    FormatMetadataImpl metadata;
+    reader.readMetadata(metadata);
+
+    const auto interpolation    = reader.readInterpolation();
+    const auto direction        = reader.readDirection();
+    const auto halfFlags        = reader.readEnum({ Lut1DOpData::LUT_STANDARD,
+                                                    Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                    Lut1DOpData::LUT_OUTPUT_HALF_CODE,
+                                                    Lut1DOpData::LUT_INPUT_OUTPUT_HALF_CODE },
+                                                  "LUT 1D half flags");
+    const auto hueAdjust        = reader.readEnum({ HUE_NONE, HUE_DW3, HUE_WYPN },
+                                                  "LUT 1D hue adjust");
+    const auto fileOutBitDepth  = reader.readBitDepth();
+    const uint32_t length       = reader.readUInt32();
+    const uint32_t numComponents = reader.readUInt32();
+
+    if (length < 2 || length > BINARY_OPS_MAX_LUT1D_LENGTH)
+    {
+        reader.throwError("Invalid LUT 1D length.");
+    }
+    if (numComponents != 1 && numComponents != 3)
+    {
+        reader.throwError("Invalid LUT 1D number of color components.");
+    }
+
+    auto lut = std::make_shared<Lut1DOpData>(halfFlags, length, false);
+    lut->getFormatMetadata() = metadata;
+    lut->setInterpolation(interpolation);
+    lut->setDirection(direction);
+    lut->setHueAdjust(hueAdjust);
+    lut->setFileOutputBitDepth(fileOutBitDepth);
+
+    auto & array = lut->getArray();
+    array.setNumColorComponents(numComponents);
+
+    reader.align();
+    reader.readBytes(array.getValues().data(), array.getValues().size() * sizeof(float));
+
+    return lut;
+}
+
+void WriteLut3D(BinaryWriter & writer, const Lut3DOpData & lut)
+{
+    writer.writeUInt32(RECORD_LUT3D);
+    writer.writeMetadata(lut.getFormatMetadata());
+    writer.writeUInt32(static_cast<uint32_t>(lut.getInterpolation()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getDirection()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getFileOutputBitDepth()));
+    writer.writeUInt32(static_cast<uint32_t>(lut.getGridSize()));
+
+    const auto & values = lut.getArray().getValues();
+    writer.align();
+    writer.writeBytes(values.data(), values.size() * sizeof(float));
+}
+
+ConstOpDataRcPtr ReadLut3D(BinaryReader & reader)
+{
+    FormatMetadataImpl metadata;
+    reader.readMetadata(metadata);
+
+    const auto interpolation   = reader.readInterpolation();
+    const auto direction       = reader.readDirection();
+    const auto fileOutBitDepth = reader.readBitDepth();
+    const uint32_t gridSize    = reader.readUInt32();
+
+    if (gridSize < 2 || gridSize > Lut3DOpData::maxSupportedLength)
+    {
+        reader.throwError("Invalid LUT 3D grid size.");
+    }
+
+    auto lut = std::make_shared<Lut3DOpData>(interpolation, gridSize);
+    lut->getFormatMetadata() = metadata;
+    lut->setDirection(direction);
+    lut->setFileOutputBitDepth(fileOutBitDepth);
+
+    auto & values = lut->getArray().getValues();
+    reader.align();
+    reader.readBytes(values.data(), values.size() * sizeof(float));
+
+    return lut;
+}
+
+void WriteMatrix(BinaryWriter & writer, const MatrixOpData & matrix)
+{
+    writer.writeUInt32(RECORD_MATRIX);
+    writer.writeMetadata(matrix.getFormatMetadata());
+    writer.writeUInt32(static_cast<uint32_t>(matrix.getDirection()));
+    writer.writeUInt32(static_cast<uint32_t>(matrix.getFileInputBitDepth()));
+    writer.writeUInt32(static_cast<uint32_t>(matrix.getFileOutputBitDepth()));
+
+    const auto & values = matrix.getArray().getValues();
+    writer.writeBytes(values.data(), values.size() * sizeof(double));
+    writer.writeBytes(matrix.getOffsets().getValues(), 4 * sizeof(double));
+}
+
+ConstOpDataRcPtr ReadMatrix(BinaryReader & reader)
+{
+    FormatMetadataImpl metadata;
+    reader.readMetadata(metadata);
+
+    const auto direction      = reader.readDirection();
+    const auto fileInBitDepth  = reader.readBitDepth();
+    const auto fileOutBitDepth = reader.readBitDepth();
+
+    auto matrix = std::make_shared<MatrixOpData>(direction);
+    matrix->getFormatMetadata() = metadata;
+    matrix->setFileInputBitDepth(fileInBitDepth);
+    matrix->setFileOutputBitDepth(fileOutBitDepth);
+
+    auto & values = matrix->getArray().getValues();
+    reader.readBytes(values.data(), values.size() * sizeof(double));
+    reader.readBytes(matrix->getOffsets().getValues(), 4 * sizeof(double));
+
+    return matrix;
+}
+
+void WriteCTF(BinaryWriter & writer, const Op & op)
+{
+    OpRcPtrVec ops;
+    ops.push_back(op.clone());
+
+    std::ostringstream oss;
+    WriteOpsToCTF(ops, oss);
+    const std::string ctf = oss.str();
+
+    writer.writeUInt32(RECORD_CTF);
+    writer.writeUInt64(ctf.size());
+    writer.writeBytes(ctf.data(), ctf.size());
+}
+
+void ReadCTF(BinaryReader & reader, ConstOpDataVec & opDataVec)
+{
+    std::istringstream iss(reader.readString(reader.readUInt64()));
+
+    ConstOpDataVec ctfOps;
+    ReadOpDataFromCTF(ctfOps, iss, reader.getFilePath());
+    if (ctfOps.size() != 1)
+    {
+        reader.throwError("Expecting one op per CTF record.");
+    }
+    opDataVec.push_back(ctfOps[0]);
+}
+
+void WriteBinary(const OpRcPtrVec & ops, std::ostream & ostream)
+{
+    BinaryWriter writer(ostream);
+
+    writer.writeBytes(BINARY_OPS_MAGIC, sizeof(BINARY_OPS_MAGIC));
+    writer.writeUInt32(BINARY_OPS_VERSION);
+    writer.writeUInt32(BINARY_OPS_BYTE_ORDER);
+    writer.writeMetadata(ops.getFormatMetadata());
+
+    // No-ops (e.g. allocation or file no-ops) do not have any representation.
+    uint32_t numOps = 0;
+    for (ConstOpRcPtr op : ops)
+    {
+        if (op->data()->getType() != OpData::NoOpType)
+        {
+            ++numOps;
+        }
+    }
+    writer.writeUInt32(numOps);
+
+    for (ConstOpRcPtr op : ops)
+    {
+        ConstOpDataRcPtr data = op->data();
+        switch (data->getType())
+        {
+        case OpData::NoOpType:
+            break;
+        case OpData::Lut1DType:
+            WriteLut1D(writer, *OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data));
+            break;
+        case OpData::Lut3DType:
+            WriteLut3D(writer, *OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data));
+            break;
+        case OpData::MatrixType:
+            WriteMatrix(writer, *OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(data));
+            break;
+        case OpData::CDLType:
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::GradingPrimaryType:
+        case OpData::GradingRGBCurveType:
+        case OpData::GradingHueCurveType:
+        case OpData::GradingToneType:
+        case OpData::LogType:
+        case OpData::RangeType:
+        case OpData::ReferenceType:
+            WriteCTF(writer, *op);
+            break;
+        }
+    }
+
+    if (!ostream.good())
+    {
+        throw Exception("Error writing OCIO binary op list.");
+    }
+}
+
+void ReadBinary(std::istream & istream,
+                const std::string & filePath,
+                ConstOpDataVec & opDataVec,
+                FormatMetadataImpl & metadata)
+{
+    BinaryReader reader(istream, filePath);
+
+    char magic[sizeof(BINARY_OPS_MAGIC)];
+    reader.readBytes(magic, sizeof(magic));
+    if (memcmp(magic, BINARY_OPS_MAGIC, sizeof(magic)) != 0)
+    {
+        reader.throwError("Not an OCIO binary op list.");
+    }
+
+    const uint32_t version = reader.readUInt32();
+    if (version != BINARY_OPS_VERSION)
+    {
+        std::ostringstream oss;
+        oss << "Unsupported version " << version << ".";
+        reader.throwError(oss.str());
+    }
+
+    if (reader.readUInt32() != BINARY_OPS_BYTE_ORDER)
+    {
+        reader.throwError("Unsupported byte order.");
+    }
+
+    reader.readMetadata(metadata);
+
+    const uint32_t numOps = reader.readUInt32();
+    for (uint32_t i = 0; i < numOps; ++i)
+    {
+        const uint32_t type = reader.readUInt32();
+        switch (type)
+        {
+        case RECORD_CTF:
+            ReadCTF(reader, opDataVec);
+            break;
+        case RECORD_LUT1D:
+            opDataVec.push_back(ReadLut1D(reader));
+            break;
+        case RECORD_LUT3D:
+            opDataVec.push_back(ReadLut3D(reader));
+            break;
+        case RECORD_MATRIX:
+            opDataVec.push_back(ReadMatrix(reader));
+            break;
+        default:
+        {
+            std::ostringstream oss;
+            oss << "Unknown record type " << type << ".";
+            reader.throwError(oss.str());
+        }
+        }
+    }
+}
+
+class LocalCachedFile : public CachedFile
+{
+public:
+    LocalCachedFile() = default;
+    ~LocalCachedFile() = default;
+
+    ConstOpDataVec m_opDataVec;
+    FormatMetadataImpl m_metadata;
+};
+
+typedef OCIO_SHARED_PTR<LocalCachedFile> LocalCachedFileRcPtr;
+
+class LocalFileFormat : public FileFormat
+{
+public:
+    LocalFileFormat() = default;
+    ~LocalFileFormat() = default;
+
+    void getFormatInfo(FormatInfoVec & formatInfoVec) const override;
+
+    CachedFileRcPtr read(std::istream & istream,
+                         const std::string & fileName,
+                         Interpolation interp) const override;
+
+    void write(const ConstConfigRcPtr & config,
+               const ConstContextRcPtr & context,
+               const GroupTransform & group,
+               const std::string & formatName,
+               std::ostream & ostream) const override;
+
+    void buildFileOps(OpRcPtrVec & ops,
+                      const Config & config,
+                      const ConstContextRcPtr & context,
+                      CachedFileRcPtr untypedCachedFile,
+                      const FileTransform & fileTransform,
+                      TransformDirection dir) const override;
+
+    bool isBinary() const override
+    {
+        return true;
+    }
+};
+
+void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
+{
+    FormatInfo info;
+    info.name = FILEFORMAT_BINARY_OPS;
+    info.extension = "ociob";
+    info.capabilities = FormatCapabilityFlags(FORMAT_CAPABILITY_READ | FORMAT_CAPABILITY_WRITE);
+    formatInfoVec.push_back(info);
+}
+
+CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
+                                      const std::string & fileName,
+                                      Interpolation /*interp*/) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    ReadBinary(istream, fileName, cachedFile->m_opDataVec, cachedFile->m_metadata);
+    return cachedFile;
+}
+
+void LocalFileFormat::write(const ConstConfigRcPtr & config,
+                            const ConstContextRcPtr & context,
+                            const GroupTransform & group,
+                            const std::string & formatName,
+                            std::ostream & ostream) const
+{
+    if (Platform::Strcasecmp(formatName.c_str(), FILEFORMAT_BINARY_OPS) != 0)
+    {
+        std::ostringstream os;
+        os << "Error: OCIO binary op list writer does not also write format " << formatName << ".";
+        throw Exception(os.str().c_str());
+    }
+
+    OpRcPtrVec ops;
+    BuildGroupOps(ops, *config, context, group, TRANSFORM_DIR_FORWARD);
+
+    ops.finalize();
+
+    // Call optimize to remove no-op types (e.g., allocation, file no-ops).
+    ops.optimize(OPTIMIZATION_NONE);
+
+    ops.getFormatMetadata() = group.getFormatMetadata();
+
+    WriteBinary(ops, ostream);
+}
+
+void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
+                                   const Config & /*config*/,
+                                   const ConstContextRcPtr & /*context*/,
+                                   CachedFileRcPtr untypedCachedFile,
+                                   const FileTransform & fileTransform,
+                                   TransformDirection dir) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+
+    // This should never happen.
+    if (!cachedFile)
+    {
+        throw Exception("Cannot build OCIO binary op list ops. Invalid cache type.");
+    }
+
+    ops.getFormatMetadata().combine(cachedFile->m_metadata);
+
+    const auto newDir = CombineTransformDirections(dir, fileTransform.getDirection());
+    const ConstOpDataVec & opDataVec = cachedFile->m_opDataVec;
+
+    switch (newDir)
+    {
+    case TRANSFORM_DIR_FORWARD:
+    {
+        for (const auto & opData : opDataVec)
+        {
+            CreateOpVecFromOpData(ops, opData, newDir);
+        }
+        break;
+    }
+    case TRANSFORM_DIR_INVERSE:
+    {
+        for (int idx = (int)opDataVec.size() - 1; idx >= 0; --idx)
+        {
+            CreateOpVecFromOpData(ops, opDataVec[idx], newDir);
+        }
+        break;
+    }
+    }
+}
+
+} // anonymous namespace.
+
+FileFormat * CreateFileFormatBinaryOps()
+{
+    return new LocalFileFormat();
+}
+
+void WriteOpsToBinary(const OpRcPtrVec & ops, std::ostream & ostream)
+{
+    WriteBinary(ops, ostream);
+}
+
+void ReadOpsFromBinary(OpRcPtrVec & ops, std::istream & istream, const std::string & filePath)
+{
+    ConstOpDataVec opDataVec;
+    FormatMetadataImpl metadata;
+    ReadBinary(istream, filePath, opDataVec, metadata);
+
+    ops.getFormatMetadata() = metadata;
+    for (const auto & opData : opDataVec)
+    {
+        CreateOpVecFromOpData(ops, opData, TRANSFORM_DIR_FORWARD);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
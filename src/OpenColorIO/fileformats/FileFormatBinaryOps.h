@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FILE_FORMAT_BINARY_OPS_H
+#define INCLUDED_OCIO_FILE_FORMAT_BINARY_OPS_H
+
+#include <iostream>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Write finalized ops as an OCIO binary op list. Throws if an op can not be written.
+void WriteOpsToBinary(const OpRcPtrVec & ops, std::ostream & ostream);
+
+// Read an OCIO binary op list and append its ops. The ops are not finalized. Throws on
+// parsing errors.
+void ReadOpsFromBinary(OpRcPtrVec & ops, std::istream & istream, const std::string & filePath);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_FILE_FORMAT_BINARY_OPS_H
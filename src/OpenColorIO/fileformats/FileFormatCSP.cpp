@@ -708,7 +708,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     std::vector<float> shaperInData;
     std::vector<float> shaperOutData;
@@ -732,7 +731,7 @@ void LocalFileFormat::bake(const Baker & baker,
         shaperToInput->apply(shaperInImg);
 
         ConstCPUProcessorRcPtr shaperToTarget = GetShaperToTargetProcessor(baker);
-        shaperToTarget->apply(cubeImg);
+        ApplyToLutEntries(baker, shaperToTarget, cubeData.data(), cubeSize*cubeSize*cubeSize);
     }
     else
     {
@@ -779,11 +778,11 @@ void LocalFileFormat::bake(const Baker & baker,
 
         PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
         shaperToInput->apply(shaperInImg);
-        shaperToInput->apply(cubeImg);
+        ApplyToLutEntries(baker, shaperToInput, cubeData.data(), cubeSize*cubeSize*cubeSize);
 
         // Apply the 3D LUT to the remainder (from the input to the output).
         ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-        inputToTarget->apply(cubeImg);
+        ApplyToLutEntries(baker, inputToTarget, cubeData.data(), cubeSize*cubeSize*cubeSize);
     }
 
     // Write out the file.
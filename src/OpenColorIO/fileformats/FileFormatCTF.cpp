@@ -14,12 +14,14 @@
 #include "fileformats/ctf/CTFTransform.h"
 #include "fileformats/ctf/CTFReaderHelper.h"
 #include "fileformats/ctf/CTFReaderUtils.h"
+#include "fileformats/FileFormatCTF.h"
 #include "fileformats/FileFormatUtils.h"
 #include "fileformats/xmlutils/XMLReaderHelper.h"
 #include "fileformats/xmlutils/XMLReaderUtils.h"
 #include "fileformats/xmlutils/XMLWriterUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOpData.h"
 #include "ops/range/RangeOp.h"
 #include "BakingUtils.h"
 #include "OpBuilders.h"
@@ -1468,7 +1470,6 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         cubeData.resize(cubeSize*cubeSize*cubeSize * 3);
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if (required_lut == CTF_1D_3D)
@@ -1480,7 +1481,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyToLutEntries(baker, cubeProc, cubeData.data(), cubeSize*cubeSize*cubeSize);
     }
 
     //
@@ -1503,8 +1504,7 @@ void LocalFileFormat::bake(const Baker & baker,
             GenerateIdentityLut1D(&onedData[0], onedSize, 3);
         }
 
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        inputToTarget->apply(onedImg);
+        ApplyToLutEntries(baker, inputToTarget, onedData.data(), onedSize);
     }
 
     //
@@ -1598,5 +1598,94 @@ FileFormat * CreateFileFormatCLF()
     return new LocalFileFormat();
 }
 
+void WriteOpsToCTF(const OpRcPtrVec & ops, std::ostream & ostream)
+{
+    CTFReaderTransformPtr transform
+        = std::make_shared<CTFReaderTransform>(ops, ops.getFormatMetadata());
+
+    // Integer file bit-depths would scale and round the array values so always use 32f.
+    for (auto & opData : transform->getOps())
+    {
+        switch (opData->getType())
+        {
+        case OpData::Lut1DType:
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(opData)->clone();
+            lut->setFileOutputBitDepth(BIT_DEPTH_F32);
+            opData = lut;
+            break;
+        }
+        case OpData::Lut3DType:
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(opData)->clone();
+            lut->setFileOutputBitDepth(BIT_DEPTH_F32);
+            opData = lut;
+            break;
+        }
+        case OpData::MatrixType:
+        {
+            auto matrix = OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(opData)->clone();
+            matrix->setFileInputBitDepth(BIT_DEPTH_F32);
+            matrix->setFileOutputBitDepth(BIT_DEPTH_F32);
+            opData = matrix;
+            break;
+        }
+        case OpData::RangeType:
+        {
+            auto range = OCIO_DYNAMIC_POINTER_CAST<const RangeOpData>(opData)->clone();
+            range->setFileInputBitDepth(BIT_DEPTH_F32);
+            range->setFileOutputBitDepth(BIT_DEPTH_F32);
+            opData = range;
+            break;
+        }
+        case OpData::CDLType:
+        case OpData::ExponentType:
+        case OpData::ExposureContrastType:
+        case OpData::FixedFunctionType:
+        case OpData::GammaType:
+        case OpData::GradingPrimaryType:
+        case OpData::GradingRGBCurveType:
+        case OpData::GradingHueCurveType:
+        case OpData::GradingToneType:
+        case OpData::LogType:
+        case OpData::ReferenceType:
+        case OpData::NoOpType:
+            break;
+        }
+    }
+
+    // Write XML Header.
+    ostream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+    XmlFormatter fmt(ostream);
+    fmt.setExactPrecision(true);
+
+    TransformWriter writer(fmt, transform, false);
+    writer.write();
+}
+
+void ReadOpDataFromCTF(ConstOpDataVec & opDataVec,
+                       std::istream & istream,
+                       const std::string & filePath)
+{
+    if (!isLoadableCTF(istream))
+    {
+        std::ostringstream oss;
+        oss << "Parsing error: '" << filePath << "' is not a CTF/CLF file.";
+        throw Exception(oss.str().c_str());
+    }
+
+    XMLParserHelper parser(filePath);
+    parser.Parse(istream);
+
+    for (const auto & opData : parser.getTransform()->getOps())
+    {
+        if (opData->getType() == OpData::ReferenceType)
+        {
+            throw Exception("CTF/CLF parsing error: References can not be resolved without a config.");
+        }
+        opDataVec.push_back(opData);
+    }
+}
+
 
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FILE_FORMAT_CTF_H
+#define INCLUDED_OCIO_FILE_FORMAT_CTF_H
+
+#include <iostream>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Write finalized ops as a CTF document without going through transforms or a config. The
+// array values are always written as 32f, and all the values are written with enough digits
+// to be restored exactly. Throws if an op has no CTF representation.
+void WriteOpsToCTF(const OpRcPtrVec & ops, std::ostream & ostream);
+
+// Read a CTF document and append its op data. Throws on parsing errors or if the document
+// references other files.
+void ReadOpDataFromCTF(ConstOpDataVec & opDataVec,
+                       std::istream & istream,
+                       const std::string & filePath);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_FILE_FORMAT_CTF_H
@@ -669,7 +669,6 @@ void LocalFileFormat::bake(const Baker & baker,
         cubeData.resize(cubeSize*cubeSize*cubeSize*3);
 
         GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
         ConstCPUProcessorRcPtr cubeProc;
         if(required_lut == HDL_3D1D)
@@ -682,7 +681,7 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTarget;
         }
 
-        cubeProc->apply(cubeImg);
+        ApplyToLutEntries(baker, cubeProc, cubeData.data(), cubeSize*cubeSize*cubeSize);
     }
 
 
@@ -703,8 +702,7 @@ void LocalFileFormat::bake(const Baker & baker,
             GenerateIdentityLut1D(&onedData[0], onedSize, 3);
         }
 
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        inputToTarget->apply(onedImg);
+        ApplyToLutEntries(baker, inputToTarget, onedData.data(), onedSize);
     }
 
 
@@ -463,9 +463,8 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToLutEntries(baker, inputToTarget, cubeData.data(), cubeSize*cubeSize*cubeSize);
 
     const auto & metadata = baker.getFormatMetadata();
     const auto nb = metadata.getNumChildrenElements();
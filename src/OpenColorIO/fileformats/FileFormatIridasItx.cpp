@@ -253,11 +253,10 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     cubeData.resize(cubeSize*cubeSize*cubeSize*3);
     GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     // Apply our conversion from the input space to the output space.
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(cubeImg);
+    ApplyToLutEntries(baker, inputToTarget, cubeData.data(), cubeSize*cubeSize*cubeSize);
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -353,9 +353,8 @@ void LocalFileFormat::bake(const Baker & baker,
         GenerateIdentityLut1D(&onedData[0], onedSize, 3);
     }
 
-    PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
     ConstCPUProcessorRcPtr inputToTarget = GetInputToTargetProcessor(baker);
-    inputToTarget->apply(onedImg);
+    ApplyToLutEntries(baker, inputToTarget, onedData.data(), onedSize);
 
     //
     // Write LUT
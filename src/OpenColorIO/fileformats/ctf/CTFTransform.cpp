@@ -38,6 +38,16 @@ namespace OCIO_NAMESPACE
 // This results in less pretty output and also causes problems for some unit tests.  
 static constexpr unsigned DOUBLE_PRECISION = 15;
 
+namespace
+{
+// The number of significant digits to write a double, see XmlFormatter::setExactPrecision().
+int GetDoublePrecision(const XmlFormatter & formatter)
+{
+    return formatter.hasExactPrecision() ? std::numeric_limits<double>::max_digits10
+                                         : DOUBLE_PRECISION;
+}
+}
+
 
 void CTFVersion::ReadVersion(const std::string & versionString, CTFVersion & versionOut)
 {
@@ -545,17 +555,17 @@ typename std::enable_if<!std::is_floating_point<T>::value, void>::type WriteValu
 }
 
 template <typename T>
-void SetOStream(T, std::ostream & xml)
+void SetOStream(T, const XmlFormatter & formatter, std::ostream & xml)
 {
     xml.width(11);
-    xml.precision(8);
+    xml.precision(formatter.hasExactPrecision() ? std::numeric_limits<T>::max_digits10 : 8);
 }
 
 template <>
-void SetOStream<double>(double, std::ostream & xml)
+void SetOStream<double>(double, const XmlFormatter & formatter, std::ostream & xml)
 {
     xml.width(19);
-    xml.precision(DOUBLE_PRECISION);
+    xml.precision(GetDoublePrecision(formatter));
 }
 
 template<typename Iter, typename scaleType>
@@ -613,7 +623,7 @@ void WriteValues(XmlFormatter & formatter,
 
     case BIT_DEPTH_F32:
     {
-        SetOStream(*valuesBegin, oss);
+        SetOStream(*valuesBegin, formatter, oss);
         break;
     }
 
@@ -867,7 +877,7 @@ void CDLWriter::writeContent() const
     auto op = getOp();
 
     std::ostringstream oss;
-    oss.precision(DOUBLE_PRECISION);
+    oss.precision(GetDoublePrecision(m_formatter));
 
     CDLOpData::ChannelParams params;
 
@@ -986,7 +996,7 @@ void ExposureContrastWriter::getAttributes(XmlFormatter::Attributes& attributes)
 void ExposureContrastWriter::writeContent() const
 {
     std::ostringstream oss;
-    oss.precision(DOUBLE_PRECISION);
+    oss.precision(GetDoublePrecision(m_formatter));
 
     XmlFormatter::Attributes attributes;
     {
@@ -1103,7 +1113,7 @@ void FixedFunctionWriter::getAttributes(XmlFormatter::Attributes& attributes) co
     {
         size_t i = 0;
         std::stringstream ffParams;
-        ffParams.precision(DOUBLE_PRECISION);
+        ffParams.precision(GetDoublePrecision(m_formatter));
         WriteValue(params[i], ffParams);
         while (++i < numParams)
         {
@@ -1181,10 +1191,11 @@ namespace
 void AddGammaParams(XmlFormatter::Attributes & attributes,
                     const GammaOpData::Params & params,
                     const GammaOpData::Style style,
-                    bool useGamma)
+                    bool useGamma,
+                    int precision)
 {
     std::stringstream oss;
-    oss.precision(DOUBLE_PRECISION);
+    oss.precision(precision);
 
     oss << params[0];
     attributes.push_back(XmlFormatter::Attribute(useGamma ? ATTR_GAMMA : ATTR_EXPONENT,
@@ -1224,7 +1235,8 @@ void GammaWriter::writeContent() const
 
         AddGammaParams(attributes,
                        m_gamma->getRedParams(),
-                       m_gamma->getStyle(), useGamma);
+                       m_gamma->getStyle(), useGamma,
+                       GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(paramsTag, attributes);
     }
@@ -1236,7 +1248,8 @@ void GammaWriter::writeContent() const
                                                       "R"));
         AddGammaParams(attributesR,
                        m_gamma->getRedParams(),
-                       m_gamma->getStyle(), useGamma);
+                       m_gamma->getStyle(), useGamma,
+                       GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(paramsTag, attributesR);
 
@@ -1246,7 +1259,8 @@ void GammaWriter::writeContent() const
                                                       "G"));
         AddGammaParams(attributesG,
                        m_gamma->getGreenParams(),
-                       m_gamma->getStyle(), useGamma);
+                       m_gamma->getStyle(), useGamma,
+                       GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(paramsTag, attributesG);
 
@@ -1256,7 +1270,8 @@ void GammaWriter::writeContent() const
                                                       "B"));
         AddGammaParams(attributesB,
                        m_gamma->getBlueParams(),
-                       m_gamma->getStyle(), useGamma);
+                       m_gamma->getStyle(), useGamma,
+                       GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(paramsTag, attributesB);
 
@@ -1268,7 +1283,8 @@ void GammaWriter::writeContent() const
                                                           "A"));
             AddGammaParams(attributesA,
                            m_gamma->getAlphaParams(),
-                           m_gamma->getStyle(), useGamma);
+                           m_gamma->getStyle(), useGamma,
+                           GetDoublePrecision(m_formatter));
 
             m_formatter.writeEmptyTag(paramsTag, attributesA);
         }
@@ -1346,11 +1362,11 @@ void GradingPrimaryWriter::writeRGBM(const char * tag,
         XmlFormatter::Attributes attributes;
 
         std::stringstream rgb;
-        rgb.precision(DOUBLE_PRECISION);
+        rgb.precision(GetDoublePrecision(m_formatter));
         rgb << val.m_red << " " << val.m_green << " " << val.m_blue;
         attributes.push_back(XmlFormatter::Attribute(ATTR_RGB, rgb.str()));
         std::stringstream master;
-        master.precision(DOUBLE_PRECISION);
+        master.precision(GetDoublePrecision(m_formatter));
         master << val.m_master;
         attributes.push_back(XmlFormatter::Attribute(ATTR_MASTER, master.str()));
 
@@ -1366,7 +1382,7 @@ void GradingPrimaryWriter::writeScalarElement(const char * tag,
     {
         XmlFormatter::Attributes attributes;
         std::stringstream stream;
-        stream.precision(DOUBLE_PRECISION);
+        stream.precision(GetDoublePrecision(m_formatter));
         stream << val;
         attributes.push_back(XmlFormatter::Attribute(ATTR_MASTER, stream.str()));
         m_formatter.writeEmptyTag(tag, attributes);
@@ -1386,7 +1402,7 @@ void GradingPrimaryWriter::addAttribute(XmlFormatter::Attributes & attributes, c
                                         double val) const
 {
     std::stringstream master;
-    master.precision(DOUBLE_PRECISION);
+    master.precision(GetDoublePrecision(m_formatter));
     master << val;
     attributes.push_back(XmlFormatter::Attribute(attr, master.str()));
 }
@@ -1572,7 +1588,7 @@ void GradingRGBCurveWriter::writeCurve(const char * tag,
             {
                 const auto & ctPt = curve->getControlPoint(i);
                 std::ostringstream oss;
-                SetOStream(0.f, oss);
+                SetOStream(0.f, m_formatter, oss);
                 oss << ctPt.m_x << " " << ctPt.m_y;
                 m_formatter.writeContent(oss.str());
             }
@@ -1587,7 +1603,7 @@ void GradingRGBCurveWriter::writeCurve(const char * tag,
                 // (Number of slopes is always the same as control points.)
                 const size_t numSlopes = curve->getNumControlPoints();
                 std::ostringstream oss;
-                SetOStream(0.f, oss);
+                SetOStream(0.f, m_formatter, oss);
                 for (size_t i = 0; i < numSlopes; ++i)
                 {
                     const float val = curve->getSlope(i);
@@ -1704,7 +1720,7 @@ void GradingHueCurveWriter::writeCurve(const char * tag,
             {
                 const auto & ctPt = curve->getControlPoint(i);
                 std::ostringstream oss;
-                SetOStream(0.f, oss);
+                SetOStream(0.f, m_formatter, oss);
                 oss << ctPt.m_x << " " << ctPt.m_y;
                 m_formatter.writeContent(oss.str());
             }
@@ -1719,7 +1735,7 @@ void GradingHueCurveWriter::writeCurve(const char * tag,
                 // (Number of slopes is always the same as control points.)
                 const size_t numSlopes = curve->getNumControlPoints();
                 std::ostringstream oss;
-                SetOStream(0.f, oss);
+                SetOStream(0.f, m_formatter, oss);
                 for (size_t i = 0; i < numSlopes; ++i)
                 {
                     const float val = curve->getSlope(i);
@@ -1835,7 +1851,7 @@ void GradingToneWriter::writeRGBMSW(const char * tag,
         XmlFormatter::Attributes attributes;
 
         std::ostringstream oss;
-        oss.precision(DOUBLE_PRECISION);
+        oss.precision(GetDoublePrecision(m_formatter));
         oss << val.m_red << " " << val.m_green << " " << val.m_blue;
         attributes.push_back(XmlFormatter::Attribute(ATTR_RGB, oss.str()));
 
@@ -1864,7 +1880,7 @@ void GradingToneWriter::writeScalarElement(const char * tag,
     {
         XmlFormatter::Attributes attributes;
         std::stringstream stream;
-        stream.precision(DOUBLE_PRECISION);
+        stream.precision(GetDoublePrecision(m_formatter));
         stream << val;
         attributes.push_back(XmlFormatter::Attribute(ATTR_MASTER, stream.str()));
         m_formatter.writeEmptyTag(tag, attributes);
@@ -1966,30 +1982,31 @@ namespace
 {
 void AddLogParam(XmlFormatter::Attributes & attributes,
                  const char * attrName,
-                 double attrValue)
+                 double attrValue,
+                 int precision)
 {
     std::stringstream stream;
-    stream.precision(DOUBLE_PRECISION);
+    stream.precision(precision);
     stream << attrValue;
     attributes.push_back(XmlFormatter::Attribute(attrName, stream.str()));
 }
 
 void AddLogParams(XmlFormatter::Attributes & attributes,
-                  const LogOpData::Params & params, const double base)
+                  const LogOpData::Params & params, const double base, int precision)
 {
     // LogOpData::validate ensure that params size is between 4 & 6.
-    AddLogParam(attributes, ATTR_BASE, base);
-    AddLogParam(attributes, ATTR_LINSIDESLOPE, params[LIN_SIDE_SLOPE]);
-    AddLogParam(attributes, ATTR_LINSIDEOFFSET, params[LIN_SIDE_OFFSET]);
-    AddLogParam(attributes, ATTR_LOGSIDESLOPE, params[LOG_SIDE_SLOPE]);
-    AddLogParam(attributes, ATTR_LOGSIDEOFFSET, params[LOG_SIDE_OFFSET]);
+    AddLogParam(attributes, ATTR_BASE, base, precision);
+    AddLogParam(attributes, ATTR_LINSIDESLOPE, params[LIN_SIDE_SLOPE], precision);
+    AddLogParam(attributes, ATTR_LINSIDEOFFSET, params[LIN_SIDE_OFFSET], precision);
+    AddLogParam(attributes, ATTR_LOGSIDESLOPE, params[LOG_SIDE_SLOPE], precision);
+    AddLogParam(attributes, ATTR_LOGSIDEOFFSET, params[LOG_SIDE_OFFSET], precision);
     if (params.size() > 4)
     {
-        AddLogParam(attributes, ATTR_LINSIDEBREAK, params[LIN_SIDE_BREAK]);
+        AddLogParam(attributes, ATTR_LINSIDEBREAK, params[LIN_SIDE_BREAK], precision);
     }
     if (params.size() > 5)
     {
-        AddLogParam(attributes, ATTR_LINEARSLOPE, params[LINEAR_SLOPE]);
+        AddLogParam(attributes, ATTR_LINEARSLOPE, params[LINEAR_SLOPE], precision);
     }
 }
 }
@@ -2007,7 +2024,8 @@ void LogWriter::writeContent() const
         // All channels equal, just write one element.
         XmlFormatter::Attributes attributes;
 
-        AddLogParams(attributes, m_log->getRedParams(), m_log->getBase());
+        AddLogParams(attributes, m_log->getRedParams(), m_log->getBase(),
+                     GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(TAG_LOG_PARAMS, attributes);
     }
@@ -2016,21 +2034,24 @@ void LogWriter::writeContent() const
         // Red.
         XmlFormatter::Attributes attributesR;
         attributesR.push_back(XmlFormatter::Attribute(ATTR_CHAN, "R"));
-        AddLogParams(attributesR, m_log->getRedParams(), m_log->getBase());
+        AddLogParams(attributesR, m_log->getRedParams(), m_log->getBase(),
+                     GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(TAG_LOG_PARAMS, attributesR);
 
         // Green.
         XmlFormatter::Attributes attributesG;
         attributesG.push_back(XmlFormatter::Attribute(ATTR_CHAN, "G"));
-        AddLogParams(attributesG, m_log->getGreenParams(), m_log->getBase());
+        AddLogParams(attributesG, m_log->getGreenParams(), m_log->getBase(),
+                     GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(TAG_LOG_PARAMS, attributesG);
 
         // Blue.
         XmlFormatter::Attributes attributesB;
         attributesB.push_back(XmlFormatter::Attribute(ATTR_CHAN, "B"));
-        AddLogParams(attributesB, m_log->getBlueParams(), m_log->getBase());
+        AddLogParams(attributesB, m_log->getBlueParams(), m_log->getBase(),
+                     GetDoublePrecision(m_formatter));
 
         m_formatter.writeEmptyTag(TAG_LOG_PARAMS, attributesB);
     }
@@ -2474,7 +2495,7 @@ const char * RangeWriter::getTagName() const
 void WriteTag(XmlFormatter & fmt, const char * tag, double value)
 {
     std::ostringstream o;
-    o.precision(DOUBLE_PRECISION);
+    o.precision(GetDoublePrecision(fmt));
     o << value;
     fmt.writeContentTag(tag, ' ' + o.str() + ' ');
 }
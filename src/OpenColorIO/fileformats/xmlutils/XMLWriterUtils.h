@@ -61,9 +61,15 @@ public:
 
     std::ostream & getStream();
 
+    // Write the floating-point values with enough digits to restore them exactly
+    // (i.e. max_digits10) instead of the shorter, more readable, default precision.
+    void setExactPrecision(bool exact) { m_exactPrecision = exact; }
+    bool hasExactPrecision() const { return m_exactPrecision; }
+
 private:
     std::ostream & m_stream;
     int m_indentLevel = 0;
+    bool m_exactPrecision = false;
 
     void writeIndent();
     void writeString(const std::string & content);
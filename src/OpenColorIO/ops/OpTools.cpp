@@ -1,48 +1,72 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ThreadUtils.h"
 
 namespace OCIO_NAMESPACE
 {
+namespace
+{
+// Below that number of pixels, the cost of the threads exceeds the gain.
+constexpr long MinPixelsPerThread = 4096;
+}
+
 void EvalTransform(const float * in,
                     float * out,
                     long numPixels,
                     OpRcPtrVec & ops)
 {
-    std::vector<float> tmp(numPixels * 4);
-
-    // Render the LUT entries (domain) through the ops.
-    const float * values = in;
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        tmp[4 * idx + 0] = values[0];
-        tmp[4 * idx + 1] = values[1];
-        tmp[4 * idx + 2] = values[2];
-        tmp[4 * idx + 3] = 1.0f;
-
-        values += 3;
-    }
-
     ops.finalize();
     ops.optimize(OPTIMIZATION_NONE);
 
+    // Create the CPU renderers only once as some of them are expensive to build
+    // (e.g. the inverse of a 3D LUT).
+    ConstOpCPURcPtrVec cpuOps;
+    cpuOps.reserve(ops.size());
     for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        cpuOps.push_back(ops[i]->getCPUOp(false));
     }
 
-    float * result = out;
-    for (long idx = 0; idx<numPixels; ++idx)
+    const unsigned numThreads = GetNumThreadsForItems(numPixels, MinPixelsPerThread);
+
+    ParallelFor(numThreads, numPixels, [in, out, &cpuOps](long begin, long end)
     {
-        result[0] = tmp[4 * idx + 0];
-        result[1] = tmp[4 * idx + 1];
-        result[2] = tmp[4 * idx + 2];
+        const long numChunkPixels = end - begin;
+        std::vector<float> tmp(numChunkPixels * 4);
 
-        result += 3;
-    }
+        // Render the LUT entries (domain) through the ops.
+        const float * values = in + 3 * begin;
+        for (long idx = 0; idx<numChunkPixels; ++idx)
+        {
+            tmp[4 * idx + 0] = values[0];
+            tmp[4 * idx + 1] = values[1];
+            tmp[4 * idx + 2] = values[2];
+            tmp[4 * idx + 3] = 1.0f;
+
+            values += 3;
+        }
+
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(&tmp[0], &tmp[0], numChunkPixels);
+        }
+
+        float * result = out + 3 * begin;
+        for (long idx = 0; idx<numChunkPixels; ++idx)
+        {
+            result[0] = tmp[4 * idx + 0];
+            result[1] = tmp[4 * idx + 1];
+            result[2] = tmp[4 * idx + 2];
+
+            result += 3;
+        }
+    });
 }
 } // namespace OCIO_NAMESPACE
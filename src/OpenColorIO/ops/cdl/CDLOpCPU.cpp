@@ -9,6 +9,9 @@
 
 #include "BitDepthUtils.h"
 #include "CDLOpCPU.h"
+#include "CDLOpCPU_AVX2.h"
+#include "CDLOpCPU_AVX512.h"
+#include "CPUInfo.h"
 #include "SSE.h"
 
 
@@ -329,6 +332,44 @@ CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl)
     m_renderParams.update(cdl);
 }
 
+#if OCIO_USE_SSE2
+// Renderer processing several pixels at once using the widest instruction set available
+// at runtime. It is only used for the fast power approximation.
+class CDLRendererSIMD : public CDLOpCPU
+{
+public:
+    CDLRendererSIMD(ConstCDLOpDataRcPtr & cdl, CDLOpCPUApplyFunc * applyFunc)
+        : CDLOpCPU(cdl)
+        , m_applyFunc(applyFunc)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        m_applyFunc(m_renderParams, inImg, outImg, numPixels);
+    }
+
+private:
+    CDLOpCPUApplyFunc * m_applyFunc;
+};
+
+namespace
+{
+
+CDLOpCPUApplyFunc * GetCDLApplyFunc(bool reverse, bool clamp)
+{
+    std::ignore = reverse;
+    std::ignore = clamp;
+
+    return SelectCPUKernel<CDLOpCPUApplyFunc>(
+        nullptr,
+        OCIO_AVX2_KERNEL(AVX2GetCDLApplyFunc(reverse, clamp)),
+        OCIO_AVX512_KERNEL(AVX512GetCDLApplyFunc(reverse, clamp)));
+}
+
+} // anon namespace
+#endif // OCIO_USE_SSE2
+
 #if OCIO_USE_SSE2
 void LoadRenderParams(const RenderParams & renderParams,
                       __m128 & slope,
@@ -474,6 +515,21 @@ ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
 {
 #if OCIO_USE_SSE2 == 0
     std::ignore = fastPower;
+#else
+    if (fastPower)
+    {
+        const CDLOpData::Style style = cdl->getStyle();
+        const bool reverse = (style == CDLOpData::CDL_V1_2_REV)
+                             || (style == CDLOpData::CDL_NO_CLAMP_REV);
+        const bool clamp = (style == CDLOpData::CDL_V1_2_FWD)
+                           || (style == CDLOpData::CDL_V1_2_REV);
+
+        CDLOpCPUApplyFunc * applyFunc = GetCDLApplyFunc(reverse, clamp);
+        if (applyFunc)
+        {
+            return std::make_shared<CDLRendererSIMD>(cdl, applyFunc);
+        }
+    }
 #endif
     switch(cdl->getStyle())
     {
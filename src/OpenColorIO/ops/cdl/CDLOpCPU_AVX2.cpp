@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ChannelParams
+{
+    ChannelParams(const RenderParams & params, int channel)
+        : slope(_mm256_set1_ps(params.getSlope()[channel]))
+        , offset(_mm256_set1_ps(params.getOffset()[channel]))
+        , power(_mm256_set1_ps(params.getPower()[channel]))
+    {
+    }
+
+    __m256 slope;
+    __m256 offset;
+    __m256 power;
+};
+
+// Refer to the SSE helpers in CDLOpCPU.cpp for the details of each step.
+
+template<bool CLAMP>
+inline __m256 ApplyClamp(__m256 pix)
+{
+    if (CLAMP)
+    {
+        pix = _mm256_min_ps(_mm256_max_ps(pix, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+    }
+    return pix;
+}
+
+template<bool CLAMP>
+inline __m256 ApplyPower(__m256 pix, __m256 power)
+{
+    if (CLAMP)
+    {
+        return avx2Power(ApplyClamp<true>(pix), power);
+    }
+
+    // Negative values are passed through in the no-clamp mode.
+    const __m256 pixPower = avx2Power(pix, power);
+    return _mm256_blendv_ps(pixPower, pix, _mm256_cmp_ps(pix, _mm256_setzero_ps(), _CMP_LT_OS));
+}
+
+inline void ApplySaturation(__m256 & r, __m256 & g, __m256 & b, __m256 saturation)
+{
+    const __m256 luma = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r, _mm256_set1_ps(0.2126f)),
+                                                    _mm256_mul_ps(g, _mm256_set1_ps(0.7152f))),
+                                      _mm256_mul_ps(b, _mm256_set1_ps(0.0722f)));
+
+    r = _mm256_add_ps(luma, _mm256_mul_ps(saturation, _mm256_sub_ps(r, luma)));
+    g = _mm256_add_ps(luma, _mm256_mul_ps(saturation, _mm256_sub_ps(g, luma)));
+    b = _mm256_add_ps(luma, _mm256_mul_ps(saturation, _mm256_sub_ps(b, luma)));
+}
+
+template<bool CLAMP>
+void ApplyCDLFwd(const RenderParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[3] = { ChannelParams(params, 0),
+                                 ChannelParams(params, 1),
+                                 ChannelParams(params, 2) };
+    const __m256 saturation = _mm256_set1_ps(params.getSaturation());
+
+    avx2ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p, saturation](__m256 & r, __m256 & g, __m256 & b, __m256 &)
+    {
+        r = ApplyPower<CLAMP>(_mm256_add_ps(_mm256_mul_ps(r, p[0].slope), p[0].offset), p[0].power);
+        g = ApplyPower<CLAMP>(_mm256_add_ps(_mm256_mul_ps(g, p[1].slope), p[1].offset), p[1].power);
+        b = ApplyPower<CLAMP>(_mm256_add_ps(_mm256_mul_ps(b, p[2].slope), p[2].offset), p[2].power);
+
+        ApplySaturation(r, g, b, saturation);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    });
+}
+
+template<bool CLAMP>
+void ApplyCDLRev(const RenderParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[3] = { ChannelParams(params, 0),
+                                 ChannelParams(params, 1),
+                                 ChannelParams(params, 2) };
+    const __m256 saturation = _mm256_set1_ps(params.getSaturation());
+
+    avx2ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p, saturation](__m256 & r, __m256 & g, __m256 & b, __m256 &)
+    {
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+
+        ApplySaturation(r, g, b, saturation);
+
+        r = _mm256_mul_ps(_mm256_add_ps(ApplyPower<CLAMP>(r, p[0].power), p[0].offset), p[0].slope);
+        g = _mm256_mul_ps(_mm256_add_ps(ApplyPower<CLAMP>(g, p[1].power), p[1].offset), p[1].slope);
+        b = _mm256_mul_ps(_mm256_add_ps(ApplyPower<CLAMP>(b, p[2].power), p[2].offset), p[2].slope);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    });
+}
+
+} // anonymous namespace
+
+CDLOpCPUApplyFunc * AVX2GetCDLApplyFunc(bool reverse, bool clamp)
+{
+    if (reverse)
+    {
+        return clamp ? ApplyCDLRev<true> : ApplyCDLRev<false>;
+    }
+    return clamp ? ApplyCDLFwd<true> : ApplyCDLFwd<false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+#define INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/cdl/CDLOpCPU.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the CDL to packed RGBA float pixels. The render parameters are the ones of the forward
+// or reverse direction i.e. already inverted for the reverse direction. Alpha is preserved.
+typedef void (CDLOpCPUApplyFunc)(const RenderParams &, const void *, void *, long);
+
+#if OCIO_USE_AVX2
+
+CDLOpCPUApplyFunc * AVX2GetCDLApplyFunc(bool reverse, bool clamp);
+
+#endif // OCIO_USE_AVX2
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_CDLOP_CPU_AVX2_H */
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "CDLOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ChannelParams
+{
+    ChannelParams(const RenderParams & params, int channel)
+        : slope(_mm512_set1_ps(params.getSlope()[channel]))
+        , offset(_mm512_set1_ps(params.getOffset()[channel]))
+        , power(_mm512_set1_ps(params.getPower()[channel]))
+    {
+    }
+
+    __m512 slope;
+    __m512 offset;
+    __m512 power;
+};
+
+// Refer to the SSE helpers in CDLOpCPU.cpp for the details of each step.
+
+template<bool CLAMP>
+inline __m512 ApplyClamp(__m512 pix)
+{
+    if (CLAMP)
+    {
+        pix = avx512_min_ps(avx512_max_ps(pix, _mm512_setzero_ps()), _mm512_set1_ps(1.0f));
+    }
+    return pix;
+}
+
+template<bool CLAMP>
+inline __m512 ApplyPower(__m512 pix, __m512 power)
+{
+    if (CLAMP)
+    {
+        return avx512Power(ApplyClamp<true>(pix), power);
+    }
+
+    // Negative values are passed through in the no-clamp mode.
+    const __m512 pixPower = avx512Power(pix, power);
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pix, _mm512_setzero_ps(), _CMP_LT_OS),
+                                pixPower, pix);
+}
+
+inline void ApplySaturation(__m512 & r, __m512 & g, __m512 & b, __m512 saturation)
+{
+    const __m512 luma = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(r, _mm512_set1_ps(0.2126f)),
+                                                    _mm512_mul_ps(g, _mm512_set1_ps(0.7152f))),
+                                      _mm512_mul_ps(b, _mm512_set1_ps(0.0722f)));
+
+    r = _mm512_add_ps(luma, _mm512_mul_ps(saturation, _mm512_sub_ps(r, luma)));
+    g = _mm512_add_ps(luma, _mm512_mul_ps(saturation, _mm512_sub_ps(g, luma)));
+    b = _mm512_add_ps(luma, _mm512_mul_ps(saturation, _mm512_sub_ps(b, luma)));
+}
+
+template<bool CLAMP>
+void ApplyCDLFwd(const RenderParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[3] = { ChannelParams(params, 0),
+                                 ChannelParams(params, 1),
+                                 ChannelParams(params, 2) };
+    const __m512 saturation = _mm512_set1_ps(params.getSaturation());
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p, saturation](__m512 & r, __m512 & g, __m512 & b, __m512 &)
+    {
+        r = ApplyPower<CLAMP>(_mm512_add_ps(_mm512_mul_ps(r, p[0].slope), p[0].offset), p[0].power);
+        g = ApplyPower<CLAMP>(_mm512_add_ps(_mm512_mul_ps(g, p[1].slope), p[1].offset), p[1].power);
+        b = ApplyPower<CLAMP>(_mm512_add_ps(_mm512_mul_ps(b, p[2].slope), p[2].offset), p[2].power);
+
+        ApplySaturation(r, g, b, saturation);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    });
+}
+
+template<bool CLAMP>
+void ApplyCDLRev(const RenderParams & params, const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[3] = { ChannelParams(params, 0),
+                                 ChannelParams(params, 1),
+                                 ChannelParams(params, 2) };
+    const __m512 saturation = _mm512_set1_ps(params.getSaturation());
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p, saturation](__m512 & r, __m512 & g, __m512 & b, __m512 &)
+    {
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+
+        ApplySaturation(r, g, b, saturation);
+
+        r = _mm512_mul_ps(_mm512_add_ps(ApplyPower<CLAMP>(r, p[0].power), p[0].offset), p[0].slope);
+        g = _mm512_mul_ps(_mm512_add_ps(ApplyPower<CLAMP>(g, p[1].power), p[1].offset), p[1].slope);
+        b = _mm512_mul_ps(_mm512_add_ps(ApplyPower<CLAMP>(b, p[2].power), p[2].offset), p[2].slope);
+
+        r = ApplyClamp<CLAMP>(r);
+        g = ApplyClamp<CLAMP>(g);
+        b = ApplyClamp<CLAMP>(b);
+    });
+}
+
+} // anonymous namespace
+
+CDLOpCPUApplyFunc * AVX512GetCDLApplyFunc(bool reverse, bool clamp)
+{
+    if (reverse)
+    {
+        return clamp ? ApplyCDLRev<true> : ApplyCDLRev<false>;
+    }
+    return clamp ? ApplyCDLFwd<true> : ApplyCDLFwd<false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
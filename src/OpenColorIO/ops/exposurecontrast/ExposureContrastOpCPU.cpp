@@ -7,8 +7,11 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "DynamicProperty.h"
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX2.h"
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX512.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -17,6 +20,16 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Return the power function processing several pixels at once using the widest instruction set
+// available at runtime, or nullptr if there is none.
+ExposureContrastOpCPUApplyFunc * GetExposureContrastApplyFunc()
+{
+    return SelectCPUKernel<ExposureContrastOpCPUApplyFunc>(
+        nullptr,
+        OCIO_AVX2_KERNEL(AVX2ApplyExposureContrastPower),
+        OCIO_AVX512_KERNEL(AVX512ApplyExposureContrastPower));
+}
+
 class ECRendererBase : public OpCPU
 {
 public:
@@ -38,6 +51,8 @@ protected:
 
     float m_pivot = 0.0f;
     float m_logExposureStep = 0.088f;
+
+    ExposureContrastOpCPUApplyFunc * m_applyFunc = nullptr;
 };
 
 ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
@@ -59,6 +74,8 @@ ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
     {
         m_gamma = m_gamma->createEditableCopy();
     }
+
+    m_applyFunc = GetExposureContrastApplyFunc();
 }
 
 ECRendererBase::~ECRendererBase()
@@ -183,6 +200,12 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyFunc)
+        {
+            m_applyFunc(exposureVal / m_pivot, contrastVal, m_pivot, inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 contrast = _mm_set1_ps(contrastVal);
         __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
         __m128 piv = _mm_set1_ps(m_pivot);
@@ -288,6 +311,13 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
         const float pivotOverExposureVal = m_pivot * invExposureVal;
         const float invPivotVal = 1.f / m_pivot;
 
+        if (m_applyFunc)
+        {
+            m_applyFunc(invPivotVal, invContrastVal, pivotOverExposureVal,
+                        inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
         __m128 inv_pivot = _mm_set1_ps(invPivotVal);
 
@@ -393,6 +423,12 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyFunc)
+        {
+            m_applyFunc(exposureVal / m_pivot, contrastVal, m_pivot, inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 contrast = _mm_set1_ps(contrastVal);
         __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
         __m128 piv = _mm_set1_ps(m_pivot);
@@ -498,6 +534,13 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
     else
     {
 #if OCIO_USE_SSE2
+        if (m_applyFunc)
+        {
+            m_applyFunc(invPivotVal, invContrastVal, pivotOverExposureVal,
+                        inImg, outImg, numPixels);
+            return;
+        }
+
         __m128 inv_contrast = _mm_set1_ps(invContrastVal);
         __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
         __m128 inv_pivot = _mm_set1_ps(invPivotVal);
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void AVX2ApplyExposureContrastPower(float scale, float contrast, float postScale,
+                                    const void * inImg, void * outImg, long numPixels)
+{
+    const __m256 s = _mm256_set1_ps(scale);
+    const __m256 c = _mm256_set1_ps(contrast);
+    const __m256 p = _mm256_set1_ps(postScale);
+
+    avx2ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [s, c, p](__m256 & r, __m256 & g, __m256 & b, __m256 &)
+    {
+        r = _mm256_mul_ps(avx2Power(_mm256_mul_ps(r, s), c), p);
+        g = _mm256_mul_ps(avx2Power(_mm256_mul_ps(g, s), c), p);
+        b = _mm256_mul_ps(avx2Power(_mm256_mul_ps(b, s), c), p);
+    });
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
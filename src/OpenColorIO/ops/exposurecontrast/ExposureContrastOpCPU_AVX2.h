@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+#define INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// Apply out = pow(in * scale, contrast) * postScale to the RGB channels of packed RGBA float
+// pixels. Alpha is preserved. That covers both directions of the linear and video styles.
+typedef void (ExposureContrastOpCPUApplyFunc)(float scale, float contrast, float postScale,
+                                              const void *, void *, long);
+
+#if OCIO_USE_AVX2
+
+namespace OCIO_NAMESPACE
+{
+
+void AVX2ApplyExposureContrastPower(float scale, float contrast, float postScale,
+                                    const void * inImg, void * outImg, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H */
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ExposureContrastOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void AVX512ApplyExposureContrastPower(float scale, float contrast, float postScale,
+                                      const void * inImg, void * outImg, long numPixels)
+{
+    const __m512 s = _mm512_set1_ps(scale);
+    const __m512 c = _mm512_set1_ps(contrast);
+    const __m512 p = _mm512_set1_ps(postScale);
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [s, c, p](__m512 & r, __m512 & g, __m512 & b, __m512 &)
+    {
+        r = _mm512_mul_ps(avx512Power(_mm512_mul_ps(r, s), c), p);
+        g = _mm512_mul_ps(avx512Power(_mm512_mul_ps(g, s), c), p);
+        b = _mm512_mul_ps(avx512Power(_mm512_mul_ps(b, s), c), p);
+    });
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
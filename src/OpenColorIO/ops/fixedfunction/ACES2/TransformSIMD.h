@@ -0,0 +1,830 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_ACES2_TRANSFORM_SIMD_H
+#define INCLUDED_OCIO_ACES2_TRANSFORM_SIMD_H
+
+#include <algorithm>
+#include <limits>
+
+#include "Common.h"
+
+// Batched implementation of the ACES 2.0 Output Transform. The algorithm is written once in
+// terms of a vector traits type V and instantiated by the SSE2, AVX2 and AVX-512 translation
+// units, each of which is compiled with its own instruction set flags. Everything in this
+// header is a template so no code is emitted in a translation unit that does not instantiate
+// it with its own traits.
+//
+// V must provide:
+//
+//   typedef F (float vector) and M (lane mask), static constexpr int size
+//   F load(const float *), void store(float *, F), F set1(float)
+//   F add, sub, mul, div, min, max (F, F) and F sqrt, abs, floor (F)
+//   F copysign(F magnitude, F sign)
+//   M lt, le, gt, ge, eq, neq (F, F), M mand, mor (M, M), bool any(M)
+//   F select(M, F ifTrue, F ifFalse)
+//   F exp2i(F n)       2^n for integral n in [-126, 127]
+//   F frexp(F x, F & e) mantissa in [1, 2) and unbiased exponent of a normal float
+//   F gather(const float * table, F index) where index holds in-range integral values
+//
+// The transcendental functions below are Cephes-style single precision approximations
+// accurate to a few ulps, so results match the scalar path within tolerance rather than
+// bit-exactly. Branches of the scalar code become lane selects, the hue table search runs
+// in lock-step over all the lanes and the table lookups are gathers.
+
+namespace OCIO_NAMESPACE
+{
+
+namespace ACES2
+{
+
+namespace SIMD
+{
+
+template<typename V>
+inline typename V::F madd(typename V::F a, typename V::F b, typename V::F c)
+{
+    return V::add(V::mul(a, b), c);
+}
+
+template<typename V>
+inline typename V::F lerp(typename V::F a, typename V::F b, typename V::F t)
+{
+    return V::add(V::mul(V::sub(b, a), t), a);
+}
+
+// Value modulo 2 for integral values.
+template<typename V>
+inline typename V::F mod2(typename V::F x)
+{
+    return V::sub(x, V::mul(V::set1(2.0f), V::floor(V::mul(x, V::set1(0.5f)))));
+}
+
+template<typename V>
+inline typename V::F log2(typename V::F x)
+{
+    using F = typename V::F;
+
+    F e;
+    F m = V::frexp(x, e);
+
+    // Move the mantissa to [sqrt(0.5), sqrt(2)).
+    const typename V::M big = V::gt(m, V::set1(1.41421356237f));
+    m = V::select(big, V::mul(m, V::set1(0.5f)), m);
+    e = V::select(big, V::add(e, V::set1(1.0f)), e);
+
+    const F f = V::sub(m, V::set1(1.0f));
+    const F z = V::mul(f, f);
+
+    F y = V::set1(7.0376836292E-2f);
+    y = madd<V>(y, f, V::set1(-1.1514610310E-1f));
+    y = madd<V>(y, f, V::set1( 1.1676998740E-1f));
+    y = madd<V>(y, f, V::set1(-1.2420140846E-1f));
+    y = madd<V>(y, f, V::set1( 1.4249322787E-1f));
+    y = madd<V>(y, f, V::set1(-1.6668057665E-1f));
+    y = madd<V>(y, f, V::set1( 2.0000714765E-1f));
+    y = madd<V>(y, f, V::set1(-2.4999993993E-1f));
+    y = madd<V>(y, f, V::set1( 3.3333331174E-1f));
+    y = V::mul(V::mul(y, f), z);
+    y = V::sub(y, V::mul(V::set1(0.5f), z));
+
+    const F log2ea = V::set1(0.44269504088896340736f);
+    F res = V::mul(y, log2ea);
+    res = madd<V>(f, log2ea, res);
+    res = V::add(res, y);
+    res = V::add(res, f);
+    res = V::add(res, e);
+
+    const F inf = V::set1(std::numeric_limits<float>::infinity());
+    res = V::select(V::eq(x, inf), inf, res);
+    res = V::select(V::eq(x, V::set1(0.0f)), V::set1(-std::numeric_limits<float>::infinity()), res);
+    res = V::select(V::lt(x, V::set1(0.0f)), V::set1(std::numeric_limits<float>::quiet_NaN()), res);
+    return V::select(V::neq(x, x), x, res);
+}
+
+template<typename V>
+inline typename V::F exp2(typename V::F x)
+{
+    using F = typename V::F;
+
+    const F xc = V::min(V::max(x, V::set1(-126.0f)), V::set1(128.0f));
+    const F n  = V::min(V::floor(V::add(xc, V::set1(0.5f))), V::set1(127.0f));
+    const F f  = V::sub(xc, n);
+
+    F p = V::set1(1.535336188319500E-4f);
+    p = madd<V>(p, f, V::set1(1.339887440266574E-3f));
+    p = madd<V>(p, f, V::set1(9.618437357674640E-3f));
+    p = madd<V>(p, f, V::set1(5.550332471162809E-2f));
+    p = madd<V>(p, f, V::set1(2.402264791363012E-1f));
+    p = madd<V>(p, f, V::set1(6.931472028550421E-1f));
+    p = madd<V>(p, f, V::set1(1.0f));
+
+    F res = V::mul(p, V::exp2i(n));
+    res = V::select(V::lt(x, V::set1(-126.0f)), V::set1(0.0f), res);
+    res = V::select(V::ge(x, V::set1(128.0f)), V::set1(std::numeric_limits<float>::infinity()), res);
+    return V::select(V::neq(x, x), x, res);
+}
+
+template<typename V>
+inline typename V::F pow(typename V::F x, typename V::F y)
+{
+    return exp2<V>(V::mul(y, log2<V>(x)));
+}
+
+template<typename V>
+inline typename V::F log10(typename V::F x)
+{
+    return V::mul(log2<V>(x), V::set1(0.30102999566398f));
+}
+
+template<typename V>
+inline typename V::F atan2(typename V::F y, typename V::F x)
+{
+    using F = typename V::F;
+    using M = typename V::M;
+
+    const F ax = V::abs(x);
+    const F ay = V::abs(y);
+
+    const M swap = V::gt(ay, ax);
+    const F num  = V::select(swap, ax, ay);
+    const F den  = V::select(swap, ay, ax);
+    F t = V::select(V::eq(den, V::set1(0.0f)), V::set1(0.0f), V::div(num, den));
+
+    // Reduce to [0, tan(pi/8)].
+    const M red = V::gt(t, V::set1(0.4142135623730950f));
+    t = V::select(red, V::div(V::sub(t, V::set1(1.0f)), V::add(t, V::set1(1.0f))), t);
+
+    const F zz = V::mul(t, t);
+    F p = V::set1(8.05374449538E-2f);
+    p = madd<V>(p, zz, V::set1(-1.38776856032E-1f));
+    p = madd<V>(p, zz, V::set1( 1.99777106478E-1f));
+    p = madd<V>(p, zz, V::set1(-3.33329491539E-1f));
+    F a = madd<V>(V::mul(p, zz), t, t);
+    a = V::add(a, V::select(red, V::set1(0.78539816339744831f), V::set1(0.0f)));
+
+    a = V::select(swap, V::sub(V::set1(1.5707963267948966f), a), a);
+    a = V::select(V::lt(x, V::set1(0.0f)), V::sub(V::set1(3.14159265358979323f), a), a);
+    return V::copysign(a, y);
+}
+
+// Sine and cosine of a non-negative angle (in radians).
+template<typename V>
+inline void sincos(typename V::F x, typename V::F & s, typename V::F & c)
+{
+    using F = typename V::F;
+    using M = typename V::M;
+
+    const F one = V::set1(1.0f);
+
+    // Octant of the angle rounded up to an even value.
+    F j = V::floor(V::mul(x, V::set1(1.27323954473516f)));
+    j = V::add(j, mod2<V>(j));
+
+    F r = V::sub(x, V::mul(j, V::set1(0.78515625f)));
+    r = V::sub(r, V::mul(j, V::set1(2.4187564849853515625e-4f)));
+    r = V::sub(r, V::mul(j, V::set1(3.77489497744594108e-8f)));
+
+    const F q  = V::mul(j, V::set1(0.5f));
+    const F q4 = V::sub(q, V::mul(V::set1(4.0f), V::floor(V::mul(q, V::set1(0.25f)))));
+
+    const M swap   = V::eq(mod2<V>(q), one);
+    const M sinNeg = V::ge(q4, V::set1(2.0f));
+    const M cosNeg = V::mand(V::ge(q4, one), V::le(q4, V::set1(2.0f)));
+
+    const F zz = V::mul(r, r);
+
+    F ps = V::set1(-1.9515295891E-4f);
+    ps = madd<V>(ps, zz, V::set1( 8.3321608736E-3f));
+    ps = madd<V>(ps, zz, V::set1(-1.6666654611E-1f));
+    ps = madd<V>(V::mul(ps, zz), r, r);
+
+    F pc = V::set1(2.443315711809948E-5f);
+    pc = madd<V>(pc, zz, V::set1(-1.388731625493765E-3f));
+    pc = madd<V>(pc, zz, V::set1( 4.166664568298827E-2f));
+    pc = V::mul(V::mul(pc, zz), zz);
+    pc = V::sub(pc, V::mul(V::set1(0.5f), zz));
+    pc = V::add(pc, one);
+
+    s = V::select(swap, pc, ps);
+    c = V::select(swap, ps, pc);
+    s = V::select(sinNeg, V::sub(V::set1(0.0f), s), s);
+    c = V::select(cosNeg, V::sub(V::set1(0.0f), c), c);
+}
+
+// Three component vector of lanes.
+template<typename V>
+struct F3
+{
+    typename V::F v[3];
+};
+
+template<typename V>
+inline F3<V> mult_f3_f33(const F3<V> & f, const m33f & m)
+{
+    F3<V> res;
+    for (int i = 0; i < 3; ++i)
+    {
+        res.v[i] = V::add(V::add(V::mul(f.v[0], V::set1(m[3 * i + 0])),
+                                 V::mul(f.v[1], V::set1(m[3 * i + 1]))),
+                                 V::mul(f.v[2], V::set1(m[3 * i + 2])));
+    }
+    return res;
+}
+
+template<typename V>
+inline typename V::F cone_response_compression_fwd(typename V::F Rc)
+{
+    const typename V::F F_L_Y = pow<V>(Rc, V::set1(0.42f));
+    return V::div(F_L_Y, V::add(V::set1(cam_nl_offset), F_L_Y));
+}
+
+template<typename V>
+inline typename V::F cone_response_compression_inv(typename V::F Ra)
+{
+    const typename V::F Ra_lim = V::min(Ra, V::set1(0.99f));
+    const typename V::F F_L_Y  = V::div(V::mul(V::set1(cam_nl_offset), Ra_lim),
+                                        V::sub(V::set1(1.0f), Ra_lim));
+    return pow<V>(F_L_Y, V::set1(1.f / 0.42f));
+}
+
+template<typename V>
+inline typename V::F A_to_Y(typename V::F A, const JMhParams & p)
+{
+    const typename V::F Ra = V::mul(V::set1(p.A_w_J), A);
+    return V::div(cone_response_compression_inv<V>(Ra), V::set1(p.F_L_n));
+}
+
+template<typename V>
+inline typename V::F Y_to_J(typename V::F abs_Y, const JMhParams & p)
+{
+    const typename V::F Ra = cone_response_compression_fwd<V>(V::mul(abs_Y, V::set1(p.F_L_n)));
+    return V::mul(V::set1(J_scale), pow<V>(V::mul(Ra, V::set1(p.inv_A_w_J)), V::set1(p.cz)));
+}
+
+template<typename V>
+inline typename V::F J_to_Achromatic_n(typename V::F J, const JMhParams & p)
+{
+    return pow<V>(V::mul(J, V::set1(1.0f / J_scale)), V::set1(p.inv_cz));
+}
+
+template<typename V>
+inline F3<V> RGB_to_Aab(const F3<V> & RGB, const JMhParams & p)
+{
+    F3<V> rgb = mult_f3_f33<V>(RGB, p.MATRIX_RGB_to_CAM16_c);
+    for (int i = 0; i < 3; ++i)
+    {
+        rgb.v[i] = V::copysign(cone_response_compression_fwd<V>(V::abs(rgb.v[i])), rgb.v[i]);
+    }
+    return mult_f3_f33<V>(rgb, p.MATRIX_cone_response_to_Aab);
+}
+
+template<typename V>
+inline F3<V> Aab_to_JMh(const F3<V> & Aab, const JMhParams & p)
+{
+    using F = typename V::F;
+
+    const F zero = V::set1(0.0f);
+
+    const F J = V::mul(V::set1(J_scale), pow<V>(Aab.v[0], V::set1(p.cz)));
+    const F M = V::sqrt(V::add(V::mul(Aab.v[1], Aab.v[1]), V::mul(Aab.v[2], Aab.v[2])));
+    F h = V::div(V::mul(V::set1(180.0f), atan2<V>(Aab.v[2], Aab.v[1])), V::set1(PI));
+    h = V::select(V::lt(h, zero), V::add(h, V::set1(hue_limit)), h);
+
+    const typename V::M achromatic = V::le(Aab.v[0], zero);
+    return { { V::select(achromatic, zero, J),
+               V::select(achromatic, zero, M),
+               V::select(achromatic, zero, h) } };
+}
+
+template<typename V>
+inline F3<V> Aab_to_RGB(const F3<V> & Aab, const JMhParams & p)
+{
+    F3<V> rgb = mult_f3_f33<V>(Aab, p.MATRIX_Aab_to_cone_response);
+    for (int i = 0; i < 3; ++i)
+    {
+        rgb.v[i] = V::copysign(cone_response_compression_inv<V>(V::abs(rgb.v[i])), rgb.v[i]);
+    }
+    return mult_f3_f33<V>(rgb, p.MATRIX_CAM16_c_to_RGB);
+}
+
+template<typename V>
+inline F3<V> JMh_to_Aab(const F3<V> & JMh, typename V::F cos_hr, typename V::F sin_hr,
+                        const JMhParams & p)
+{
+    return { { J_to_Achromatic_n<V>(JMh.v[0], p),
+               V::mul(JMh.v[1], cos_hr),
+               V::mul(JMh.v[1], sin_hr) } };
+}
+
+// Clamp table indices so that NaN or out of range hues can never read outside of a table.
+template<typename V>
+inline typename V::F table_index(typename V::F i, float maxIndex)
+{
+    return V::min(V::max(i, V::set1(0.0f)), V::set1(maxIndex));
+}
+
+template<typename V>
+inline typename V::F reach_m_from_table(typename V::F h, const Table1D & rt)
+{
+    using F = typename V::F;
+
+    const F base = table_index<V>(V::floor(h), float(TableBase::total_size - 2 - rt.first_nominal_index));
+    const F t    = V::sub(h, base);
+    const F i_lo = V::add(base, V::set1(float(rt.first_nominal_index)));
+
+    return lerp<V>(V::gather(rt.data(), i_lo),
+                   V::gather(rt.data(), V::add(i_lo, V::set1(1.0f))), t);
+}
+
+template<typename V>
+inline typename V::F chroma_compress_norm(typename V::F c1, typename V::F s1, float scale)
+{
+    using F = typename V::F;
+
+    const F two   = V::set1(2.0f);
+    const F three = V::set1(3.0f);
+    const F four  = V::set1(4.0f);
+
+    const F c2 = V::sub(V::mul(V::mul(two, c1), c1), V::set1(1.0f));
+    const F s2 = V::mul(V::mul(two, c1), s1);
+    const F c3 = V::sub(V::mul(V::mul(V::mul(four, c1), c1), c1), V::mul(three, c1));
+    const F s3 = V::sub(V::mul(three, s1), V::mul(V::mul(V::mul(four, s1), s1), s1));
+
+    F M = V::mul(V::set1(11.34072f), c1);
+    M = V::add(M, V::mul(V::set1(16.46899f), c2));
+    M = V::add(M, V::mul(V::set1(7.88380f), c3));
+    M = V::add(M, V::mul(V::set1(14.66441f), s1));
+    M = V::add(M, V::mul(V::set1(-6.37224f), s2));
+    M = V::add(M, V::mul(V::set1(9.19364f), s3));
+    M = V::add(M, V::set1(77.12896f));
+
+    return V::mul(M, V::set1(scale));
+}
+
+template<typename V>
+inline typename V::F toe_fwd(typename V::F x, typename V::F limit, typename V::F k1_in, typename V::F k2_in)
+{
+    using F = typename V::F;
+
+    const F k2 = V::max(k2_in, V::set1(0.001f));
+    const F k1 = V::sqrt(V::add(V::mul(k1_in, k1_in), V::mul(k2, k2)));
+    const F k3 = V::div(V::add(limit, k1), V::add(limit, k2));
+
+    const F minus_b  = V::sub(V::mul(k3, x), k1);
+    const F minus_ac = V::mul(V::mul(k2, k3), x);
+    const F res = V::mul(V::set1(0.5f),
+                         V::add(minus_b, V::sqrt(V::add(V::mul(minus_b, minus_b),
+                                                        V::mul(V::set1(4.0f), minus_ac)))));
+
+    return V::select(V::gt(x, limit), x, res);
+}
+
+template<typename V>
+inline typename V::F toe_inv(typename V::F x, typename V::F limit, typename V::F k1_in, typename V::F k2_in)
+{
+    using F = typename V::F;
+
+    const F k2 = V::max(k2_in, V::set1(0.001f));
+    const F k1 = V::sqrt(V::add(V::mul(k1_in, k1_in), V::mul(k2, k2)));
+    const F k3 = V::div(V::add(limit, k1), V::add(limit, k2));
+
+    const F res = V::div(V::add(V::mul(x, x), V::mul(k1, x)), V::mul(k3, V::add(x, k2)));
+
+    return V::select(V::gt(x, limit), x, res);
+}
+
+template<typename V>
+inline typename V::F tonescale_A_to_J_fwd(typename V::F A, const JMhParams & p, const ToneScaleParams & pt)
+{
+    using F = typename V::F;
+
+    const F Y_in = A_to_Y<V>(A, p);
+
+    const F f    = V::mul(V::set1(pt.m_2),
+                          pow<V>(V::div(Y_in, V::add(Y_in, V::set1(pt.s_2))), V::set1(pt.g)));
+    const F Y_ts = V::mul(V::max(V::set1(0.0f), V::div(V::mul(f, f), V::add(f, V::set1(pt.t_1)))),
+                          V::set1(pt.n_r));
+
+    return V::copysign(Y_to_J<V>(Y_ts, p), A);
+}
+
+template<typename V>
+inline typename V::F tonescale_inv(typename V::F J, const JMhParams & p, const ToneScaleParams & pt)
+{
+    using F = typename V::F;
+
+    const F Y_in = A_to_Y<V>(J_to_Achromatic_n<V>(V::abs(J), p), p);
+
+    const F Y_ts_norm = V::div(Y_in, V::set1(reference_luminance));
+    const F Z = V::max(V::set1(0.0f), V::min(V::set1(pt.inverse_limit), Y_ts_norm));
+    const F f = V::div(V::add(Z, V::sqrt(V::mul(Z, V::add(V::mul(V::set1(4.0f), V::set1(pt.t_1)), Z)))),
+                       V::set1(2.0f));
+    const F Y = V::div(V::set1(pt.s_2),
+                       V::sub(pow<V>(V::div(V::set1(pt.m_2), f), V::set1(1.0f / pt.g)), V::set1(1.0f)));
+
+    return V::copysign(Y_to_J<V>(Y, p), J);
+}
+
+template<typename V>
+inline typename V::F chroma_compress_fwd(typename V::F J, typename V::F M, typename V::F J_ts,
+                                         typename V::F Mnorm, typename V::F reachMaxM,
+                                         const SharedCompressionParameters & ps,
+                                         const ChromaCompressParams & pc)
+{
+    using F = typename V::F;
+
+    const F mgi   = V::set1(ps.model_gamma_inv);
+    const F nJ    = V::div(J_ts, V::set1(ps.limit_J_max));
+    const F snJ   = V::max(V::set1(0.0f), V::sub(V::set1(1.0f), nJ));
+    const F limit = V::div(V::mul(pow<V>(nJ, mgi), reachMaxM), Mnorm);
+
+    F M_cp = V::mul(M, pow<V>(V::div(J_ts, J), mgi));
+    M_cp = V::div(M_cp, Mnorm);
+    M_cp = V::sub(limit, toe_fwd<V>(V::sub(limit, M_cp), V::sub(limit, V::set1(0.001f)),
+                                    V::mul(snJ, V::set1(pc.sat)),
+                                    V::sqrt(V::add(V::mul(nJ, nJ), V::set1(pc.sat_thr)))));
+    M_cp = toe_fwd<V>(M_cp, limit, V::mul(nJ, V::set1(pc.compr)), snJ);
+    M_cp = V::mul(M_cp, Mnorm);
+
+    return V::select(V::neq(M, V::set1(0.0f)), M_cp, M);
+}
+
+template<typename V>
+inline typename V::F chroma_compress_inv(typename V::F J_ts, typename V::F M_cp, typename V::F J,
+                                         typename V::F Mnorm, typename V::F reachMaxM,
+                                         const SharedCompressionParameters & ps,
+                                         const ChromaCompressParams & pc)
+{
+    using F = typename V::F;
+
+    const F mgi   = V::set1(ps.model_gamma_inv);
+    const F nJ    = V::div(J_ts, V::set1(ps.limit_J_max));
+    const F snJ   = V::max(V::set1(0.0f), V::sub(V::set1(1.0f), nJ));
+    const F limit = V::div(V::mul(pow<V>(nJ, mgi), reachMaxM), Mnorm);
+
+    F M = V::div(M_cp, Mnorm);
+    M = toe_inv<V>(M, limit, V::mul(nJ, V::set1(pc.compr)), snJ);
+    M = V::sub(limit, toe_inv<V>(V::sub(limit, M), V::sub(limit, V::set1(0.001f)),
+                                 V::mul(snJ, V::set1(pc.sat)),
+                                 V::sqrt(V::add(V::mul(nJ, nJ), V::set1(pc.sat_thr)))));
+    M = V::mul(M, Mnorm);
+    M = V::mul(M, pow<V>(V::div(J_ts, J), V::set1(-ps.model_gamma_inv)));
+
+    return V::select(V::neq(M_cp, V::set1(0.0f)), M, M_cp);
+}
+
+// Hue dependent gamut parameters of a block of pixels.
+template<typename V>
+struct HueDependantGamut
+{
+    typename V::F cuspJ;
+    typename V::F cuspM;
+    typename V::F gamma_top_inv;
+    typename V::F focusJ;
+    typename V::F analytical_threshold;
+};
+
+// Binary search of the hue table run in lock-step over all the lanes, see lookup_hue_interval()
+// in Transform.cpp. Indices are kept as floats to avoid integer vector instructions that are
+// not available on every instruction set.
+template<typename V>
+inline typename V::F lookup_hue_interval(typename V::F h, const GamutCompressParams & p)
+{
+    using F = typename V::F;
+    using M = typename V::M;
+
+    const Table1D & hues = p.hue_table;
+    const F one = V::set1(1.0f);
+
+    F i = V::add(table_index<V>(V::floor(h), float(hues.nominal_size)),
+                 V::set1(float(hues.first_nominal_index)));
+    F i_lo = V::max(V::set1(float(hues.lower_wrap_index)),
+                    V::add(i, V::set1(float(p.hue_linearity_search_range[0]))));
+    F i_hi = V::min(V::set1(float(hues.upper_wrap_index)),
+                    V::add(i, V::set1(float(p.hue_linearity_search_range[1]))));
+
+    M active = V::lt(V::add(i_lo, one), i_hi);
+    while (V::any(active))
+    {
+        const M above = V::gt(h, V::gather(hues.data(), i));
+        i_lo = V::select(V::mand(active, above), i, i_lo);
+        i_hi = V::select(active, V::select(above, i_hi, i), i_hi);
+        i = V::floor(V::mul(V::add(i_lo, i_hi), V::set1(0.5f)));
+        active = V::lt(V::add(i_lo, one), i_hi);
+    }
+
+    return V::max(one, i_hi);
+}
+
+template<typename V>
+inline HueDependantGamut<V> init_HueDependantGamut(typename V::F h, const SharedCompressionParameters & ps,
+                                                   const GamutCompressParams & p)
+{
+    using F = typename V::F;
+
+    const F i_hi = lookup_hue_interval<V>(h, p);
+    const F i_lo = V::sub(i_hi, V::set1(1.0f));
+
+    const F h_lo = V::gather(p.hue_table.data(), i_lo);
+    const F h_hi = V::gather(p.hue_table.data(), i_hi);
+    const F t    = V::div(V::sub(h, h_lo), V::sub(h_hi, h_lo));
+
+    // The cusp table rows are contiguous triplets.
+    const float * cusps = &p.gamut_cusp_table[0][0];
+    const F three = V::set1(3.0f);
+    const F row_lo = V::mul(i_lo, three);
+    const F row_hi = V::mul(i_hi, three);
+
+    F cusp[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        const F offset = V::set1(float(c));
+        cusp[c] = lerp<V>(V::gather(cusps, V::add(row_lo, offset)),
+                          V::gather(cusps, V::add(row_hi, offset)), t);
+    }
+
+    const F limitJmax = V::set1(ps.limit_J_max);
+
+    HueDependantGamut<V> hdp;
+    hdp.cuspJ = cusp[0];
+    hdp.cuspM = cusp[1];
+    hdp.gamma_top_inv = cusp[2];
+    hdp.focusJ = lerp<V>(hdp.cuspJ, V::set1(p.mid_J),
+                         V::min(V::set1(1.0f), V::sub(V::set1(cusp_mid_blend),
+                                                      V::div(hdp.cuspJ, limitJmax))));
+    hdp.analytical_threshold = lerp<V>(hdp.cuspJ, limitJmax, V::set1(focus_gain_blend));
+    return hdp;
+}
+
+template<typename V>
+inline typename V::F get_focus_gain(typename V::F J, typename V::F threshold, float limit_J_max, float focus_dist)
+{
+    using F = typename V::F;
+
+    const F limitJmax = V::set1(limit_J_max);
+    const F gain = V::set1(limit_J_max * focus_dist);
+
+    F adjustment = log10<V>(V::div(V::sub(limitJmax, threshold),
+                                   V::max(V::set1(0.0001f), V::sub(limitJmax, J))));
+    adjustment = V::add(V::mul(adjustment, adjustment), V::set1(1.0f));
+
+    return V::select(V::gt(J, threshold), V::mul(gain, adjustment), gain);
+}
+
+template<typename V>
+inline typename V::F solve_J_intersect(typename V::F J, typename V::F M, typename V::F focusJ,
+                                       float maxJ, typename V::F slope_gain)
+{
+    using F = typename V::F;
+
+    const F M_scaled = V::div(M, slope_gain);
+    const F a  = V::div(M_scaled, focusJ);
+    const F a4 = V::mul(V::set1(4.0f), a);
+    const F minus2 = V::set1(-2.0f);
+
+    const F b_lo = V::sub(V::set1(1.0f), M_scaled);
+    const F c_lo = V::sub(V::set1(0.0f), J);
+    const F root_lo = V::sqrt(V::sub(V::mul(b_lo, b_lo), V::mul(a4, c_lo)));
+    const F res_lo  = V::div(V::mul(minus2, c_lo), V::add(b_lo, root_lo));
+
+    const F b_hi = V::sub(V::set1(0.0f),
+                          V::add(V::add(V::set1(1.0f), M_scaled), V::mul(V::set1(maxJ), a)));
+    const F c_hi = V::add(V::mul(V::set1(maxJ), M_scaled), J);
+    const F root_hi = V::sqrt(V::sub(V::mul(b_hi, b_hi), V::mul(a4, c_hi)));
+    const F res_hi  = V::div(V::mul(minus2, c_hi), V::sub(b_hi, root_hi));
+
+    return V::select(V::lt(J, focusJ), res_lo, res_hi);
+}
+
+template<typename V>
+inline typename V::F estimate_line_and_boundary_intersection_M(typename V::F J_axis_intersect,
+                                                               typename V::F slope,
+                                                               typename V::F inv_gamma,
+                                                               typename V::F J_max,
+                                                               typename V::F M_max,
+                                                               typename V::F J_reference)
+{
+    const typename V::F shifted = V::mul(J_reference,
+                                         pow<V>(V::div(J_axis_intersect, J_reference), inv_gamma));
+    return V::div(V::mul(shifted, M_max), V::sub(J_max, V::mul(slope, M_max)));
+}
+
+template<typename V>
+inline typename V::F smin_scaled(typename V::F a, typename V::F b, typename V::F scale_reference)
+{
+    using F = typename V::F;
+
+    const F s = V::mul(V::set1(smooth_cusps), scale_reference);
+    const F h = V::div(V::max(V::sub(s, V::abs(V::sub(a, b))), V::set1(0.0f)), s);
+    return V::sub(V::min(a, b), V::mul(V::mul(V::mul(V::mul(h, h), h), s), V::set1(1.f / 6.f)));
+}
+
+template<typename V, bool invert>
+inline typename V::F remap_M(typename V::F M, typename V::F gamut_boundary_M, typename V::F reach_boundary_M)
+{
+    using F = typename V::F;
+
+    const F one = V::set1(1.0f);
+
+    const F proportion = V::max(V::div(gamut_boundary_M, reach_boundary_M), V::set1(compression_threshold));
+    const F threshold  = V::mul(proportion, gamut_boundary_M);
+
+    const F m_offset     = V::sub(M, threshold);
+    const F gamut_offset = V::sub(gamut_boundary_M, threshold);
+    const F reach_offset = V::sub(reach_boundary_M, threshold);
+
+    const F scale = V::div(reach_offset, V::sub(V::div(reach_offset, gamut_offset), one));
+    const F nd    = V::div(m_offset, scale);
+
+    F remapped;
+    if (invert)
+    {
+        remapped = V::select(V::ge(nd, one), scale,
+                             V::mul(scale, V::sub(V::set1(0.0f), V::div(nd, V::sub(nd, one)))));
+    }
+    else
+    {
+        remapped = V::div(V::mul(scale, nd), V::add(one, nd));
+    }
+
+    return V::select(V::mor(V::le(M, threshold), V::ge(proportion, one)), M, V::add(threshold, remapped));
+}
+
+template<typename V, bool invert>
+inline F3<V> compressGamut(typename V::F J, typename V::F M, typename V::F Jx, typename V::F reachMaxM,
+                           const SharedCompressionParameters & ps, const GamutCompressParams & p,
+                           const HueDependantGamut<V> & hdp)
+{
+    using F = typename V::F;
+
+    const F limitJmax = V::set1(ps.limit_J_max);
+
+    const F slope_gain = get_focus_gain<V>(Jx, hdp.analytical_threshold, ps.limit_J_max, p.focus_dist);
+    const F J_intersect_source = solve_J_intersect<V>(J, M, hdp.focusJ, ps.limit_J_max, slope_gain);
+
+    const F direction = V::select(V::lt(J_intersect_source, hdp.focusJ), J_intersect_source,
+                                  V::sub(limitJmax, J_intersect_source));
+    const F slope = V::div(V::mul(direction, V::sub(J_intersect_source, hdp.focusJ)),
+                           V::mul(hdp.focusJ, slope_gain));
+
+    const F J_intersect_cusp = solve_J_intersect<V>(hdp.cuspJ, hdp.cuspM, hdp.focusJ, ps.limit_J_max, slope_gain);
+
+    const F M_lower = estimate_line_and_boundary_intersection_M<V>(
+        J_intersect_source, slope, V::set1(p.lower_hull_gamma_inv), hdp.cuspJ, hdp.cuspM, J_intersect_cusp);
+    const F M_upper = estimate_line_and_boundary_intersection_M<V>(
+        V::sub(limitJmax, J_intersect_source), V::sub(V::set1(0.0f), slope), hdp.gamma_top_inv,
+        V::sub(limitJmax, hdp.cuspJ), hdp.cuspM, V::sub(limitJmax, J_intersect_cusp));
+    const F gamut_boundary_M = smin_scaled<V>(M_lower, M_upper, hdp.cuspM);
+
+    const F reach_boundary_M = estimate_line_and_boundary_intersection_M<V>(
+        J_intersect_source, slope, V::set1(ps.model_gamma_inv), limitJmax, reachMaxM, limitJmax);
+
+    const F remapped_M = remap_M<V, invert>(M, gamut_boundary_M, reach_boundary_M);
+
+    const typename V::M outside = V::le(gamut_boundary_M, V::set1(0.0f));
+    return { { V::select(outside, J, V::add(J_intersect_source, V::mul(remapped_M, slope))),
+               V::select(outside, V::set1(0.0f), remapped_M),
+               V::set1(0.0f) } };
+}
+
+// Returns the compressed J and M, the hue is unchanged.
+template<typename V, bool invert>
+inline F3<V> gamut_compress(typename V::F J, typename V::F M, typename V::F h, typename V::F reachMaxM,
+                            const SharedCompressionParameters & ps, const GamutCompressParams & p)
+{
+    using F = typename V::F;
+    using M_ = typename V::M;
+
+    const F zero = V::set1(0.0f);
+
+    // We compress M only so avoid mapping zero, above the expected maximum we explicitly map
+    // to 0 M, and J is limited to positive values.
+    const M_ active = V::mand(V::gt(J, zero), V::mand(V::gt(M, zero), V::le(J, V::set1(ps.limit_J_max))));
+
+    F3<V> res = { { V::max(J, zero), zero, zero } };
+    if (!V::any(active))
+    {
+        return res;
+    }
+
+    const HueDependantGamut<V> hdp = init_HueDependantGamut<V>(h, ps, p);
+
+    F Jx = J;
+    if (invert)
+    {
+        // Approximation above the threshold.
+        const F3<V> approx = compressGamut<V, true>(J, M, Jx, reachMaxM, ps, p, hdp);
+        Jx = V::select(V::gt(Jx, hdp.analytical_threshold), approx.v[0], Jx);
+    }
+
+    const F3<V> compressed = compressGamut<V, invert>(J, M, Jx, reachMaxM, ps, p, hdp);
+
+    res.v[0] = V::select(active, compressed.v[0], res.v[0]);
+    res.v[1] = V::select(active, compressed.v[1], zero);
+    return res;
+}
+
+template<typename V>
+inline F3<V> OutputTransformFwd(const F3<V> & RGB,
+                                const JMhParams & pIn, const JMhParams & pOut,
+                                const ToneScaleParams & pt, const SharedCompressionParameters & ps,
+                                const ChromaCompressParams & pc, const GamutCompressParams & pg)
+{
+    using F = typename V::F;
+
+    const F3<V> Aab = RGB_to_Aab<V>(RGB, pIn);
+    const F3<V> JMh = Aab_to_JMh<V>(Aab, pIn);
+
+    const F reachMaxM = reach_m_from_table<V>(JMh.v[2], ps.reach_m_table);
+    const F h_rad = V::div(V::mul(V::set1(PI), JMh.v[2]), V::set1(180.0f));
+    F cos_hr, sin_hr;
+    sincos<V>(h_rad, sin_hr, cos_hr);
+    const F Mnorm = chroma_compress_norm<V>(cos_hr, sin_hr, pc.chroma_compress_scale);
+
+    const F J_ts = tonescale_A_to_J_fwd<V>(Aab.v[0], pIn, pt);
+    const F M_cp = chroma_compress_fwd<V>(JMh.v[0], JMh.v[1], J_ts, Mnorm, reachMaxM, ps, pc);
+
+    const F3<V> compressed = gamut_compress<V, false>(J_ts, M_cp, JMh.v[2], reachMaxM, ps, pg);
+
+    return Aab_to_RGB<V>(JMh_to_Aab<V>(compressed, cos_hr, sin_hr, pOut), pOut);
+}
+
+template<typename V>
+inline F3<V> OutputTransformInv(const F3<V> & RGB,
+                                const JMhParams & pIn, const JMhParams & pOut,
+                                const ToneScaleParams & pt, const SharedCompressionParameters & ps,
+                                const ChromaCompressParams & pc, const GamutCompressParams & pg)
+{
+    using F = typename V::F;
+
+    const F3<V> JMh = Aab_to_JMh<V>(RGB_to_Aab<V>(RGB, pOut), pOut);
+
+    const F reachMaxM = reach_m_from_table<V>(JMh.v[2], ps.reach_m_table);
+    const F h_rad = V::div(V::mul(V::set1(PI), JMh.v[2]), V::set1(180.0f));
+    F cos_hr, sin_hr;
+    sincos<V>(h_rad, sin_hr, cos_hr);
+    const F Mnorm = chroma_compress_norm<V>(cos_hr, sin_hr, pc.chroma_compress_scale);
+
+    const F3<V> tonemapped = gamut_compress<V, true>(JMh.v[0], JMh.v[1], JMh.v[2], reachMaxM, ps, pg);
+
+    const F J = tonescale_inv<V>(tonemapped.v[0], pIn, pt);
+    const F M = chroma_compress_inv<V>(tonemapped.v[0], tonemapped.v[1], J, Mnorm, reachMaxM, ps, pc);
+
+    return Aab_to_RGB<V>(JMh_to_Aab<V>({ { J, M, JMh.v[2] } }, cos_hr, sin_hr, pIn), pIn);
+}
+
+// Apply the forward or inverse output transform to packed RGBA float pixels. The pixels are
+// transposed to planar blocks of V::size pixels, the last block is padded by repeating its
+// last pixel. Alpha is passed through.
+template<typename V, bool fwd>
+void ApplyOutputTransform(const JMhParams & pIn, const JMhParams & pOut,
+                          const ToneScaleParams & pt, const SharedCompressionParameters & ps,
+                          const ChromaCompressParams & pc, const GamutCompressParams & pg,
+                          const void * inImg, void * outImg, long numPixels)
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    alignas(64) float planes[3][V::size];
+
+    for (long idx = 0; idx < numPixels; idx += V::size)
+    {
+        const long count = std::min<long>(V::size, numPixels - idx);
+
+        for (long i = 0; i < V::size; ++i)
+        {
+            const long k = std::min(i, count - 1);
+            planes[0][i] = in[4 * k + 0];
+            planes[1][i] = in[4 * k + 1];
+            planes[2][i] = in[4 * k + 2];
+        }
+
+        const F3<V> RGB = { { V::load(planes[0]), V::load(planes[1]), V::load(planes[2]) } };
+        const F3<V> res = fwd ? OutputTransformFwd<V>(RGB, pIn, pOut, pt, ps, pc, pg)
+                              : OutputTransformInv<V>(RGB, pIn, pOut, pt, ps, pc, pg);
+
+        V::store(planes[0], res.v[0]);
+        V::store(planes[1], res.v[1]);
+        V::store(planes[2], res.v[2]);
+
+        for (long i = 0; i < count; ++i)
+        {
+            out[4 * i + 0] = planes[0][i];
+            out[4 * i + 1] = planes[1][i];
+            out[4 * i + 2] = planes[2][i];
+            out[4 * i + 3] = in[4 * i + 3];
+        }
+
+        in  += 4 * V::size;
+        out += 4 * V::size;
+    }
+}
+
+} // namespace SIMD
+
+} // namespace ACES2
+
+} // OCIO namespace
+
+#endif
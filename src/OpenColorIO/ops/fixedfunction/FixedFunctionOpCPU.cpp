@@ -11,6 +11,9 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX2.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX512.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_SSE2.h"
 #include "SSE.h"
 #include "CPUInfo.h"
 
@@ -152,6 +155,20 @@ protected:
     ACES2::GamutCompressParams m_g;
 };
 
+// Batched version of the output transform processing several pixels at once in SIMD registers.
+class Renderer_ACES_OutputTransform20_SIMD : public Renderer_ACES_OutputTransform20
+{
+public:
+    Renderer_ACES_OutputTransform20_SIMD() = delete;
+    Renderer_ACES_OutputTransform20_SIMD(ConstFixedFunctionOpDataRcPtr & data,
+                                         ACES2OutputTransformApplyFunc * applyFunc);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    ACES2OutputTransformApplyFunc * m_applyFunc;
+};
+
 class Renderer_ACES_RGB_TO_JMh_20 : public OpCPU
 {
 public:
@@ -1165,6 +1182,18 @@ void Renderer_ACES_OutputTransform20::inv(const void * inImg, void * outImg, lon
     }
 }
 
+Renderer_ACES_OutputTransform20_SIMD::Renderer_ACES_OutputTransform20_SIMD(ConstFixedFunctionOpDataRcPtr & data,
+                                                                           ACES2OutputTransformApplyFunc * applyFunc)
+    :   Renderer_ACES_OutputTransform20(data)
+    ,   m_applyFunc(applyFunc)
+{
+}
+
+void Renderer_ACES_OutputTransform20_SIMD::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    m_applyFunc(m_pIn, m_pOut, m_t, m_s, m_c, m_g, inImg, outImg, numPixels);
+}
+
 Renderer_ACES_RGB_TO_JMh_20::Renderer_ACES_RGB_TO_JMh_20(ConstFixedFunctionOpDataRcPtr & data)
     :   OpCPU()
 {
@@ -2426,6 +2455,18 @@ void Renderer_DOUBLE_LOG_TO_LIN::apply(const void* inImg, void* outImg, long num
 
 
 
+ACES2OutputTransformApplyFunc * GetACES2OutputTransformApplyFunc(bool fwd)
+{
+    // Prevent "unused-parameter" warning/error in case the using code is
+    // ifdef'ed out.
+    (void)fwd;
+
+    return SelectCPUKernel<ACES2OutputTransformApplyFunc>(
+        OCIO_SSE2_KERNEL(SSE2GetACES2OutputTransformApplyFunc(fwd)),
+        OCIO_AVX2_KERNEL(AVX2GetACES2OutputTransformApplyFunc(fwd)),
+        OCIO_AVX512_KERNEL(AVX512GetACES2OutputTransformApplyFunc(fwd)));
+}
+
 ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func, bool fastLogExpPow)
 {
     // Prevent "unused-parameter" warning/error in case the using code is
@@ -2486,6 +2527,17 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
         {
+            // The batched renderer uses its own approximations of the power, log and
+            // trigonometric functions, so it is only used when fast power is allowed.
+            if (fastLogExpPow)
+            {
+                const bool fwd = func->getStyle() == FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD;
+                if (ACES2OutputTransformApplyFunc * applyFunc = GetACES2OutputTransformApplyFunc(fwd))
+                {
+                    return std::make_shared<Renderer_ACES_OutputTransform20_SIMD>(func, applyFunc);
+                }
+            }
+
             // Sharing same renderer (param will be inverted to handle direction).
             return std::make_shared<Renderer_ACES_OutputTransform20>(func);
         }
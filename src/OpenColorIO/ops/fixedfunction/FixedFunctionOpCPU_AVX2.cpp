@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX2.h"
+
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "ops/fixedfunction/ACES2/TransformSIMD.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct AVX2Vector
+{
+    typedef __m256 F;
+    typedef __m256 M;
+    static constexpr int size = 8;
+
+    static inline F load(const float * src) { return _mm256_loadu_ps(src); }
+    static inline void store(float * dst, F v) { _mm256_storeu_ps(dst, v); }
+    static inline F set1(float v) { return _mm256_set1_ps(v); }
+
+    static inline F add(F a, F b) { return _mm256_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm256_div_ps(a, b); }
+    static inline F min(F a, F b) { return _mm256_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm256_max_ps(a, b); }
+    static inline F sqrt(F a) { return _mm256_sqrt_ps(a); }
+    static inline F abs(F a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static inline F floor(F a) { return _mm256_floor_ps(a); }
+
+    static inline F copysign(F mag, F sign)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(signMask, mag), _mm256_and_ps(signMask, sign));
+    }
+
+    static inline M lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline M le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static inline M gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static inline M ge(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static inline M eq(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static inline M neq(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+    static inline M mand(M a, M b) { return _mm256_and_ps(a, b); }
+    static inline M mor(M a, M b) { return _mm256_or_ps(a, b); }
+    static inline bool any(M m) { return _mm256_movemask_ps(m) != 0; }
+
+    static inline F select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+
+    static inline F exp2i(F n)
+    {
+        const __m256i e = _mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+    }
+
+    static inline F frexp(F x, F & e)
+    {
+        const __m256i i = _mm256_castps_si256(x);
+        const __m256i biased = _mm256_and_si256(_mm256_srli_epi32(i, 23), _mm256_set1_epi32(0xff));
+        e = _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, _mm256_set1_epi32(127)));
+
+        const __m256i m = _mm256_or_si256(_mm256_and_si256(i, _mm256_set1_epi32(0x007fffff)),
+                                          _mm256_set1_epi32(0x3f800000));
+        return _mm256_castsi256_ps(m);
+    }
+
+    static inline F gather(const float * table, F index)
+    {
+        return _mm256_i32gather_ps(table, _mm256_cvttps_epi32(index), 4);
+    }
+};
+
+} // anonymous namespace
+
+ACES2OutputTransformApplyFunc * AVX2GetACES2OutputTransformApplyFunc(bool fwd)
+{
+    return fwd ? ACES2::SIMD::ApplyOutputTransform<AVX2Vector, true>
+               : ACES2::SIMD::ApplyOutputTransform<AVX2Vector, false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX512.h"
+
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+#include "ops/fixedfunction/ACES2/TransformSIMD.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct AVX512Vector
+{
+    typedef __m512 F;
+    typedef __mmask16 M;
+    static constexpr int size = 16;
+
+    static inline F load(const float * src) { return _mm512_loadu_ps(src); }
+    static inline void store(float * dst, F v) { _mm512_storeu_ps(dst, v); }
+    static inline F set1(float v) { return _mm512_set1_ps(v); }
+
+    static inline F add(F a, F b) { return _mm512_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm512_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm512_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm512_div_ps(a, b); }
+    static inline F min(F a, F b) { return avx512_min_ps(a, b); }
+    static inline F max(F a, F b) { return avx512_max_ps(a, b); }
+    static inline F sqrt(F a) { return avx512_sqrt_ps(a); }
+
+    static inline F abs(F a)
+    {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a),
+                                                    _mm512_set1_epi32(0x7fffffff)));
+    }
+
+    static inline F floor(F a)
+    {
+        return avx512_roundscale_ps<_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC>(a);
+    }
+
+    static inline F copysign(F mag, F sign)
+    {
+        const __m512i signMask = _mm512_set1_epi32(0x80000000);
+        return _mm512_castsi512_ps(
+            _mm512_or_si512(avx512_andnot_si512(signMask, _mm512_castps_si512(mag)),
+                            _mm512_and_si512(signMask, _mm512_castps_si512(sign))));
+    }
+
+    static inline M lt(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static inline M le(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static inline M gt(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static inline M ge(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static inline M eq(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static inline M neq(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+    static inline M mand(M a, M b) { return _mm512_kand(a, b); }
+    static inline M mor(M a, M b) { return _mm512_kor(a, b); }
+    static inline bool any(M m) { return m != 0; }
+
+    static inline F select(M m, F a, F b) { return _mm512_mask_blend_ps(m, b, a); }
+
+    static inline F exp2i(F n)
+    {
+        const __m512i e = _mm512_add_epi32(avx512_cvttps_epi32(n), _mm512_set1_epi32(127));
+        return _mm512_castsi512_ps(avx512_slli_epi32<23>(e));
+    }
+
+    static inline F frexp(F x, F & e)
+    {
+        const __m512i i = _mm512_castps_si512(x);
+        const __m512i biased = _mm512_and_si512(avx512_srli_epi32<23>(i), _mm512_set1_epi32(0xff));
+        e = avx512_cvtepi32_ps(_mm512_sub_epi32(biased, _mm512_set1_epi32(127)));
+
+        const __m512i m = _mm512_or_si512(_mm512_and_si512(i, _mm512_set1_epi32(0x007fffff)),
+                                          _mm512_set1_epi32(0x3f800000));
+        return _mm512_castsi512_ps(m);
+    }
+
+    static inline F gather(const float * table, F index)
+    {
+        return avx512_i32gather_ps(avx512_cvttps_epi32(index), table);
+    }
+};
+
+} // anonymous namespace
+
+ACES2OutputTransformApplyFunc * AVX512GetACES2OutputTransformApplyFunc(bool fwd)
+{
+    return fwd ? ACES2::SIMD::ApplyOutputTransform<AVX512Vector, true>
+               : ACES2::SIMD::ApplyOutputTransform<AVX512Vector, false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_SSE2.h"
+
+#if OCIO_USE_SSE2
+
+#include "SSE2.h"
+#include "ops/fixedfunction/ACES2/TransformSIMD.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct SSE2Vector
+{
+    typedef __m128 F;
+    typedef __m128 M;
+    static constexpr int size = 4;
+
+    static inline F load(const float * src) { return _mm_loadu_ps(src); }
+    static inline void store(float * dst, F v) { _mm_storeu_ps(dst, v); }
+    static inline F set1(float v) { return _mm_set1_ps(v); }
+
+    static inline F add(F a, F b) { return _mm_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm_div_ps(a, b); }
+    static inline F min(F a, F b) { return _mm_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm_max_ps(a, b); }
+    static inline F sqrt(F a) { return _mm_sqrt_ps(a); }
+    static inline F abs(F a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+    static inline F copysign(F mag, F sign)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(signMask, mag), _mm_and_ps(signMask, sign));
+    }
+
+    // Only valid for values in the int32 range, which covers all the callers.
+    static inline F floor(F a)
+    {
+        const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+    }
+
+    static inline M lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+    static inline M le(F a, F b) { return _mm_cmple_ps(a, b); }
+    static inline M gt(F a, F b) { return _mm_cmpgt_ps(a, b); }
+    static inline M ge(F a, F b) { return _mm_cmpge_ps(a, b); }
+    static inline M eq(F a, F b) { return _mm_cmpeq_ps(a, b); }
+    static inline M neq(F a, F b) { return _mm_cmpneq_ps(a, b); }
+    static inline M mand(M a, M b) { return _mm_and_ps(a, b); }
+    static inline M mor(M a, M b) { return _mm_or_ps(a, b); }
+    static inline bool any(M m) { return _mm_movemask_ps(m) != 0; }
+
+    static inline F select(M m, F a, F b)
+    {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+
+    static inline F exp2i(F n)
+    {
+        const __m128i e = _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+    }
+
+    static inline F frexp(F x, F & e)
+    {
+        const __m128i i = _mm_castps_si128(x);
+        const __m128i biased = _mm_and_si128(_mm_srli_epi32(i, 23), _mm_set1_epi32(0xff));
+        e = _mm_cvtepi32_ps(_mm_sub_epi32(biased, _mm_set1_epi32(127)));
+
+        const __m128i m = _mm_or_si128(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)),
+                                       _mm_set1_epi32(0x3f800000));
+        return _mm_castsi128_ps(m);
+    }
+
+    static inline F gather(const float * table, F index)
+    {
+        alignas(16) int indices[4];
+        _mm_store_si128((__m128i *)indices, _mm_cvttps_epi32(index));
+        return _mm_setr_ps(table[indices[0]], table[indices[1]],
+                           table[indices[2]], table[indices[3]]);
+    }
+};
+
+} // anonymous namespace
+
+ACES2OutputTransformApplyFunc * SSE2GetACES2OutputTransformApplyFunc(bool fwd)
+{
+    return fwd ? ACES2::SIMD::ApplyOutputTransform<SSE2Vector, true>
+               : ACES2::SIMD::ApplyOutputTransform<SSE2Vector, false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
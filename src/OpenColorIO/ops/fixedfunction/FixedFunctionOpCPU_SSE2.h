@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SSE2_H
+#define INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SSE2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/fixedfunction/ACES2/Common.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the ACES 2.0 Output Transform to packed RGBA float pixels.
+typedef void (ACES2OutputTransformApplyFunc)(const ACES2::JMhParams &, const ACES2::JMhParams &,
+                                             const ACES2::ToneScaleParams &,
+                                             const ACES2::SharedCompressionParameters &,
+                                             const ACES2::ChromaCompressParams &,
+                                             const ACES2::GamutCompressParams &,
+                                             const void *, void *, long);
+
+#if OCIO_USE_SSE2
+
+ACES2OutputTransformApplyFunc * SSE2GetACES2OutputTransformApplyFunc(bool fwd);
+
+#endif // OCIO_USE_SSE2
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SSE2_H */
@@ -7,7 +7,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ops/gamma/GammaOpCPU.h"
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpCPU_AVX512.h"
 #include "ops/gamma/GammaOpUtils.h"
 
 #include "SSE.h"
@@ -208,12 +211,59 @@ public:
 };
 #endif
 
+#if OCIO_USE_SSE2
+// Renderer processing several pixels at once using the widest instruction set available at
+// runtime. It handles all the styles and is only used for the fast power approximation.
+class GammaOpCPUSIMD : public OpCPU
+{
+public:
+    GammaOpCPUSIMD() = delete;
+    GammaOpCPUSIMD(const GammaOpCPUSIMD &) = delete;
+    GammaOpCPUSIMD(ConstGammaOpDataRcPtr & gamma, GammaOpCPUApplyFunc * applyFunc);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    RendererParams m_red;
+    RendererParams m_green;
+    RendererParams m_blue;
+    RendererParams m_alpha;
+
+    GammaOpCPUApplyFunc * m_applyFunc;
+};
+
+namespace
+{
+
+GammaOpCPUApplyFunc * GetGammaApplyFunc(GammaOpData::Style style)
+{
+    std::ignore = style;
+
+    return SelectCPUKernel<GammaOpCPUApplyFunc>(nullptr,
+                                                OCIO_AVX2_KERNEL(AVX2GetGammaApplyFunc(style)),
+                                                OCIO_AVX512_KERNEL(AVX512GetGammaApplyFunc(style)));
+}
+
+} // anon namespace
+#endif // OCIO_USE_SSE2
+
 ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 {
 #if OCIO_USE_SSE2 == 0
     std::ignore = fastPower;
 #endif
 
+#if OCIO_USE_SSE2
+    if (fastPower)
+    {
+        GammaOpCPUApplyFunc * applyFunc = GetGammaApplyFunc(gamma->getStyle());
+        if (applyFunc)
+        {
+            return std::make_shared<GammaOpCPUSIMD>(gamma, applyFunc);
+        }
+    }
+#endif
+
     switch(gamma->getStyle())
     {
         case GammaOpData::MONCURVE_FWD:
@@ -292,6 +342,61 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 }
 
 
+#if OCIO_USE_SSE2
+GammaOpCPUSIMD::GammaOpCPUSIMD(ConstGammaOpDataRcPtr & gamma, GammaOpCPUApplyFunc * applyFunc)
+    :   OpCPU()
+    ,   m_applyFunc(applyFunc)
+{
+    switch (gamma->getStyle())
+    {
+        case GammaOpData::MONCURVE_FWD:
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        {
+            ComputeParamsFwd(gamma->getRedParams(),   m_red);
+            ComputeParamsFwd(gamma->getGreenParams(), m_green);
+            ComputeParamsFwd(gamma->getBlueParams(),  m_blue);
+            ComputeParamsFwd(gamma->getAlphaParams(), m_alpha);
+            break;
+        }
+        case GammaOpData::MONCURVE_REV:
+        case GammaOpData::MONCURVE_MIRROR_REV:
+        {
+            ComputeParamsRev(gamma->getRedParams(),   m_red);
+            ComputeParamsRev(gamma->getGreenParams(), m_green);
+            ComputeParamsRev(gamma->getBlueParams(),  m_blue);
+            ComputeParamsRev(gamma->getAlphaParams(), m_alpha);
+            break;
+        }
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        {
+            // The basic styles only need the power to apply.
+            m_red.gamma   = (float)gamma->getRedParams()[0];
+            m_green.gamma = (float)gamma->getGreenParams()[0];
+            m_blue.gamma  = (float)gamma->getBlueParams()[0];
+            m_alpha.gamma = (float)gamma->getAlphaParams()[0];
+            break;
+        }
+        case GammaOpData::BASIC_REV:
+        case GammaOpData::BASIC_MIRROR_REV:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+        {
+            m_red.gamma   = (float)(1. / gamma->getRedParams()[0]);
+            m_green.gamma = (float)(1. / gamma->getGreenParams()[0]);
+            m_blue.gamma  = (float)(1. / gamma->getBlueParams()[0]);
+            m_alpha.gamma = (float)(1. / gamma->getAlphaParams()[0]);
+            break;
+        }
+    }
+}
+
+void GammaOpCPUSIMD::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    m_applyFunc(m_red, m_green, m_blue, m_alpha, inImg, outImg, numPixels);
+}
+#endif // OCIO_USE_SSE2
+
 GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
     :   OpCPU()
     ,   m_redGamma(0.0f)
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ChannelParams
+{
+    explicit ChannelParams(const RendererParams & params)
+        : gamma(_mm256_set1_ps(params.gamma))
+        , offset(_mm256_set1_ps(params.offset))
+        , breakPnt(_mm256_set1_ps(params.breakPnt))
+        , slope(_mm256_set1_ps(params.slope))
+        , scale(_mm256_set1_ps(params.scale))
+    {
+    }
+
+    __m256 gamma;
+    __m256 offset;
+    __m256 breakPnt;
+    __m256 slope;
+    __m256 scale;
+};
+
+// Refer to the SSE renderers in GammaOpCPU.cpp for the details of each style. Note that the
+// forward and reverse basic styles only differ by their parameters so only the forward styles
+// are used for them.
+template<GammaOpData::Style STYLE>
+inline __m256 gamma_avx2(__m256 pixel, const ChannelParams & p)
+{
+    constexpr bool mirror = STYLE == GammaOpData::BASIC_MIRROR_FWD
+                            || STYLE == GammaOpData::MONCURVE_MIRROR_FWD
+                            || STYLE == GammaOpData::MONCURVE_MIRROR_REV;
+
+    const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+
+    __m256 sign = _mm256_setzero_ps();
+    if (mirror)
+    {
+        sign  = _mm256_and_ps(pixel, signMask);
+        pixel = _mm256_andnot_ps(signMask, pixel);
+    }
+
+    __m256 data;
+    if constexpr (STYLE == GammaOpData::BASIC_FWD || STYLE == GammaOpData::BASIC_MIRROR_FWD)
+    {
+        data = avx2Power(pixel, p.gamma);
+    }
+    else if constexpr (STYLE == GammaOpData::BASIC_PASS_THRU_FWD)
+    {
+        data = avx2Power(pixel, p.gamma);
+        data = _mm256_blendv_ps(pixel, data,
+                                _mm256_cmp_ps(pixel, _mm256_setzero_ps(), _CMP_GT_OS));
+    }
+    else if constexpr (STYLE == GammaOpData::MONCURVE_FWD
+                       || STYLE == GammaOpData::MONCURVE_MIRROR_FWD)
+    {
+        data = _mm256_add_ps(_mm256_mul_ps(pixel, p.scale), p.offset);
+        data = avx2Power(data, p.gamma);
+        data = _mm256_blendv_ps(_mm256_mul_ps(pixel, p.slope), data,
+                                _mm256_cmp_ps(pixel, p.breakPnt, _CMP_GT_OS));
+    }
+    else
+    {
+        data = avx2Power(pixel, p.gamma);
+        data = _mm256_sub_ps(_mm256_mul_ps(data, p.scale), p.offset);
+        data = _mm256_blendv_ps(_mm256_mul_ps(pixel, p.slope), data,
+                                _mm256_cmp_ps(pixel, p.breakPnt, _CMP_GT_OS));
+    }
+
+    if (mirror)
+    {
+        data = _mm256_or_ps(sign, data);
+    }
+
+    return data;
+}
+
+template<GammaOpData::Style STYLE>
+void ApplyGamma(const RendererParams & red, const RendererParams & green,
+                const RendererParams & blue, const RendererParams & alpha,
+                const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[4] = { ChannelParams(red), ChannelParams(green),
+                                 ChannelParams(blue), ChannelParams(alpha) };
+
+    avx2ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p](__m256 & r, __m256 & g, __m256 & b, __m256 & a)
+    {
+        r = gamma_avx2<STYLE>(r, p[0]);
+        g = gamma_avx2<STYLE>(g, p[1]);
+        b = gamma_avx2<STYLE>(b, p[2]);
+        a = gamma_avx2<STYLE>(a, p[3]);
+    });
+}
+
+} // anonymous namespace
+
+GammaOpCPUApplyFunc * AVX2GetGammaApplyFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGamma<GammaOpData::BASIC_FWD>;
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGamma<GammaOpData::BASIC_MIRROR_FWD>;
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGamma<GammaOpData::BASIC_PASS_THRU_FWD>;
+        case GammaOpData::MONCURVE_FWD:
+            return ApplyGamma<GammaOpData::MONCURVE_FWD>;
+        case GammaOpData::MONCURVE_REV:
+            return ApplyGamma<GammaOpData::MONCURVE_REV>;
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+            return ApplyGamma<GammaOpData::MONCURVE_MIRROR_FWD>;
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            return ApplyGamma<GammaOpData::MONCURVE_MIRROR_REV>;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GammaOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+struct ChannelParams
+{
+    explicit ChannelParams(const RendererParams & params)
+        : gamma(_mm512_set1_ps(params.gamma))
+        , offset(_mm512_set1_ps(params.offset))
+        , breakPnt(_mm512_set1_ps(params.breakPnt))
+        , slope(_mm512_set1_ps(params.slope))
+        , scale(_mm512_set1_ps(params.scale))
+    {
+    }
+
+    __m512 gamma;
+    __m512 offset;
+    __m512 breakPnt;
+    __m512 slope;
+    __m512 scale;
+};
+
+// Refer to the SSE renderers in GammaOpCPU.cpp for the details of each style. Note that the
+// forward and reverse basic styles only differ by their parameters so only the forward styles
+// are used for them.
+template<GammaOpData::Style STYLE>
+inline __m512 gamma_avx512(__m512 pixel, const ChannelParams & p)
+{
+    constexpr bool mirror = STYLE == GammaOpData::BASIC_MIRROR_FWD
+                            || STYLE == GammaOpData::MONCURVE_MIRROR_FWD
+                            || STYLE == GammaOpData::MONCURVE_MIRROR_REV;
+
+    const __m512i signMask = _mm512_set1_epi32(0x80000000);
+
+    __m512 sign = _mm512_setzero_ps();
+    if (mirror)
+    {
+        sign  = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(pixel), signMask));
+        pixel = _mm512_castsi512_ps(avx512_andnot_si512(signMask, _mm512_castps_si512(pixel)));
+    }
+
+    __m512 data;
+    if constexpr (STYLE == GammaOpData::BASIC_FWD || STYLE == GammaOpData::BASIC_MIRROR_FWD)
+    {
+        data = avx512Power(pixel, p.gamma);
+    }
+    else if constexpr (STYLE == GammaOpData::BASIC_PASS_THRU_FWD)
+    {
+        data = avx512Power(pixel, p.gamma);
+        data = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pixel, _mm512_setzero_ps(), _CMP_GT_OS),
+                                    pixel, data);
+    }
+    else if constexpr (STYLE == GammaOpData::MONCURVE_FWD
+                       || STYLE == GammaOpData::MONCURVE_MIRROR_FWD)
+    {
+        data = _mm512_add_ps(_mm512_mul_ps(pixel, p.scale), p.offset);
+        data = avx512Power(data, p.gamma);
+        data = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pixel, p.breakPnt, _CMP_GT_OS),
+                                    _mm512_mul_ps(pixel, p.slope), data);
+    }
+    else
+    {
+        data = avx512Power(pixel, p.gamma);
+        data = _mm512_sub_ps(_mm512_mul_ps(data, p.scale), p.offset);
+        data = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(pixel, p.breakPnt, _CMP_GT_OS),
+                                    _mm512_mul_ps(pixel, p.slope), data);
+    }
+
+    if (mirror)
+    {
+        data = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(sign),
+                                                   _mm512_castps_si512(data)));
+    }
+
+    return data;
+}
+
+template<GammaOpData::Style STYLE>
+void ApplyGamma(const RendererParams & red, const RendererParams & green,
+                const RendererParams & blue, const RendererParams & alpha,
+                const void * inImg, void * outImg, long numPixels)
+{
+    const ChannelParams p[4] = { ChannelParams(red), ChannelParams(green),
+                                 ChannelParams(blue), ChannelParams(alpha) };
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&p](__m512 & r, __m512 & g, __m512 & b, __m512 & a)
+    {
+        r = gamma_avx512<STYLE>(r, p[0]);
+        g = gamma_avx512<STYLE>(g, p[1]);
+        b = gamma_avx512<STYLE>(b, p[2]);
+        a = gamma_avx512<STYLE>(a, p[3]);
+    });
+}
+
+} // anonymous namespace
+
+GammaOpCPUApplyFunc * AVX512GetGammaApplyFunc(GammaOpData::Style style)
+{
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+            return ApplyGamma<GammaOpData::BASIC_FWD>;
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+            return ApplyGamma<GammaOpData::BASIC_MIRROR_FWD>;
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+            return ApplyGamma<GammaOpData::BASIC_PASS_THRU_FWD>;
+        case GammaOpData::MONCURVE_FWD:
+            return ApplyGamma<GammaOpData::MONCURVE_FWD>;
+        case GammaOpData::MONCURVE_REV:
+            return ApplyGamma<GammaOpData::MONCURVE_REV>;
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+            return ApplyGamma<GammaOpData::MONCURVE_MIRROR_FWD>;
+        case GammaOpData::MONCURVE_MIRROR_REV:
+            return ApplyGamma<GammaOpData::MONCURVE_MIRROR_REV>;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
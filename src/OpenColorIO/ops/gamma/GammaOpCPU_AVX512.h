@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gamma/GammaOpData.h"
+#include "ops/gamma/GammaOpUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the gamma to packed RGBA float pixels using the red, green, blue and alpha rendering
+// parameters. The basic styles only use the gamma parameter i.e. the power to apply.
+typedef void (GammaOpCPUApplyFunc)(const RendererParams &, const RendererParams &,
+                                   const RendererParams &, const RendererParams &,
+                                   const void *, void *, long);
+
+#if OCIO_USE_AVX512
+
+GammaOpCPUApplyFunc * AVX512GetGammaApplyFunc(GammaOpData::Style style);
+
+#endif // OCIO_USE_AVX512
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H */
@@ -1016,6 +1016,8 @@ void GradingBSplineCurveImpl::computeKnotsAndCoefs(KnotsCoefs & knotsCoefs, int
    {
        computeKnotsAndCoefsForHueCurve(knotsCoefs, curveIdx, drawCurveOnly);
    }
+
+   knotsCoefs.computeSegmentGrid(curveIdx);
 }
 
 //------------------------------------------------------------------------------------------------
@@ -1241,6 +1243,70 @@ GradingBSplineCurveImpl::KnotsCoefs::KnotsCoefs(size_t numCurves)
 
     m_coefsArray.resize(DynamicPropertyGradingRGBCurveImpl::GetMaxCoefs());
     m_knotsArray.resize(DynamicPropertyGradingRGBCurveImpl::GetMaxKnots());
+
+    m_segmentGrid.resize(SEGMENT_GRID_SIZE * numCurves);
+    m_segmentGridScale.resize(numCurves);
+}
+
+//------------------------------------------------------------------------------------------------
+//
+void GradingBSplineCurveImpl::KnotsCoefs::computeSegmentGrid(int c)
+{
+    int * grid = m_segmentGrid.data() + c * SEGMENT_GRID_SIZE;
+    std::fill(grid, grid + SEGMENT_GRID_SIZE, 0);
+    m_segmentGridScale[c] = 0.f;
+
+    const int knotsCnt = m_knotsOffsetsArray[2 * c + 1];
+    if (knotsCnt < 2)
+    {
+        return;
+    }
+
+    const float * knots = m_knotsArray.data() + m_knotsOffsetsArray[2 * c];
+    const float knRange = knots[knotsCnt - 1] - knots[0];
+    if (knRange <= 0.f)
+    {
+        return;
+    }
+
+    m_segmentGridScale[c] = static_cast<float>(SEGMENT_GRID_SIZE) / knRange;
+
+    int i = 0;
+    for (int cell = 0; cell < SEGMENT_GRID_SIZE; ++cell)
+    {
+        const float x = knots[0] + knRange * static_cast<float>(cell) / SEGMENT_GRID_SIZE;
+        while (i < knotsCnt - 2 && x >= knots[i + 1])
+        {
+            ++i;
+        }
+        grid[cell] = i;
+    }
+}
+
+//------------------------------------------------------------------------------------------------
+//
+int GradingBSplineCurveImpl::KnotsCoefs::findSegment(int c, float x) const
+{
+    const int knotsCnt = m_knotsOffsetsArray[2 * c + 1];
+    const float * knots = m_knotsArray.data() + m_knotsOffsetsArray[2 * c];
+
+    // Note that a NaN goes to the first cell.
+    const float cell = std::min(std::max(0.f, (x - knots[0]) * m_segmentGridScale[c]),
+                                static_cast<float>(SEGMENT_GRID_SIZE - 1));
+
+    int i = m_segmentGrid[c * SEGMENT_GRID_SIZE + static_cast<int>(cell)];
+
+    // The cell only gives a starting point as the start of the cell may round differently than
+    // x. Step to the first segment ending after x, i.e. the one a linear scan would find.
+    while (i > 0 && x < knots[i])
+    {
+        --i;
+    }
+    while (i < knotsCnt - 2 && x >= knots[i + 1])
+    {
+        ++i;
+    }
+    return i;
 }
 
 //------------------------------------------------------------------------------------------------
@@ -1281,12 +1347,7 @@ float GradingBSplineCurveImpl::KnotsCoefs::evalCurve(int c, float x, float ident
     }
     else
     {
-        int i;
-        for (i = 0; i < knotsCnt - 2; ++i)
-        {
-            if (x < m_knotsArray[knotsOffs + i + 1])
-                break;
-        }
+        const int i = findSegment(c, x);
         const float A  = m_coefsArray[coefsOffs + i];
         const float B  = m_coefsArray[coefsOffs + coefsSets + i];
         const float C  = m_coefsArray[coefsOffs + coefsSets * 2 + i];
@@ -111,6 +111,22 @@ public:
         int m_numCoefs = 0;
         int m_numKnots = 0;
 
+        // The CPU renderers use a uniform grid to find the polynomial segment of a value without
+        // scanning all the knots of a curve. The knot range of each curve is split in
+        // SEGMENT_GRID_SIZE cells, each holding the index of the segment containing the start
+        // of the cell, so a lookup only steps over the few knots falling inside one cell.
+        static constexpr int SEGMENT_GRID_SIZE = 64;
+
+        // Pre-processing arrays of length NumCurves*SEGMENT_GRID_SIZE and NumCurves.
+        std::vector<int> m_segmentGrid;        // Segment indices, relative to each curve.
+        std::vector<float> m_segmentGridScale; // Number of cells per unit of the knot range.
+
+        // Compute the segment grid of a curve. Its knots must already be packed.
+        void computeSegmentGrid(int curveIdx);
+        // Return the index (relative to the curve) of the polynomial segment containing x,
+        // when x is strictly inside the knot range. This is the segment a linear scan would find.
+        int findSegment(int curveIdx, float x) const;
+
         // Forward evaluation of any spline type.
         float evalCurve(int curveIdx, float x, float identity_x) const;
         // Reverse evaluation of B_SPLINE or DIAGONAL_B_SPLINE.
@@ -4,12 +4,15 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/gradingrgbcurve/GradingRGBCurveOpCPU.h"
+#include "ops/gradingrgbcurve/GradingRGBCurveOpCPU_AVX2.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -17,6 +20,17 @@ namespace OCIO_NAMESPACE
 
 namespace
 {
+
+// Return the forward function processing several pixels at once using the widest instruction
+// set available at runtime, or nullptr if there is none.
+GradingRGBCurveOpCPUApplyFunc * GetGradingRGBCurveFwdApplyFunc(bool linToLog)
+{
+    std::ignore = linToLog;
+
+    return SelectCPUKernel<GradingRGBCurveOpCPUApplyFunc>(
+        nullptr, OCIO_AVX2_KERNEL(AVX2GetGradingRGBCurveFwdApplyFunc(linToLog)), nullptr);
+}
+
 class GradingRGBCurveOpCPU : public OpCPU
 {
 public:
@@ -53,6 +67,8 @@ protected:
     }
 
     DynamicPropertyGradingRGBCurveImplRcPtr m_grgbcurve;
+
+    GradingRGBCurveOpCPUApplyFunc * m_applyFunc = nullptr;
 };
 
 GradingRGBCurveOpCPU::GradingRGBCurveOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
@@ -110,7 +126,7 @@ public:
 GradingRGBCurveFwdOpCPU::GradingRGBCurveFwdOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
     : GradingRGBCurveOpCPU(grgbc)
 {
-
+    m_applyFunc = GetGradingRGBCurveFwdApplyFunc(false);
 }
 
 static constexpr auto PixelSize = 4 * sizeof(float);
@@ -126,6 +142,12 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_grgbcurve->getKnotsCoefs(), inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -153,7 +175,10 @@ public:
 GradingRGBCurveLinearFwdOpCPU::GradingRGBCurveLinearFwdOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
     : GradingRGBCurveOpCPU(grgbc)
 {
-
+#if OCIO_USE_SSE2
+    // The vectorized log conversions match the SSE ones.
+    m_applyFunc = GetGradingRGBCurveFwdApplyFunc(true);
+#endif
 }
 
 namespace LogLinConstants
@@ -251,11 +276,20 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         return;
     }
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_grgbcurve->getKnotsCoefs(), inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
+        // The conversions also process the alpha, which is overwritten for in-place processing.
+        const float alpha = in[3];
+
         LinLog(in, out);
 
         // Curves.
@@ -263,7 +297,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
 
         LogLin(out);
 
-        out[3] = in[3];
+        out[3] = alpha;
 
         in += 4;
         out += 4;
@@ -341,6 +375,9 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
+        // The conversions also process the alpha, which is overwritten for in-place processing.
+        const float alpha = in[3];
+
         LinLog(in, out);
 
         // Curves.
@@ -348,7 +385,7 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
 
         LogLin(out);
 
-        out[3] = in[3];
+        out[3] = alpha;
 
         in += 4;
         out += 4;
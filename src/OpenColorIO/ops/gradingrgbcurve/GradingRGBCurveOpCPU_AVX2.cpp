@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "GradingRGBCurveOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Parameters of one curve, refer to KnotsCoefs::evalCurve() for the details.
+struct CurveParams
+{
+    CurveParams(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs, RGBCurveType type)
+    {
+        const int c = static_cast<int>(type);
+
+        const int coefsSets = knotsCoefs.m_coefsOffsetsArray[2 * c + 1] / 3;
+        identity = coefsSets == 0;
+        if (identity)
+        {
+            return;
+        }
+
+        const int coefsOffs = knotsCoefs.m_coefsOffsetsArray[2 * c];
+        const int knotsCnt = knotsCoefs.m_knotsOffsetsArray[2 * c + 1];
+        const int knotsOffs = knotsCoefs.m_knotsOffsetsArray[2 * c];
+
+        knots = knotsCoefs.m_knotsArray.data() + knotsOffs;
+        coefsA = knotsCoefs.m_coefsArray.data() + coefsOffs;
+        coefsB = coefsA + coefsSets;
+        coefsC = coefsB + coefsSets;
+        grid = knotsCoefs.m_segmentGrid.data()
+               + c * GradingBSplineCurveImpl::KnotsCoefs::SEGMENT_GRID_SIZE;
+
+        const float knStartVal = knots[0];
+        const float knEndVal = knots[knotsCnt - 1];
+
+        const float A = coefsA[coefsSets - 1];
+        const float B = coefsB[coefsSets - 1];
+        const float C = coefsC[coefsSets - 1];
+        const float t = knEndVal - knots[knotsCnt - 2];
+
+        knStart   = _mm256_set1_ps(knStartVal);
+        knEnd     = _mm256_set1_ps(knEndVal);
+        lowSlope  = _mm256_set1_ps(coefsB[0]);
+        lowOffs   = _mm256_set1_ps(coefsC[0]);
+        highSlope = _mm256_set1_ps(2.f * A * t + B);
+        highOffs  = _mm256_set1_ps((A * t + B) * t + C);
+        gridScale = _mm256_set1_ps(knotsCoefs.m_segmentGridScale[c]);
+        lastCell  = _mm256_set1_ps(
+            static_cast<float>(GradingBSplineCurveImpl::KnotsCoefs::SEGMENT_GRID_SIZE - 1));
+        lastSegment = _mm256_set1_epi32(knotsCnt - 2);
+    }
+
+    bool identity = true;
+
+    const float * knots = nullptr;
+    const float * coefsA = nullptr;
+    const float * coefsB = nullptr;
+    const float * coefsC = nullptr;
+    const int * grid = nullptr;
+
+    __m256 knStart;
+    __m256 knEnd;
+    __m256 lowSlope;
+    __m256 lowOffs;
+    __m256 highSlope;
+    __m256 highOffs;
+    __m256 gridScale;
+    __m256 lastCell;
+    __m256i lastSegment;
+};
+
+// Evaluate a curve for 8 values, the vector counterpart of KnotsCoefs::evalCurve() where the
+// identity value is the input value.
+inline __m256 EvalCurve(const CurveParams & p, __m256 x)
+{
+    if (p.identity)
+    {
+        return x;
+    }
+
+    // Find the segments using the grid, see KnotsCoefs::findSegment(). Note that max() returns
+    // its second argument for NaN values so these go to the first cell.
+    __m256 cell = _mm256_mul_ps(_mm256_sub_ps(x, p.knStart), p.gridScale);
+    cell = _mm256_min_ps(_mm256_max_ps(cell, _mm256_setzero_ps()), p.lastCell);
+
+    __m256i seg = _mm256_i32gather_epi32(p.grid, _mm256_cvttps_epi32(cell), 4);
+
+    while (true)
+    {
+        const __m256 kn = _mm256_i32gather_ps(p.knots, seg, 4);
+        const __m256i down = _mm256_and_si256(
+            _mm256_cmpgt_epi32(seg, _mm256_setzero_si256()),
+            _mm256_castps_si256(_mm256_cmp_ps(x, kn, _CMP_LT_OQ)));
+        if (_mm256_testz_si256(down, down))
+        {
+            break;
+        }
+        // The mask lanes are -1.
+        seg = _mm256_add_epi32(seg, down);
+    }
+
+    while (true)
+    {
+        const __m256 knNext = _mm256_i32gather_ps(p.knots + 1, seg, 4);
+        const __m256i up = _mm256_and_si256(
+            _mm256_cmpgt_epi32(p.lastSegment, seg),
+            _mm256_castps_si256(_mm256_cmp_ps(x, knNext, _CMP_GE_OQ)));
+        if (_mm256_testz_si256(up, up))
+        {
+            break;
+        }
+        seg = _mm256_sub_epi32(seg, up);
+    }
+
+    const __m256 A  = _mm256_i32gather_ps(p.coefsA, seg, 4);
+    const __m256 B  = _mm256_i32gather_ps(p.coefsB, seg, 4);
+    const __m256 C  = _mm256_i32gather_ps(p.coefsC, seg, 4);
+    const __m256 kn = _mm256_i32gather_ps(p.knots, seg, 4);
+
+    const __m256 t = _mm256_sub_ps(x, kn);
+    __m256 res = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(A, t), B), t), C);
+
+    // Extrapolate the values outside of the knots, the low side wins when both apply.
+    const __m256 high = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(x, p.knEnd), p.highSlope),
+                                      p.highOffs);
+    const __m256 low = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(x, p.knStart), p.lowSlope),
+                                     p.lowOffs);
+
+    res = _mm256_blendv_ps(res, high, _mm256_cmp_ps(x, p.knEnd, _CMP_GE_OQ));
+    res = _mm256_blendv_ps(res, low, _mm256_cmp_ps(x, p.knStart, _CMP_LE_OQ));
+
+    return res;
+}
+
+// Refer to LinLog() and LogLin() in GradingRGBCurveOpCPU.cpp.
+namespace LogLinConstants
+{
+    static constexpr float xbrk = 0.0041318374739483946f;
+    static constexpr float shift = -0.000157849851665374f;
+    static constexpr float m = 1.f / (0.18f + shift);
+    static constexpr float gain = 363.034608563f;
+    static constexpr float offs = -7.f;
+    static constexpr float ybrk = -5.5f;
+}
+
+inline __m256 LinLog(__m256 x)
+{
+    const __m256 flag = _mm256_cmp_ps(x, _mm256_set1_ps(LogLinConstants::xbrk), _CMP_GT_OS);
+
+    const __m256 lin = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(LogLinConstants::gain)),
+                                     _mm256_set1_ps(LogLinConstants::offs));
+
+    const __m256 log = avx2Log2(_mm256_mul_ps(_mm256_add_ps(x,
+                                                            _mm256_set1_ps(LogLinConstants::shift)),
+                                              _mm256_set1_ps(LogLinConstants::m)));
+
+    return _mm256_blendv_ps(lin, log, flag);
+}
+
+inline __m256 LogLin(__m256 x)
+{
+    const __m256 flag = _mm256_cmp_ps(x, _mm256_set1_ps(LogLinConstants::ybrk), _CMP_GT_OS);
+
+    const __m256 lin = _mm256_mul_ps(_mm256_sub_ps(x, _mm256_set1_ps(LogLinConstants::offs)),
+                                     _mm256_set1_ps(1.f / LogLinConstants::gain));
+
+    __m256 log = avx2Power(_mm256_set1_ps(2.0f), x);
+    log = _mm256_mul_ps(log, _mm256_set1_ps(LogLinConstants::shift + 0.18f));
+    log = _mm256_sub_ps(log, _mm256_set1_ps(LogLinConstants::shift));
+
+    return _mm256_blendv_ps(lin, log, flag);
+}
+
+template<bool linToLog>
+void ApplyRGBCurveFwd(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                      const void * inImg, void * outImg, long numPixels)
+{
+    const CurveParams red(knotsCoefs, RGB_RED);
+    const CurveParams green(knotsCoefs, RGB_GREEN);
+    const CurveParams blue(knotsCoefs, RGB_BLUE);
+    const CurveParams master(knotsCoefs, RGB_MASTER);
+
+    avx2ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&](__m256 & r, __m256 & g, __m256 & b, __m256 &)
+    {
+        if (linToLog)
+        {
+            r = LinLog(r);
+            g = LinLog(g);
+            b = LinLog(b);
+        }
+
+        r = EvalCurve(master, EvalCurve(red, r));
+        g = EvalCurve(master, EvalCurve(green, g));
+        b = EvalCurve(master, EvalCurve(blue, b));
+
+        if (linToLog)
+        {
+            r = LogLin(r);
+            g = LogLin(g);
+            b = LogLin(b);
+        }
+    });
+}
+
+} // anonymous namespace
+
+GradingRGBCurveOpCPUApplyFunc * AVX2GetGradingRGBCurveFwdApplyFunc(bool linToLog)
+{
+    return linToLog ? ApplyRGBCurveFwd<true> : ApplyRGBCurveFwd<false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGRGBCURVE_CPU_AVX2_H
+#define INCLUDED_OCIO_GRADINGRGBCURVE_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gradingrgbcurve/GradingBSplineCurve.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the forward RGB curves to packed RGBA float pixels.
+typedef void (GradingRGBCurveOpCPUApplyFunc)(const GradingBSplineCurveImpl::KnotsCoefs &,
+                                             const void *, void *, long);
+
+#if OCIO_USE_AVX2
+
+// The linToLog functions wrap the curves into the lin-to-log and log-to-lin conversions of the
+// GRADING_LIN style.
+GradingRGBCurveOpCPUApplyFunc * AVX2GetGradingRGBCurveFwdApplyFunc(bool linToLog);
+
+#endif // OCIO_USE_AVX2
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGRGBCURVE_CPU_AVX2_H */
@@ -4,15 +4,16 @@
 #include <algorithm>
 #include <cstring>
 #include <cmath>
-#if OCIO_USE_SSE2 == 0
 #include <tuple>
-#endif
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/log/LogOpCPU.h"
+#include "ops/log/LogOpCPU_AVX2.h"
+#include "ops/log/LogOpCPU_AVX512.h"
 #include "ops/log/LogUtils.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -73,6 +74,9 @@ public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULog2LinApplyFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -100,6 +104,9 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULin2LogApplyFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -143,6 +150,9 @@ public:
     explicit CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULog2LinApplyFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -171,6 +181,9 @@ public:
     explicit CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULin2LogApplyFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -193,6 +206,10 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULin2LogApplyFunc * m_applyFunc = nullptr;
+    float m_klog[3];
 };
 #endif
 
@@ -215,12 +232,49 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    LogOpCPULog2LinApplyFunc * m_applyFunc = nullptr;
+    float m_kinv[3];
 };
 #endif
 
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
+#if OCIO_USE_SSE2
+namespace
+{
+
+static constexpr float ONES[3]  = { 1.0f, 1.0f, 1.0f };
+static constexpr float ZEROS[3] = { 0.0f, 0.0f, 0.0f };
+
+// The fast renderers use the widest kernel supported by the CPU, if any, or otherwise fall back
+// to their SSE implementation. Note that all the kernels use the same approximations.
+
+LogOpCPULin2LogApplyFunc * GetLin2LogApplyFunc(bool camera)
+{
+    std::ignore = camera;
+
+    return SelectCPUKernel<LogOpCPULin2LogApplyFunc>(
+        nullptr,
+        OCIO_AVX2_KERNEL(AVX2GetLin2LogApplyFunc(camera)),
+        OCIO_AVX512_KERNEL(AVX512GetLin2LogApplyFunc(camera)));
+}
+
+LogOpCPULog2LinApplyFunc * GetLog2LinApplyFunc(bool camera)
+{
+    std::ignore = camera;
+
+    return SelectCPUKernel<LogOpCPULog2LinApplyFunc>(
+        nullptr,
+        OCIO_AVX2_KERNEL(AVX2GetLog2LinApplyFunc(camera)),
+        OCIO_AVX512_KERNEL(AVX512GetLog2LinApplyFunc(camera)));
+}
+
+} // anon.
+#endif
+
 ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
 {
 #if OCIO_USE_SSE2 == 0
@@ -416,13 +470,22 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
+    , m_applyFunc(GetLin2LogApplyFunc(false))
 {
+    m_klog[0] = m_klog[1] = m_klog[2] = m_logScale;
 }
 void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = log2( max(in, minValue) ) * logScale;
     //
+    if (m_applyFunc)
+    {
+        m_applyFunc(ONES, ZEROS, m_klog, ZEROS, nullptr, nullptr, nullptr,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     static constexpr float minValue = std::numeric_limits<float>::min();
 
     const float * in = (const float *)inImg;
@@ -484,7 +547,9 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
+    , m_applyFunc(GetLog2LinApplyFunc(false))
 {
+    m_kinv[0] = m_kinv[1] = m_kinv[2] = m_log2_base;
 }
 
 void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -497,6 +562,13 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_kinv, ZEROS, ZEROS, ONES, nullptr, nullptr, nullptr,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -574,8 +646,8 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
+    , m_applyFunc(GetLog2LinApplyFunc(false))
 {
-
 }
 
 void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
@@ -590,6 +662,13 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_kinv, m_minuskb, m_minusb, m_minv, nullptr, nullptr, nullptr,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -676,6 +755,7 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
+    , m_applyFunc(GetLin2LogApplyFunc(false))
 {
 }
 
@@ -685,6 +765,14 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //
     // out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
     //
+
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_m, m_b, m_klog, m_kb, nullptr, nullptr, nullptr,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     static constexpr float minValue = std::numeric_limits<float>::min();
 
     const float * in = (const float *)inImg;
@@ -804,6 +892,7 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
 #if OCIO_USE_SSE2
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
+    , m_applyFunc(GetLog2LinApplyFunc(true))
 {
 }
 
@@ -817,6 +906,13 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
     //  out = ( exp2( log2(base)/logSlope * (in - logOffset) ) - linOffset ) / linSlope;
     //
 
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_kinv, m_minuskb, m_minusb, m_minv, m_logSideBreak, m_linsinv, m_minuslino,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -922,6 +1018,7 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
 #if OCIO_USE_SSE2
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
+    , m_applyFunc(GetLin2LogApplyFunc(true))
 {
 }
 
@@ -934,6 +1031,14 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
     //
     //  out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
     //
+
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_m, m_b, m_klog, m_kb, m_linb, m_linearSlope, m_linearOffset,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     static constexpr float minValue = std::numeric_limits<float>::min();
 
     const float * in = (const float *)inImg;
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+#define INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// Lin to log on packed RGBA float pixels (alpha is preserved) i.e.
+//   out = log2( max(minValue, in * m + b) ) * klog + kb
+// The camera style uses out = in * lins + lino for the values below the linear side break linb.
+typedef void (LogOpCPULin2LogApplyFunc)(const float * m, const float * b,
+                                        const float * klog, const float * kb,
+                                        const float * linb, const float * lins, const float * lino,
+                                        const void *, void *, long);
+
+// Log to lin on packed RGBA float pixels (alpha is preserved) i.e.
+//   out = ( exp2( (in + minuskb) * kinv ) + minusb ) * minv
+// The camera style uses out = (in + minuslino) * linsinv for the values below the log side
+// break logb.
+typedef void (LogOpCPULog2LinApplyFunc)(const float * kinv, const float * minuskb,
+                                        const float * minusb, const float * minv,
+                                        const float * logb, const float * linsinv,
+                                        const float * minuslino,
+                                        const void *, void *, long);
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+// Note that the break parameters are ignored (and could be nullptr) when camera is false.
+LogOpCPULin2LogApplyFunc * AVX2GetLin2LogApplyFunc(bool camera);
+LogOpCPULog2LinApplyFunc * AVX2GetLog2LinApplyFunc(bool camera);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_LOGOP_CPU_AVX2_H */
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LogOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+#include <limits>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+template<bool CAMERA>
+void Lin2Log(const float * m, const float * b, const float * klog, const float * kb,
+             const float * linb, const float * lins, const float * lino,
+             const void * inImg, void * outImg, long numPixels)
+{
+    const __m512 minValue = _mm512_set1_ps(std::numeric_limits<float>::min());
+
+    __m512 mm_m[3], mm_b[3], mm_klog[3], mm_kb[3];
+    __m512 mm_linb[3], mm_lins[3], mm_lino[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        mm_m[i]    = _mm512_set1_ps(m[i]);
+        mm_b[i]    = _mm512_set1_ps(b[i]);
+        mm_klog[i] = _mm512_set1_ps(klog[i]);
+        mm_kb[i]   = _mm512_set1_ps(kb[i]);
+
+        mm_linb[i] = _mm512_set1_ps(CAMERA ? linb[i] : 0.0f);
+        mm_lins[i] = _mm512_set1_ps(CAMERA ? lins[i] : 0.0f);
+        mm_lino[i] = _mm512_set1_ps(CAMERA ? lino[i] : 0.0f);
+    }
+
+    auto lin2log = [&](int i, __m512 x) -> __m512
+    {
+        __m512 y = _mm512_add_ps(_mm512_mul_ps(x, mm_m[i]), mm_b[i]);
+        y = avx512_max_ps(y, minValue);
+        y = avx512Log2(y);
+        y = _mm512_add_ps(_mm512_mul_ps(y, mm_klog[i]), mm_kb[i]);
+
+        if (CAMERA)
+        {
+            const __m512 ylin = _mm512_add_ps(_mm512_mul_ps(x, mm_lins[i]), mm_lino[i]);
+            y = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, mm_linb[i], _CMP_GT_OS), ylin, y);
+        }
+
+        return y;
+    };
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&lin2log](__m512 & red, __m512 & grn, __m512 & blu, __m512 & /* alpha */)
+    {
+        red = lin2log(0, red);
+        grn = lin2log(1, grn);
+        blu = lin2log(2, blu);
+    });
+}
+
+template<bool CAMERA>
+void Log2Lin(const float * kinv, const float * minuskb, const float * minusb, const float * minv,
+             const float * logb, const float * linsinv, const float * minuslino,
+             const void * inImg, void * outImg, long numPixels)
+{
+    __m512 mm_kinv[3], mm_minuskb[3], mm_minusb[3], mm_minv[3];
+    __m512 mm_logb[3], mm_linsinv[3], mm_minuslino[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        mm_kinv[i]    = _mm512_set1_ps(kinv[i]);
+        mm_minuskb[i] = _mm512_set1_ps(minuskb[i]);
+        mm_minusb[i]  = _mm512_set1_ps(minusb[i]);
+        mm_minv[i]    = _mm512_set1_ps(minv[i]);
+
+        mm_logb[i]      = _mm512_set1_ps(CAMERA ? logb[i] : 0.0f);
+        mm_linsinv[i]   = _mm512_set1_ps(CAMERA ? linsinv[i] : 0.0f);
+        mm_minuslino[i] = _mm512_set1_ps(CAMERA ? minuslino[i] : 0.0f);
+    }
+
+    auto log2lin = [&](int i, __m512 x) -> __m512
+    {
+        __m512 y = _mm512_mul_ps(_mm512_add_ps(x, mm_minuskb[i]), mm_kinv[i]);
+        y = avx512Exp2(y);
+        y = _mm512_mul_ps(_mm512_add_ps(y, mm_minusb[i]), mm_minv[i]);
+
+        if (CAMERA)
+        {
+            const __m512 ylin = _mm512_mul_ps(_mm512_add_ps(x, mm_minuslino[i]), mm_linsinv[i]);
+            y = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, mm_logb[i], _CMP_GT_OS), ylin, y);
+        }
+
+        return y;
+    };
+
+    avx512ApplyRGBA((const float *)inImg, (float *)outImg, numPixels,
+                  [&log2lin](__m512 & red, __m512 & grn, __m512 & blu, __m512 & /* alpha */)
+    {
+        red = log2lin(0, red);
+        grn = log2lin(1, grn);
+        blu = log2lin(2, blu);
+    });
+}
+
+} // anonymous namespace
+
+LogOpCPULin2LogApplyFunc * AVX512GetLin2LogApplyFunc(bool camera)
+{
+    return camera ? Lin2Log<true> : Lin2Log<false>;
+}
+
+LogOpCPULog2LinApplyFunc * AVX512GetLog2LinApplyFunc(bool camera)
+{
+    return camera ? Log2Lin<true> : Log2Lin<false>;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -54,13 +54,18 @@ inline uint16_t GetLookupValue(const float & val)
     return (uint16_t)val;
 }
 
+// The lookup tables interleave the R, G and B values of each code value (plus one padding
+// value) so that the three lookups of a pixel hit the same cache line. That matters for the
+// 65536 entry tables of the 16-bit and half inputs which are much larger than the L1 cache.
+constexpr unsigned long LookupLutStride = 4;
+
 template<typename InType, typename OutType>
 struct LookupLut
 {
     static inline OutType compute(const OutType * lutData,
                                   const InType & val)
     {
-        return lutData[GetLookupValue(val)];
+        return lutData[GetLookupValue(val) * LookupLutStride];
     }
 };
 
@@ -92,6 +97,8 @@ protected:
 protected:
     unsigned long m_dim = 0;
 
+    // Separate tables for the interpolation, but for a lookup the three pointers are in a
+    // single interleaved table (see LookupLutStride) owned by m_tmpLutR.
     void * m_tmpLutR = nullptr;
     void * m_tmpLutG = nullptr;
     void * m_tmpLutB = nullptr;
@@ -129,12 +136,16 @@ public:
     Lut1DRendererHalfCode() = delete;
 
     explicit Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut)
-        : BaseLut1DRenderer<inBD, outBD>(lut) {}
+        : BaseLut1DRenderer<inBD, outBD>(lut) { setHalfCodeApplyFunc(); }
 
     Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
-        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
+        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) { setHalfCodeApplyFunc(); }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    // The base class functions interpolate a regular domain LUT.
+    void setHalfCodeApplyFunc();
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -404,18 +415,19 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
 
         m_dim = newLut->getArray().getLength();
 
-        m_tmpLutR = new T[m_dim];
-        m_tmpLutG = new T[m_dim];
-        m_tmpLutB = new T[m_dim];
+        T * lookupLut = new T[m_dim * LookupLutStride];
+        m_tmpLutR = lookupLut;
+        m_tmpLutG = lookupLut + 1;
+        m_tmpLutB = lookupLut + 2;
 
         const Array::Values & lutValues = newLut->getArray().getValues();
 
-        // TODO: Would be faster if R, G, B were adjacent in memory?
         for(unsigned long i=0; i<m_dim; ++i)
         {
-            ((T*)m_tmpLutR)[i] = L_ADJUST(lutValues[i*3+0] * outMax);
-            ((T*)m_tmpLutG)[i] = L_ADJUST(lutValues[i*3+1] * outMax);
-            ((T*)m_tmpLutB)[i] = L_ADJUST(lutValues[i*3+2] * outMax);
+            lookupLut[i*LookupLutStride+0] = L_ADJUST(lutValues[i*3+0] * outMax);
+            lookupLut[i*LookupLutStride+1] = L_ADJUST(lutValues[i*3+1] * outMax);
+            lookupLut[i*LookupLutStride+2] = L_ADJUST(lutValues[i*3+2] * outMax);
+            lookupLut[i*LookupLutStride+3] = T(0);
         }
     }
     else
@@ -488,8 +500,13 @@ template<typename T>
 void BaseLut1DRenderer<inBD, outBD>::resetData()
 {
     delete [](T*)m_tmpLutR; m_tmpLutR = nullptr;
-    delete [](T*)m_tmpLutG; m_tmpLutG = nullptr;
-    delete [](T*)m_tmpLutB; m_tmpLutB = nullptr;
+    if (!isLookup())
+    {
+        delete [](T*)m_tmpLutG;
+        delete [](T*)m_tmpLutB;
+    }
+    m_tmpLutG = nullptr;
+    m_tmpLutB = nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -498,6 +515,21 @@ BaseLut1DRenderer<inBD, outBD>::~BaseLut1DRenderer()
     reset();
 }
 
+template<BitDepth inBD, BitDepth outBD>
+void Lut1DRendererHalfCode<inBD, outBD>::setHalfCodeApplyFunc()
+{
+    this->m_applyLutFunc = nullptr;
+
+    // The F16C conversions and the gathers of the 64k entry tables are much faster than the
+    // scalar code (about 8x for RGBA 32f images) except on the CPUs with slow gathers.
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+    {
+        this->m_applyLutFunc = AVX2GetLut1DHalfCodeApplyFunc(inBD, this->m_outBitDepth);
+    }
+#endif
+}
+
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -528,6 +560,13 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
             out += 4;
         }
     }
+    else if (this->m_applyLutFunc)
+    {
+        const float * lutR = (const float *)this->m_tmpLutR;
+        const float * lutG = (const float *)this->m_tmpLutG;
+        const float * lutB = (const float *)this->m_tmpLutB;
+        this->m_applyLutFunc(lutR, lutG, lutB, this->m_dim, inImg, outImg, numPixels);
+    }
     else  // Need to interpolate rather than simply lookup.
     {
         const float * lutR = (const float *)this->m_tmpLutR;
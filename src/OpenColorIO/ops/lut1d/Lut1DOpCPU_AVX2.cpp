@@ -6,6 +6,7 @@
 
 #include <immintrin.h>
 #include <string.h>
+#include <tuple>
 
 #include "AVX2.h"
 
@@ -115,6 +116,160 @@ static inline void linear1D(const float *lutR, const float *lutG,const float *lu
     }
 }
 
+#if OCIO_USE_F16C
+
+// Interpolate a half domain LUT (i.e. one entry per half code value) between the two half
+// values surrounding each float value. That is the vectorized equivalent of the scalar
+// IndexPair::GetEdgeFloatValues() followed by a lerp.
+static inline __m256 apply_half_code_lut_avx2(const float *lut, __m256 v)
+{
+    const __m128i abs_mask  = _mm_set1_epi16(0x7FFF);
+    const __m128i sign_mask = _mm_set1_epi16(short(0x8000));
+    const __m128i half_inf  = _mm_set1_epi16(0x7C00);
+    const __m128i half_max  = _mm_set1_epi16(0x7BFF);
+    const __m128i one_i     = _mm_set1_epi16(1);
+    const __m256  abs_f     = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+
+    // Round to the nearest half, with the infinities clamped to +/-HALF_MAX.
+    __m128i h = _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+    __m128i is_inf = _mm_cmpeq_epi16(_mm_and_si128(h, abs_mask), half_inf);
+    h = _mm_or_si128(_mm_andnot_si128(is_inf, h),
+                     _mm_and_si128(is_inf, _mm_or_si128(_mm_and_si128(h, sign_mask), half_max)));
+
+    const __m256 hf = _mm256_cvtph_ps(h);
+    v = _mm256_blendv_ps(v, hf, _mm256_castsi256_ps(_mm256_cvtepi16_epi32(is_inf)));
+
+    // The surrounding half values are [h-1, h] when h is further from zero than v,
+    // otherwise [h, h+1].
+    const __m256 above = _mm256_cmp_ps(_mm256_and_ps(hf, abs_f), _mm256_and_ps(v, abs_f),
+                                       _CMP_GT_OQ);
+    const __m256i above_i = _mm256_castps_si256(above);
+    const __m128i is_above = _mm_packs_epi32(_mm256_castsi256_si128(above_i),
+                                             _mm256_extracti128_si256(above_i, 1));
+
+    const __m128i valA = _mm_sub_epi16(h, _mm_and_si128(is_above, one_i));
+    __m128i valB = _mm_add_epi16(h, _mm_andnot_si128(is_above, one_i));
+
+    // The next half value may be an infinity, clamp it to +/-HALF_MAX.
+    is_inf = _mm_cmpeq_epi16(_mm_and_si128(valB, abs_mask), half_inf);
+    valB = _mm_or_si128(_mm_andnot_si128(is_inf, valB),
+                        _mm_and_si128(is_inf, _mm_or_si128(_mm_and_si128(valB, sign_mask),
+                                                           half_max)));
+
+    const __m256 fA = _mm256_cvtph_ps(valA);
+    const __m256 fB = _mm256_cvtph_ps(valB);
+    v = _mm256_blendv_ps(v, fB, _mm256_castsi256_ps(_mm256_cvtepi16_epi32(is_inf)));
+
+    // NaNs become 0.
+    __m256 fraction = _mm256_div_ps(_mm256_sub_ps(v, fA), _mm256_sub_ps(fB, fA));
+    fraction = _mm256_andnot_ps(_mm256_cmp_ps(fraction, fraction, _CMP_UNORD_Q), fraction);
+
+    const __m256 a = _mm256_i32gather_ps(lut, _mm256_cvtepu16_epi32(valA), sizeof(float));
+    const __m256 b = _mm256_i32gather_ps(lut, _mm256_cvtepu16_epi32(valB), sizeof(float));
+
+    // Since fraction is in the domain [0, 1), interpolate using 1-fraction in order to avoid
+    // cases like -/+Inf * 0.
+    const __m256 t = _mm256_sub_ps(_mm256_set1_ps(1.0f), fraction);
+    return _mm256_fmadd_ps(_mm256_sub_ps(a, b), t, b);
+}
+
+template <BitDepth inBD, BitDepth outBD>
+static inline void halfCode1D(const float *lutR, const float *lutG,const float *lutB, int /*dim*/, const void *inImg, void *outImg, long numPixels)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+    typedef typename BitDepthInfo<outBD>::Type OutType;
+
+    const InType *src = (const InType*)inImg;
+    OutType *dst = (OutType*)outImg;
+    __m256 r,g,b,a, alpha_scale;
+
+    if (inBD != outBD)
+        alpha_scale = _mm256_set1_ps((float)BitDepthInfo<outBD>::maxValue / (float)BitDepthInfo<inBD>::maxValue);
+
+    int pixel_count = numPixels / 8 * 8;
+    int remainder = numPixels - pixel_count;
+
+    for (int i = 0; i < pixel_count; i += 8 ) {
+        AVX2RGBAPack<inBD>::Load(src, r, g, b, a);
+
+        r = apply_half_code_lut_avx2(lutR, r);
+        g = apply_half_code_lut_avx2(lutG, g);
+        b = apply_half_code_lut_avx2(lutB, b);
+
+        if (inBD != outBD)
+            a = _mm256_mul_ps(a, alpha_scale);
+
+        AVX2RGBAPack<outBD>::Store(dst, r, g, b, a);
+
+        src += 32;
+        dst += 32;
+    }
+
+     // handler leftovers pixels
+    if (remainder) {
+        InType in_buf[32] = {};
+        OutType out_buf[32];
+
+        for (int i = 0; i < remainder*4; i+=4)
+        {
+            in_buf[i + 0] = src[0];
+            in_buf[i + 1] = src[1];
+            in_buf[i + 2] = src[2];
+            in_buf[i + 3] = src[3];
+            src+=4;
+        }
+
+        AVX2RGBAPack<inBD>::Load(in_buf, r, g, b, a);
+
+        r = apply_half_code_lut_avx2(lutR, r);
+        g = apply_half_code_lut_avx2(lutG, g);
+        b = apply_half_code_lut_avx2(lutB, b);
+
+        if (inBD != outBD)
+            a = _mm256_mul_ps(a, alpha_scale);
+
+        AVX2RGBAPack<outBD>::Store(out_buf, r, g, b, a);
+
+        for (int i = 0; i < remainder*4; i+=4)
+        {
+            dst[0] = out_buf[i + 0];
+            dst[1] = out_buf[i + 1];
+            dst[2] = out_buf[i + 2];
+            dst[3] = out_buf[i + 3];
+            dst+=4;
+        }
+    }
+}
+
+template<BitDepth inBD>
+inline Lut1DOpCPUApplyFunc * GetHalfCodeConvertInBitDepth(BitDepth outBD)
+{
+    switch(outBD)
+    {
+        case BIT_DEPTH_UINT8:
+            return halfCode1D<inBD, BIT_DEPTH_UINT8>;
+        case BIT_DEPTH_UINT10:
+            return halfCode1D<inBD, BIT_DEPTH_UINT10>;
+        case BIT_DEPTH_UINT12:
+            return halfCode1D<inBD, BIT_DEPTH_UINT12>;
+        case BIT_DEPTH_UINT16:
+            return halfCode1D<inBD, BIT_DEPTH_UINT16>;
+        case BIT_DEPTH_F16:
+            return halfCode1D<inBD, BIT_DEPTH_F16>;
+        case BIT_DEPTH_F32:
+            return halfCode1D<inBD, BIT_DEPTH_F32>;
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+#endif // OCIO_USE_F16C
+
 template<BitDepth inBD>
 inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
 {
@@ -172,6 +327,38 @@ Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+Lut1DOpCPUApplyFunc * AVX2GetLut1DHalfCodeApplyFunc(BitDepth inBD, BitDepth outBD)
+{
+#if OCIO_USE_F16C
+    // The conversion of the float values to half code values needs F16C.
+    if (CPUInfo::instance().hasF16C())
+    {
+        // Only the float input interpolates between the half code values, the other
+        // input bit-depths directly lookup the values.
+        switch(inBD)
+        {
+            case BIT_DEPTH_F32:
+                return GetHalfCodeConvertInBitDepth<BIT_DEPTH_F32>(outBD);
+            case BIT_DEPTH_UINT8:
+            case BIT_DEPTH_UINT10:
+            case BIT_DEPTH_UINT12:
+            case BIT_DEPTH_UINT16:
+            case BIT_DEPTH_F16:
+            case BIT_DEPTH_UINT14:
+            case BIT_DEPTH_UINT32:
+            case BIT_DEPTH_UNKNOWN:
+            default:
+                break;
+        }
+    }
+#else
+    std::ignore = inBD;
+    std::ignore = outBD;
+#endif
+
+    return nullptr;
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
\ No newline at end of file
@@ -16,6 +16,9 @@ namespace OCIO_NAMESPACE
 
 Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD);
 
+// Interpolation of a half domain LUT i.e. the LUT has an entry for each half value.
+Lut1DOpCPUApplyFunc * AVX2GetLut1DHalfCodeApplyFunc(BitDepth inBD, BitDepth outBD);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
@@ -14,6 +14,7 @@
 #include "ops/OpTools.h"
 #include "Platform.h"
 #include "SSE.h"
+#include "ThreadUtils.h"
 #include "CPUInfo.h"
 #include "Lut3DOpCPU_SSE2.h"
 #include "Lut3DOpCPU_AVX.h"
@@ -75,6 +76,9 @@ public:
 
 };
 
+// Below that number of LUT cubes, the cost of the threads building the RangeTree exceeds the gain.
+constexpr long MinItemsPerThread = 16384;
+
 class InvLut3DRenderer : public OpCPU
 {
     typedef std::vector<unsigned long> ulongVector;
@@ -180,12 +184,31 @@ public:
     void extrapolate3DArray(ConstLut3DOpDataRcPtr & lut);
 
 protected:
+    // Number of pixels searching the RangeTree together.
+    static constexpr unsigned PacketSize = 4;
+
+    // Pixels waiting for a search of the RangeTree, stored per channel.
+    struct Packet
+    {
+        float R[PacketSize];
+        float G[PacketSize];
+        float B[PacketSize];
+    };
+
+    // Search the tree for the inverse of the first numLanes pixels of the packet. Each pixel
+    // visits the leaves in the same order as a search of its own, so the results are the same,
+    // but the tree nodes are only read once and their ranges are tested for all the pixels
+    // at once.
+    void searchPacket(const Packet & packet, unsigned numLanes, float (*results)[3]) const;
+
     float              m_scale;        // output scaling for r, g and b
                                        // components
     long               m_dim;          // grid size of the extrapolated 3d-LUT
     RangeTree          m_tree;         // object to allow fast range queries of
                                        // the LUT
     std::vector<float> m_grvec;        // extrapolated 3d-LUT values
+    unsigned long      m_offs[3];      // offsets of the LUT axes in m_grvec
+    unsigned long      m_newVertList[8]; // offsets of the hypercube path vertices
 
 private:
     InvLut3DRenderer() = delete;
@@ -831,6 +854,30 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 // Max number of sweeps involved in a factorization program list
 #define MAX_SWEEPS 20
 
+// Program lists for the inversion of a 3d-LUT cube, see invert_hypercube().
+constexpr unsigned long InvListLen = 8;
+constexpr long InvOpsList[] =               { 0, 0, 1, 1, 1, 1, 1, 1 };
+constexpr unsigned long InvEnteringList[] = { 2, 1, 0, 2, 0, 2, 0, 2 };
+constexpr unsigned long InvNewVerts[] = {
+    1, 0, 0,
+    1, 1, 1,
+    1, 1, 0,
+    0, 1, 0,
+    0, 1, 1,
+    0, 0, 1,
+    1, 0, 1,
+    1, 0, 0 };
+constexpr unsigned long InvPathList[] = {
+    0, 0, 0,
+    0, 0, 0,
+    0, 1, 2,
+    1, 0, 2,
+    1, 2, 0,
+    2, 1, 0,
+    2, 0, 1,
+    0, 2, 1 };
+constexpr unsigned long InvPathOrder[] = { 1, 0, 2 };
+
 // This function tests a given grid of the LUT to see if it contains the inverse.
 // A customized matrix factorization updating technique is used to compute this
 // as efficiently as possible.
@@ -839,15 +886,15 @@ unsigned long invert_hypercube
     unsigned long    n,
     float*           x_out,
     const float*     gr,
-    unsigned long*   ind2off,
-    float*           val,
-    unsigned long*   guess,
-    unsigned long    list_len,
-    long*            ops_list,
-    unsigned long*   entering_list,
-    unsigned long*   new_vert_list,
-    unsigned long*   path_list,
-    unsigned long*   path_order
+    const unsigned long* ind2off,
+    const float*         val,
+    const unsigned long* guess,
+    unsigned long        list_len,
+    const long*          ops_list,
+    const unsigned long* entering_list,
+    const unsigned long* new_vert_list,
+    const unsigned long* path_list,
+    const unsigned long* path_order
 )
 {
     // Singularity tolerance
@@ -1122,38 +1169,41 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
         throw Exception("Unsupported channel number.");
     }
 
-    float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for (unsigned long i = 0; i < N; i++)
+    ParallelFor(GetNumThreadsForItems(N, MinItemsPerThread), N, [&](long begin, long end)
     {
-        const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
-            m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
-
-        for (unsigned long k = 0; k < m_chans; k++)
+        float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned long i = begin; i < (unsigned long)end; i++)
         {
-            minVal[k] = grvec[baseOffset * m_chans + k];
-            maxVal[k] = minVal[k];
-        }
+            const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
+                m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
 
-        for (unsigned long j = 1; j < corners; j++)
-        {
-            const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
             for (unsigned long k = 0; k < m_chans; k++)
             {
-                minVal[k] = std::min(minVal[k], grvec[index + k]);
-                maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                minVal[k] = grvec[baseOffset * m_chans + k];
+                maxVal[k] = minVal[k];
             }
-        }
 
-        // Expand the ranges slightly to allow for error in forward evaluation.
-        const float TOL = 1e-6f;
+            for (unsigned long j = 1; j < corners; j++)
+            {
+                const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
+                for (unsigned long k = 0; k < m_chans; k++)
+                {
+                    minVal[k] = std::min(minVal[k], grvec[index + k]);
+                    maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                }
+            }
 
-        for (unsigned long k = 0; k < m_chans; k++)
-        {
-            m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
-            m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            // Expand the ranges slightly to allow for error in forward evaluation.
+            const float TOL = 1e-6f;
+
+            for (unsigned long k = 0; k < m_chans; k++)
+            {
+                m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
+                m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initInds()
@@ -1266,41 +1316,45 @@ void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
     m_levels[level].minVals.resize(levelSize * m_chans);
     m_levels[level].maxVals.resize(levelSize * m_chans);
 
-    for (unsigned long i = 0; i < levelSize; i++)
+    ParallelFor(GetNumThreadsForItems(levelSize, MinItemsPerThread), levelSize,
+                [&](long begin, long end)
     {
-        const unsigned long index = m_levels[level].child0offsets[i];
-        for (unsigned long k = 0; k < m_chans; k++)
+        for (unsigned long i = begin; i < (unsigned long)end; i++)
         {
-            m_levels[level].minVals[i * m_chans + k] =
-                m_levels[level + 1].minVals[index * m_chans + k];
-            m_levels[level].maxVals[i * m_chans + k] =
-                m_levels[level + 1].maxVals[index * m_chans + k];
-        }
+            const unsigned long index = m_levels[level].child0offsets[i];
+            for (unsigned long k = 0; k < m_chans; k++)
+            {
+                m_levels[level].minVals[i * m_chans + k] =
+                    m_levels[level + 1].minVals[index * m_chans + k];
+                m_levels[level].maxVals[i * m_chans + k] =
+                    m_levels[level + 1].maxVals[index * m_chans + k];
+            }
 
-        // New min/max combine the min/max for all children from next lower level.
-        for (unsigned long j = 2; j <= maxChildren; j++)
-        {
-            if (m_levels[level].numChildren[i] >= j)
+            // New min/max combine the min/max for all children from next lower level.
+            for (unsigned long j = 2; j <= maxChildren; j++)
             {
-                const unsigned long ind = index + j - 1;
-                for (unsigned long k = 0; k < m_chans; k++)
+                if (m_levels[level].numChildren[i] >= j)
                 {
-                    const float minVal = m_levels[level].minVals[i * m_chans + k];
-                    const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
-                    if (childMinVal < minVal)
+                    const unsigned long ind = index + j - 1;
+                    for (unsigned long k = 0; k < m_chans; k++)
                     {
-                        m_levels[level].minVals[i * m_chans + k] = childMinVal;
-                    }
-                    const float maxVal = m_levels[level].maxVals[i * m_chans + k];
-                    const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
-                    if (childMaxVal > maxVal)
-                    {
-                        m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
+                        const float minVal = m_levels[level].minVals[i * m_chans + k];
+                        const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
+                        if (childMinVal < minVal)
+                        {
+                            m_levels[level].minVals[i * m_chans + k] = childMinVal;
+                        }
+                        const float maxVal = m_levels[level].maxVals[i * m_chans + k];
+                        const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
+                        if (childMaxVal > maxVal)
+                        {
+                            m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
+                        }
                     }
                 }
             }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
@@ -1351,10 +1405,13 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     // Calculate hash for indices.
 
     const unsigned long cnt = static_cast<unsigned long>(m_baseInds.size());
-    for (unsigned long i = 0; i < cnt; i++)
+    ParallelFor(GetNumThreadsForItems(cnt, MinItemsPerThread), cnt, [this](long begin, long end)
     {
-        indsToHash(i);
-    }
+        for (long i = begin; i < end; i++)
+        {
+            indsToHash(i);
+        }
+    });
 
     // Sort indices based on hash.
     std::sort(m_baseInds.begin(), m_baseInds.end());
@@ -1451,6 +1508,21 @@ void InvLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_tree.initialize(m_grvec.data(), m_dim);
     //m_tree.print();
 
+    // Offsets used by the hypercube inversion of each pixel, they only depend on the grid size.
+    const unsigned long* gsz = m_tree.getGridSize();
+    const unsigned long offs[3] = { gsz[2] * gsz[1], gsz[2], 1 };
+    for (int i = 0; i < 8; i++)
+    {
+        // Must happen before * chans.
+        m_newVertList[i] = InvNewVerts[i * 3] * offs[0]
+                         + InvNewVerts[i * 3 + 1] * offs[1]
+                         + InvNewVerts[i * 3 + 2] * offs[2];
+    }
+    for (unsigned long i = 0; i < 3; i++)
+    {
+        m_offs[i] = offs[i] * m_tree.getChans();
+    }
+
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     // (Note that the result should be relative to the unextrapolated LUT,
@@ -1590,147 +1662,196 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
     m_grvec = newArray.getValues();
 }
 
-// TODO apply() needs further optimization work.
+// Return a bit mask of the packet pixels in the [minVals, maxVals] range of a tree node.
+inline unsigned InRangeMask(const float * R, const float * G, const float * B,
+                            const float * minVals, const float * maxVals)
+{
+#if OCIO_USE_SSE2
+    const __m128 r = _mm_loadu_ps(R);
+    const __m128 g = _mm_loadu_ps(G);
+    const __m128 b = _mm_loadu_ps(B);
+
+    __m128 inRange = _mm_and_ps(_mm_cmpge_ps(r, _mm_set1_ps(minVals[0])),
+                                _mm_cmple_ps(r, _mm_set1_ps(maxVals[0])));
+    inRange = _mm_and_ps(inRange, _mm_cmpge_ps(g, _mm_set1_ps(minVals[1])));
+    inRange = _mm_and_ps(inRange, _mm_cmple_ps(g, _mm_set1_ps(maxVals[1])));
+    inRange = _mm_and_ps(inRange, _mm_cmpge_ps(b, _mm_set1_ps(minVals[2])));
+    inRange = _mm_and_ps(inRange, _mm_cmple_ps(b, _mm_set1_ps(maxVals[2])));
+
+    return (unsigned)_mm_movemask_ps(inRange);
+#else
+    unsigned mask = 0;
+    for (unsigned lane = 0; lane < 4; ++lane)
+    {
+        const bool inRange = R[lane] >= minVals[0] && R[lane] <= maxVals[0] &&
+                             G[lane] >= minVals[1] && G[lane] <= maxVals[1] &&
+                             B[lane] >= minVals[2] && B[lane] <= maxVals[2];
+        mask |= inRange ? (1u << lane) : 0u;
+    }
+    return mask;
+#endif
+}
 
-void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void InvLut3DRenderer::searchPacket(const Packet & packet, unsigned numLanes,
+                                    float (*results)[3]) const
 {
-    const unsigned long* gsz = m_tree.getGridSize();
-    const float maxDim = float(gsz[0] - 3u);  // unextrapolated max
+    static_assert(PacketSize == 4, "The range test handles 4 pixels");
+
     const unsigned long chans = m_tree.getChans();
-    const unsigned long depth = m_tree.getDepth();
+    const long depthm1 = (long)m_tree.getDepth() - 1;
     const TreeLevels& levels = m_tree.getLevels();
-    const BaseIndsVec& baseInds = m_tree.getBaseInds();
-
-    unsigned long offs[3] = { gsz[2] * gsz[1], gsz[2], 1 };
-
-    unsigned long list_len = 8;
-    long ops_list[] =               { 0, 0, 1, 1, 1, 1, 1, 1 };
-    unsigned long entering_list[] = { 2, 1, 0, 2, 0, 2, 0, 2 };
-    unsigned long new_verts[] = {
-        1, 0, 0,
-        1, 1, 1,
-        1, 1, 0,
-        0, 1, 0,
-        0, 1, 1,
-        0, 0, 1,
-        1, 0, 1,
-        1, 0, 0 };
-    unsigned long path_list[] = {
-        0, 0, 0,
-        0, 0, 0,
-        0, 1, 2,
-        1, 0, 2,
-        1, 2, 0,
-        2, 1, 0,
-        2, 0, 1,
-        0, 2, 1 };
-    unsigned long path_order[] = { 1, 0, 2 };
-    unsigned long new_vert_list[8];
-    for (int i = 0; i < 8; i++)
-    {
-        new_vert_list[i] =  // must happen before * chans
-            new_verts[i * 3] * offs[0] + new_verts[i * 3 + 1] * offs[1] + new_verts[i * 3 + 2] * offs[2];
-    }
-    for (unsigned long i = 0; i<chans; i++)
-    {
-        offs[i] = offs[i] * chans;
-    }
+
+    // Bit mask of the pixels still searching for their inverse.
+    unsigned pending = (1u << numLanes) - 1u;
 
     const unsigned long MAX_LEVELS = 16;
     unsigned long currentChild[MAX_LEVELS];
     unsigned long currentNumChildren[MAX_LEVELS];
     unsigned long currentChildInd[MAX_LEVELS];
-    for (unsigned long i = 0; i<MAX_LEVELS; i++)
-    {
-        currentChild[i] = 0;
-        currentNumChildren[i] = 1;
-        currentChildInd[i] = 0;
-    }
+    // Bit mask of the pixels in the range of the parent node.
+    unsigned currentLanes[MAX_LEVELS];
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
+    currentChild[0] = 0;
+    currentChildInd[0] = 0;
+    currentLanes[0] = pending;
 
-    for (long i = 0; i<numPixels; ++i)
+    long level = 0;
+    while (level >= 0 && pending)
     {
-        // Although the inverse LUT has been extrapolated, it may not be enough
-        // to cover an HDR float image, so need to clamp.
-
-        // TODO: Should improve this based on actual LUT contents since it
-        // is legal for LUT contents to exceed the typical scaling range.
-        constexpr float inMax = 1.0f;
-        const float R = Clamp(in[0], 0.f, inMax);
-        const float G = Clamp(in[1], 0.f, inMax);
-        const float B = Clamp(in[2], 0.f, inMax);
-
-        const long depthm1 = depth - 1;
-        unsigned long baseIndx[3] = {0, 0, 0};
+        if (currentChild[level] >= currentNumChildren[level])
+        {
+            level--;
+            continue;
+        }
 
-        currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
-        currentChild[0] = 0;
-        currentChildInd[0] = 0;
+        const unsigned long node = currentChildInd[level];
+        currentChild[level]++;
+        currentChildInd[level]++;
 
-        // For now, if no result is found, return 0.
-        float result[3] = { 0.f, 0.f, 0.f };
+        const unsigned inRange = InRangeMask(packet.R, packet.G, packet.B,
+                                             &levels[level].minVals[node * chans],
+                                             &levels[level].maxVals[node * chans])
+                               & currentLanes[level] & pending;
+        if (!inRange)
+        {
+            continue;
+        }
 
-        long level = 0;
-        while (level >= 0)
+        if (level == depthm1)
         {
-            while (currentChild[level] < currentNumChildren[level])
+            const unsigned long* baseIndx = m_tree.getBaseInds()[node].inds;
+
+            for (unsigned lane = 0; lane < numLanes; ++lane)
             {
-                const unsigned long node = currentChildInd[level];
-                const bool inRange =
-                    R >= levels[level].minVals[node * chans] &&
-                    G >= levels[level].minVals[node * chans + 1] &&
-                    B >= levels[level].minVals[node * chans + 2] &&
-                    R <= levels[level].maxVals[node * chans] &&
-                    G <= levels[level].maxVals[node * chans + 1] &&
-                    B <= levels[level].maxVals[node * chans + 2];
-                currentChild[level]++;
-                currentChildInd[level]++;
-
-                if (inRange)
+                if (inRange & (1u << lane))
                 {
-                    if (level == depthm1)
-                    {
-                        for (unsigned long k = 0; k < chans; k++)
-                            baseIndx[k] = baseInds[node].inds[k];
-
-                        float fxval[3] = { R, G, B };
+                    const float fxval[3] = { packet.R[lane], packet.G[lane], packet.B[lane] };
 
-                        const bool valid = (invert_hypercube(3, result, m_grvec.data(),
-                                                             offs, fxval, baseIndx,
-                                                             list_len, ops_list,
-                                                             entering_list, new_vert_list,
-                                                             path_list, path_order) != 0);
-
-                        if (valid)
-                        {
-                            level = 0;  // to exit outer loop
-                            break;
-                        }
-                    }
-                    else
+                    const bool valid
+                        = invert_hypercube(3, results[lane], m_grvec.data(), m_offs, fxval,
+                                           baseIndx, InvListLen, InvOpsList, InvEnteringList,
+                                           m_newVertList, InvPathList, InvPathOrder) != 0;
+                    if (valid)
                     {
-                        const int newLevel = level + 1;
-                        currentNumChildren[newLevel] = levels[level].numChildren[node];
-                        currentChildInd[newLevel] = levels[level].child0offsets[node];
-                        level = newLevel;
-                        currentChild[level] = 0;
+                        pending &= ~(1u << lane);
                     }
                 }
             }
-            level--;
+        }
+        else
+        {
+            const long newLevel = level + 1;
+            currentNumChildren[newLevel] = levels[level].numChildren[node];
+            currentChildInd[newLevel] = levels[level].child0offsets[node];
+            currentChild[newLevel] = 0;
+            currentLanes[newLevel] = inRange;
+            level = newLevel;
+        }
+    }
+}
+
+void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const unsigned long* gsz = m_tree.getGridSize();
+    const float maxDim = float(gsz[0] - 3u);  // unextrapolated max
 
-            // Need to subtract 1 since the indices include the extrapolation.
-            out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
-            out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
-            out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
-            out[3] = in[3];
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    // The pixels are searched in the tree by packets. Each pixel gets the inverse from the
+    // first valid LUT cube in the tree order, as a search of its own would, so a non-injective
+    // LUT gives the same results whatever the neighbouring pixels and the threading are.
+    Packet packet;
+    float packetAlpha[PacketSize];
+    float * packetOut[PacketSize];
+    unsigned numLanes = 0;
+
+    float results[PacketSize][3];
+
+    auto writeResult = [this, maxDim](const float * result, float alpha, float * pixOut)
+    {
+        // Need to subtract 1 since the indices include the extrapolation.
+        pixOut[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+        pixOut[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+        pixOut[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+        pixOut[3] = alpha;
+    };
+
+    auto flushPacket = [&]()
+    {
+        // Unused lanes must hold valid floats for the range tests.
+        for (unsigned lane = numLanes; lane < PacketSize; ++lane)
+        {
+            packet.R[lane] = packet.G[lane] = packet.B[lane] = 0.f;
+        }
+
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+        {
+            // For now, if no result is found, return 0.
+            results[lane][0] = results[lane][1] = results[lane][2] = 0.f;
+        }
+
+        searchPacket(packet, numLanes, results);
+
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+        {
+            writeResult(results[lane], packetAlpha[lane], packetOut[lane]);
+        }
+        numLanes = 0;
+    };
+
+    for (long i = 0; i < numPixels; ++i)
+    {
+        // Although the inverse LUT has been extrapolated, it may not be enough
+        // to cover an HDR float image, so need to clamp.
+
+        // TODO: Should improve this based on actual LUT contents since it
+        // is legal for LUT contents to exceed the typical scaling range.
+        constexpr float inMax = 1.0f;
+        const float RGB[3] = { Clamp(in[0], 0.f, inMax),
+                               Clamp(in[1], 0.f, inMax),
+                               Clamp(in[2], 0.f, inMax) };
+
+        // The input pixel is copied as the processing may be in-place.
+        packet.R[numLanes] = RGB[0];
+        packet.G[numLanes] = RGB[1];
+        packet.B[numLanes] = RGB[2];
+        packetAlpha[numLanes] = in[3];
+        packetOut[numLanes] = out;
+        if (++numLanes == PacketSize)
+        {
+            flushPacket();
         }
 
         in  += 4;
         out += 4;
     }
+
+    if (numLanes > 0)
+    {
+        flushPacket();
+    }
 }
 
 ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
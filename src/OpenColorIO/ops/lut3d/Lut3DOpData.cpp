@@ -1,11 +1,13 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <atomic>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -27,21 +29,43 @@ namespace OCIO_NAMESPACE
 // forward 3D LUT are clamped to someplace on the exterior surface
 // of the 3D LUT.
 
-Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
+namespace
 {
-    if (lut->getDirection() != TRANSFORM_DIR_INVERSE)
+
+// Grid size of the forward 3D LUT approximating an inverse 3D LUT. Using a large number like 48
+// is better for accuracy but it takes longer to build.
+std::atomic<unsigned> g_fastInverseGridSize{ 48u };
+
+struct FastInverseCacheEntry
+{
+    Mutex m_mutex;
+    ConstLut3DOpDataRcPtr m_lut;
+};
+
+typedef OCIO_SHARED_PTR<FastInverseCacheEntry> FastInverseCacheEntryRcPtr;
+
+// Building the inverse takes seconds for the larger grid sizes, so the result is shared by all the
+// processors inverting the same LUT (e.g. a show LUT inverted by each viewer instance). The size
+// of an entry is the one of its LUT values (i.e. about 25 MB for a 129 grid size), so the cache
+// is bounded in bytes as well as in entries.
+class FastInverseCache : public GenericCache<std::string, FastInverseCacheEntryRcPtr>
+{
+public:
+    FastInverseCache()
     {
-        throw Exception("MakeFastLut3DFromInverse expects an inverse LUT");
+        setCapacity(MaxEntries, MaxBytes);
     }
 
-    // TODO: The FastLut will limit inputs to [0,1].  If the forward LUT has an extended range
-    // output, perhaps add a Range op before the FastLut to bring values into [0,1].
+    static constexpr size_t MaxEntries = 16;
+    static constexpr size_t MaxBytes   = 64 * 1024 * 1024;
+};
+
+FastInverseCache g_fastInverseCache;
 
+Lut3DOpDataRcPtr ComposeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut, unsigned gridSize)
+{
     // Make a domain for the composed Lut3D.
-    // TODO: Using a large number like 48 here is better for accuracy,
-    // but it causes a delay when creating the renderer.
-    const long GridSize = 48u;
-    Lut3DOpDataRcPtr newDomain = std::make_shared<Lut3DOpData>(GridSize);
+    Lut3DOpDataRcPtr newDomain = std::make_shared<Lut3DOpData>(gridSize);
 
     newDomain->setFileOutputBitDepth(lut->getFileOutputBitDepth());
 
@@ -58,6 +82,94 @@ Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
     return result;
 }
 
+} // anon.
+
+unsigned GetInverseLut3DGridSize()
+{
+    return g_fastInverseGridSize;
+}
+
+void SetInverseLut3DGridSize(unsigned gridSize)
+{
+    if (gridSize < 2 || gridSize > Lut3DOpData::maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "Inverse 3D LUT grid size '" << gridSize << "' must be in the [2, "
+            << Lut3DOpData::maxSupportedLength << "] range.";
+        throw Exception(oss.str().c_str());
+    }
+
+    g_fastInverseGridSize = gridSize;
+}
+
+void ClearLut3DInverseCaches()
+{
+    g_fastInverseCache.clear();
+}
+
+Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
+{
+    if (lut->getDirection() != TRANSFORM_DIR_INVERSE)
+    {
+        throw Exception("MakeFastLut3DFromInverse expects an inverse LUT");
+    }
+
+    // TODO: The FastLut will limit inputs to [0,1].  If the forward LUT has an extended range
+    // output, perhaps add a Range op before the FastLut to bring values into [0,1].
+
+    const unsigned gridSize = GetInverseLut3DGridSize();
+
+    // Have a two-mutex approach (like the FileTransform cache) so that a second request for the
+    // same LUT waits for the first one to complete instead of building it again.
+    std::ostringstream key;
+    key << lut->getCacheID() << gridSize;
+
+    FastInverseCacheEntryRcPtr entry;
+    {
+        AutoMutex guard(g_fastInverseCache.lock());
+
+        if (g_fastInverseCache.isEnabled())
+        {
+            FastInverseCacheEntryRcPtr & cacheEntry = g_fastInverseCache[key.str()];
+            if (!cacheEntry)
+            {
+                cacheEntry = std::make_shared<FastInverseCacheEntry>();
+            }
+            entry = cacheEntry;
+        }
+    }
+
+    if (!entry)
+    {
+        return ComposeFastLut3DFromInverse(lut, gridSize);
+    }
+
+    ConstLut3DOpDataRcPtr cachedLut;
+    {
+        AutoMutex lock(entry->m_mutex);
+        if (!entry->m_lut)
+        {
+            entry->m_lut = ComposeFastLut3DFromInverse(lut, gridSize);
+
+            const auto & values = entry->m_lut->getArray().getValues();
+
+            AutoMutex guard(g_fastInverseCache.lock());
+            g_fastInverseCache.setEntrySize(key.str(), values.size() * sizeof(values[0]));
+        }
+        cachedLut = entry->m_lut;
+    }
+
+    // The cache key ignores the metadata & the file bit-depth, so take them from the LUT.
+    FormatMetadataImpl metadata;
+    metadata.combine(lut->getFormatMetadata());
+
+    Lut3DOpDataRcPtr result = cachedLut->clone();
+    result->getFormatMetadata() = metadata;
+    result->setFileOutputBitDepth(lut->getFileOutputBitDepth());
+
+    return result;
+}
+
 // 129 allows for a MESH dimension of 7 in the 3dl file format.
 const unsigned long Lut3DOpData::maxSupportedLength = 129;
 
@@ -140,10 +140,14 @@ private:
 bool operator==(const Lut3DOpData & lhs, const Lut3DOpData & rhs);
 
 // Make a forward Lut3DOpData that approximates the exact inverse Lut3DOpData
-// to be used for the fast rendering style.
+// to be used for the fast rendering style. Its grid size is GetInverseLut3DGridSize()
+// and the results are cached using the LUT cacheID.
 // LUT has to be inverse or the function will throw.
 Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut);
 
+// Clear the cache of the MakeFastLut3DFromInverse() results.
+void ClearLut3DInverseCaches();
+
 } // namespace OCIO_NAMESPACE
 
 #endif
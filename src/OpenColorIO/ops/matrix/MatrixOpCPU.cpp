@@ -1,11 +1,16 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
+#include "ops/matrix/MatrixOpCPU_AVX512.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -14,6 +19,49 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Return the widest matrix kernel supported by the CPU, or nullptr to use the SSE (or scalar)
+// implementation.
+MatrixOpCPUApplyFunc * GetMatrixApplyFunc()
+{
+    return SelectCPUKernel<MatrixOpCPUApplyFunc>(nullptr,
+                                                 OCIO_AVX2_KERNEL(AVX2ApplyMatrix),
+                                                 OCIO_AVX512_KERNEL(AVX512ApplyMatrix));
+}
+
+// Process packed RGB pixels by chunks of RGBA pixels (with a zero alpha) so they go through
+// the same matrix implementation as the RGBA images and get exactly the same results.
+void ApplyRGBAsRGBA(const OpCPU & renderer, const float * in, float * out, long numPixels)
+{
+    constexpr long ChunkSize = 256;
+    float rgba[4 * ChunkSize];
+
+    while (numPixels > 0)
+    {
+        const long count = std::min(numPixels, ChunkSize);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            rgba[4 * idx + 0] = in[3 * idx + 0];
+            rgba[4 * idx + 1] = in[3 * idx + 1];
+            rgba[4 * idx + 2] = in[3 * idx + 2];
+            rgba[4 * idx + 3] = 0.f;
+        }
+
+        renderer.apply(rgba, rgba, count);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            out[3 * idx + 0] = rgba[4 * idx + 0];
+            out[3 * idx + 1] = rgba[4 * idx + 1];
+            out[3 * idx + 2] = rgba[4 * idx + 2];
+        }
+
+        in  += 3 * count;
+        out += 3 * count;
+        numPixels -= count;
+    }
+}
+
 class ScaleRenderer : public OpCPU
 {
 public:
@@ -23,6 +71,9 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const float * in, float * out, long numPixels) const override;
+
 private:
     float m_scale[4];
 };
@@ -36,6 +87,9 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const float * in, float * out, long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
@@ -50,6 +104,9 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const float * in, float * out, long numPixels) const override;
+
 private:
 
     float m_column1[4];
@@ -58,6 +115,8 @@ private:
     float m_column4[4];
 
     float m_offset[4];
+
+    MatrixOpCPUApplyFunc * m_applyFunc = nullptr;
 };
 
 class MatrixRenderer : public OpCPU
@@ -69,11 +128,16 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const float * in, float * out, long numPixels) const override;
+
 private:
     float m_column1[4];
     float m_column2[4];
     float m_column3[4];
     float m_column4[4];
+
+    MatrixOpCPUApplyFunc * m_applyFunc = nullptr;
 };
 
 ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -104,6 +168,19 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0];
+        out[1] = in[1] * m_scale[1];
+        out[2] = in[2] * m_scale[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +216,19 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0] + m_offset[0];
+        out[1] = in[1] * m_scale[1] + m_offset[1];
+        out[2] = in[2] * m_scale[2] + m_offset[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -178,6 +268,7 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     m_offset[2] = (float)o[2];
     m_offset[3] = (float)o[3];
 
+    m_applyFunc = GetMatrixApplyFunc();
 }
 
 // Apply the rendering
@@ -208,6 +299,13 @@ MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
 //      image = res1 + res2
 void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_column1, m_column2, m_column3, m_column4, m_offset,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -287,6 +385,11 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+void MatrixWithOffsetRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    ApplyRGBAsRGBA(*this, in, out, numPixels);
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -318,10 +421,19 @@ MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     m_column4[1] = (float)m[dim + 3];
     m_column4[2] = (float)m[twoDim + 3];
     m_column4[3] = (float)m[threeDim + 3];
+
+    m_applyFunc = GetMatrixApplyFunc();
 }
 
 void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_column1, m_column2, m_column3, m_column4, nullptr,
+                    inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
@@ -395,6 +507,11 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    ApplyRGBAsRGBA(*this, in, out, numPixels);
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Compute one output channel as r*m[0] + g*m[1] + b*m[2] + a*m[3], with the additions in the
+// same order as the SSE implementation.
+static inline __m256 dot_avx2(__m256 r, __m256 g, __m256 b, __m256 a, const __m256 * m)
+{
+    return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r, m[0]), _mm256_mul_ps(g, m[1])),
+                         _mm256_add_ps(_mm256_mul_ps(b, m[2]), _mm256_mul_ps(a, m[3])));
+}
+
+} // anonymous namespace
+
+void AVX2ApplyMatrix(const float * column1, const float * column2,
+                     const float * column3, const float * column4,
+                     const float * offset,
+                     const void * inImg, void * outImg, long numPixels)
+{
+    // Matrix decomposition per row i.e. one row per output channel.
+    __m256 m[4][4];
+    __m256 o[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        m[i][0] = _mm256_set1_ps(column1[i]);
+        m[i][1] = _mm256_set1_ps(column2[i]);
+        m[i][2] = _mm256_set1_ps(column3[i]);
+        m[i][3] = _mm256_set1_ps(column4[i]);
+        o[i]    = _mm256_set1_ps(offset ? offset[i] : 0.0f);
+    }
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    if (offset)
+    {
+        avx2ApplyRGBA(in, out, numPixels, [&m, &o](__m256 & r, __m256 & g, __m256 & b, __m256 & a)
+        {
+            const __m256 red = _mm256_add_ps(dot_avx2(r, g, b, a, m[0]), o[0]);
+            const __m256 grn = _mm256_add_ps(dot_avx2(r, g, b, a, m[1]), o[1]);
+            const __m256 blu = _mm256_add_ps(dot_avx2(r, g, b, a, m[2]), o[2]);
+            a = _mm256_add_ps(dot_avx2(r, g, b, a, m[3]), o[3]);
+            r = red;
+            g = grn;
+            b = blu;
+        });
+    }
+    else
+    {
+        avx2ApplyRGBA(in, out, numPixels, [&m](__m256 & r, __m256 & g, __m256 & b, __m256 & a)
+        {
+            const __m256 red = dot_avx2(r, g, b, a, m[0]);
+            const __m256 grn = dot_avx2(r, g, b, a, m[1]);
+            const __m256 blu = dot_avx2(r, g, b, a, m[2]);
+            a = dot_avx2(r, g, b, a, m[3]);
+            r = red;
+            g = grn;
+            b = blu;
+        });
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
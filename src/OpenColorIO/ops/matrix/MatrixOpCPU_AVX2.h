@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+#define INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+// Apply the matrix given by its four columns, and the optional offset (i.e. nullptr when there
+// is no offset), to packed RGBA float pixels.
+typedef void (MatrixOpCPUApplyFunc)(const float *, const float *, const float *, const float *,
+                                    const float *, const void *, void *, long);
+
+#if OCIO_USE_AVX2
+namespace OCIO_NAMESPACE
+{
+
+void AVX2ApplyMatrix(const float * column1, const float * column2,
+                     const float * column3, const float * column4,
+                     const float * offset,
+                     const void * inImg, void * outImg, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
+
+#endif /* INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H */
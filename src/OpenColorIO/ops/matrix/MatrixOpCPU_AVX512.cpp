@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "MatrixOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Compute one output channel as r*m[0] + g*m[1] + b*m[2] + a*m[3], with the additions in the
+// same order as the SSE implementation.
+static inline __m512 dot_avx512(__m512 r, __m512 g, __m512 b, __m512 a, const __m512 * m)
+{
+    return _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(r, m[0]), _mm512_mul_ps(g, m[1])),
+                         _mm512_add_ps(_mm512_mul_ps(b, m[2]), _mm512_mul_ps(a, m[3])));
+}
+
+} // anonymous namespace
+
+void AVX512ApplyMatrix(const float * column1, const float * column2,
+                     const float * column3, const float * column4,
+                     const float * offset,
+                     const void * inImg, void * outImg, long numPixels)
+{
+    // Matrix decomposition per row i.e. one row per output channel.
+    __m512 m[4][4];
+    __m512 o[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        m[i][0] = _mm512_set1_ps(column1[i]);
+        m[i][1] = _mm512_set1_ps(column2[i]);
+        m[i][2] = _mm512_set1_ps(column3[i]);
+        m[i][3] = _mm512_set1_ps(column4[i]);
+        o[i]    = _mm512_set1_ps(offset ? offset[i] : 0.0f);
+    }
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    if (offset)
+    {
+        avx512ApplyRGBA(in, out, numPixels, [&m, &o](__m512 & r, __m512 & g, __m512 & b, __m512 & a)
+        {
+            const __m512 red = _mm512_add_ps(dot_avx512(r, g, b, a, m[0]), o[0]);
+            const __m512 grn = _mm512_add_ps(dot_avx512(r, g, b, a, m[1]), o[1]);
+            const __m512 blu = _mm512_add_ps(dot_avx512(r, g, b, a, m[2]), o[2]);
+            a = _mm512_add_ps(dot_avx512(r, g, b, a, m[3]), o[3]);
+            r = red;
+            g = grn;
+            b = blu;
+        });
+    }
+    else
+    {
+        avx512ApplyRGBA(in, out, numPixels, [&m](__m512 & r, __m512 & g, __m512 & b, __m512 & a)
+        {
+            const __m512 red = dot_avx512(r, g, b, a, m[0]);
+            const __m512 grn = dot_avx512(r, g, b, a, m[1]);
+            const __m512 blu = dot_avx512(r, g, b, a, m[2]);
+            a = dot_avx512(r, g, b, a, m[3]);
+            r = red;
+            g = grn;
+            b = blu;
+        });
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -19,6 +19,9 @@ public:
 
     RangeOpCPU(ConstRangeOpDataRcPtr & range);
 
+    // The same processing applies to the three color channels.
+    bool hasApplyRGB() const override { return true; }
+
 protected:
     float m_scale;
     float m_offset;
@@ -35,6 +38,7 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const float * in, float * out, long numPixels) const override;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +47,7 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const float * in, float * out, long numPixels) const override;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +56,7 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const float * in, float * out, long numPixels) const override;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +65,7 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const float * in, float * out, long numPixels) const override;
 };
 
 
@@ -102,6 +109,17 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void RangeScaleMinMaxRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    const long numValues = 3 * numPixels;
+
+    for(long idx=0; idx<numValues; ++idx)
+    {
+        // NaNs become m_lowerBound.
+        out[idx] = Clamp(in[idx] * m_scale + m_offset, m_lowerBound, m_upperBound);
+    }
+}
+
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -125,6 +143,17 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void RangeMinMaxRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    const long numValues = 3 * numPixels;
+
+    for(long idx=0; idx<numValues; ++idx)
+    {
+        // NaNs become m_lowerBound.
+        out[idx] = Clamp(in[idx], m_lowerBound, m_upperBound);
+    }
+}
+
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -148,6 +177,17 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMinRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    const long numValues = 3 * numPixels;
+
+    for(long idx=0; idx<numValues; ++idx)
+    {
+        // NaNs become m_lowerBound.
+        out[idx] = std::max(m_lowerBound, in[idx]);
+    }
+}
+
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -171,6 +211,17 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMaxRenderer::applyRGB(const float * in, float * out, long numPixels) const
+{
+    const long numValues = 3 * numPixels;
+
+    for(long idx=0; idx<numValues; ++idx)
+    {
+        // NaNs become m_upperBound.
+        out[idx] = std::min(m_upperBound, in[idx]);
+    }
+}
+
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
@@ -331,6 +331,7 @@ FormatRegistry & FormatRegistry::GetInstance()
 FormatRegistry::FormatRegistry()
 {
     registerFileFormat(CreateFileFormat3DL());
+    registerFileFormat(CreateFileFormatBinaryOps());
     registerFileFormat(CreateFileFormatCC());
     registerFileFormat(CreateFileFormatCCC());
     registerFileFormat(CreateFileFormatCDL());
@@ -592,13 +593,25 @@ void FileFormat::write(const ConstConfigRcPtr & /*config*/,
 namespace
 {
 
+// Get the size of a stream already read, used as an estimation of the memory size of the
+// file content once loaded.
+size_t GetStreamSize(std::istream & istream)
+{
+    istream.clear();
+    istream.seekg(0, std::ios_base::end);
+    const std::streamoff size = istream.tellg();
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
 void LoadFileUncached(FileFormat * & returnFormat,
                       CachedFileRcPtr & returnCachedFile,
+                      size_t & returnFileSize,
                       const std::string & filepath,
                       Interpolation interp,
                       const Config& config)
 {
     returnFormat = NULL;
+    returnFileSize = 0;
 
     {
         std::ostringstream oss;
@@ -656,6 +669,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = tryFormat;
             returnCachedFile = cachedFile;
+            returnFileSize = GetStreamSize(*pStream);
 
             return;
         }
@@ -726,6 +740,7 @@ void LoadFileUncached(FileFormat * & returnFormat,
 
             returnFormat = altFormat;
             returnCachedFile = cachedFile;
+            returnFileSize = GetStreamSize(*pStream);
 
             return;
         }
@@ -818,12 +833,12 @@ void GetCachedFileAndFormat(FileFormat * & format,
             // As the entry is a shared pointer instance, having an empty one
             // means that the entry does not exist in the cache. So, it provides
             // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
+            FileCacheResultPtr & entry = g_fileCache[filepath];
+            if (!entry)
             {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
+                entry = std::make_shared<FileCacheResult>();
             }
+            result = entry;
         }
         else
         {
@@ -841,7 +856,11 @@ void GetCachedFileAndFormat(FileFormat * & format,
 
         try
         {
-            LoadFileUncached(result->format, result->cachedFile, filepath, interp, config);
+            size_t fileSize = 0;
+            LoadFileUncached(result->format, result->cachedFile, fileSize, filepath, interp, config);
+
+            AutoMutex guard(g_fileCache.lock());
+            g_fileCache.setEntrySize(filepath, fileSize);
         }
         catch (std::exception & e)
         {
@@ -892,6 +911,16 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+void SetFileCacheCapacity(size_t maxEntries, size_t maxBytes)
+{
+    g_fileCache.setCapacity(maxEntries, maxBytes);
+}
+
+CacheStatistics GetFileCacheStatistics()
+{
+    return g_fileCache.getStatistics();
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -158,6 +158,7 @@ private:
 
 // Registry Builders.
 FileFormat * CreateFileFormat3DL();
+FileFormat * CreateFileFormatBinaryOps();
 FileFormat * CreateFileFormatCC();
 FileFormat * CreateFileFormatCCC();
 FileFormat * CreateFileFormatCDL();
@@ -177,6 +178,7 @@ FileFormat * CreateFileFormatSpiMtx();
 FileFormat * CreateFileFormatTruelight();
 FileFormat * CreateFileFormatVF();
 
+static constexpr char FILEFORMAT_BINARY_OPS[]                  = "OpenColorIO Binary Op List";
 static constexpr char FILEFORMAT_CLF[]                         = "Academy/ASC Common LUT Format";
 static constexpr char FILEFORMAT_CTF[]                         = "Color Transform Format";
 static constexpr char FILEFORMAT_COLOR_CORRECTION[]            = "ColorCorrection";
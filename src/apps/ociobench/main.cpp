@@ -0,0 +1,1163 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "apputils/argparse.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace OCIO = OCIO_NAMESPACE;
+
+namespace
+{
+
+// The timing statistics of one benchmark.
+struct Result
+{
+    std::string m_group;        // i.e. op, config, processor or lut
+    std::string m_name;
+    std::string m_inBitDepth;   // Only for the op benchmarks.
+    std::string m_outBitDepth;  // Only for the op benchmarks.
+    std::string m_layout;       // Only for the op benchmarks.
+    long m_numPixels = 0;       // Only for the op benchmarks.
+
+    unsigned m_iterations = 0;
+    double m_minMs = 0.0;
+    double m_medianMs = 0.0;
+    double m_meanMs = 0.0;
+
+    std::string getID() const
+    {
+        std::string id = m_group + "/" + m_name;
+        if (!m_layout.empty())
+        {
+            id += "/" + m_inBitDepth + "_" + m_outBitDepth + "/" + m_layout;
+        }
+        return id;
+    }
+
+    // Number of processed pixels per second (in millions).
+    double getMPixelsPerSec() const
+    {
+        return m_medianMs > 0.0 ? double(m_numPixels) / (m_medianMs * 1000.0) : 0.0;
+    }
+};
+
+// Check if the benchmark identifier contains the filter string.
+bool Matches(const std::string & id, const std::string & filter)
+{
+    return filter.empty() || id.find(filter) != std::string::npos;
+}
+
+// Run the function once as a warm-up and then iterations times to compute the timing
+// statistics. The optional setup function is called before each run but is not measured.
+void Measure(Result & res,
+             unsigned iterations,
+             const std::function<void()> & fn,
+             const std::function<void()> & setup = nullptr)
+{
+    std::vector<double> durations;
+
+    for (unsigned iter = 0; iter <= iterations; ++iter)
+    {
+        if (setup)
+        {
+            setup();
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        fn();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        // The first run is only a warm-up.
+        if (iter > 0)
+        {
+            durations.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    double sum = 0.0;
+    for (double d : durations)
+    {
+        sum += d;
+    }
+
+    const size_t num = durations.size();
+
+    res.m_iterations = iterations;
+    res.m_minMs = durations.front();
+    res.m_medianMs = (num % 2) ? durations[num / 2]
+                               : 0.5 * (durations[num / 2 - 1] + durations[num / 2]);
+    res.m_meanMs = sum / double(num);
+}
+
+
+//
+// Op benchmarks.
+//
+
+struct OpBenchmark
+{
+    std::string m_name;
+    OCIO::ConstTransformRcPtr m_transform;
+};
+
+OCIO::Lut1DTransformRcPtr CreateLut1D(unsigned long length, bool halfDomain)
+{
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(length, halfDomain);
+    for (unsigned long idx = 0; idx < length; ++idx)
+    {
+        float r = 0.f, g = 0.f, b = 0.f;
+        lut->getValue(idx, r, g, b);
+        // A monotonic curve so the LUT could also be inverted.
+        lut->setValue(idx, r * 0.9f + 0.05f, g * 0.8f + 0.1f, b * 0.95f);
+    }
+    return lut;
+}
+
+OCIO::Lut3DTransformRcPtr CreateLut3D(unsigned long gridSize, OCIO::Interpolation interp)
+{
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    const float scale = 1.f / float(gridSize - 1);
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                // A saturation-like change so the LUT has crosstalk and is invertible.
+                const float R = r * scale, G = g * scale, B = b * scale;
+                const float Y = 0.2126f * R + 0.7152f * G + 0.0722f * B;
+                lut->setValue(r, g, b, Y + (R - Y) * 1.2f, Y + (G - Y) * 1.2f, Y + (B - Y) * 1.2f);
+            }
+        }
+    }
+    lut->setInterpolation(interp);
+    return lut;
+}
+
+// One transform per CPU renderer family (i.e. one per op type and main variants).
+std::vector<OpBenchmark> GetOpBenchmarks()
+{
+    std::vector<OpBenchmark> benchmarks;
+
+    auto add = [&benchmarks](const std::string & name, const OCIO::ConstTransformRcPtr & tr)
+    {
+        benchmarks.push_back({ name, tr });
+    };
+
+    {
+        const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.8, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+        const double offset4[4] = { 0.01, 0.02, 0.03, 0.0 };
+
+        OCIO::MatrixTransformRcPtr mat = OCIO::MatrixTransform::Create();
+        mat->setMatrix(m44);
+        add("matrix", mat);
+
+        mat = OCIO::MatrixTransform::Create();
+        mat->setMatrix(m44);
+        mat->setOffset(offset4);
+        add("matrix_offset", mat);
+
+        const double scale44[16] = { 0.5, 0.0, 0.0, 0.0,
+                                     0.0, 0.6, 0.0, 0.0,
+                                     0.0, 0.0, 0.7, 0.0,
+                                     0.0, 0.0, 0.0, 1.0 };
+        mat = OCIO::MatrixTransform::Create();
+        mat->setMatrix(scale44);
+        add("scale", mat);
+    }
+
+    {
+        OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+        range->setMinInValue(0.1);
+        range->setMaxInValue(0.9);
+        range->setMinOutValue(0.0);
+        range->setMaxOutValue(1.0);
+        add("range", range);
+
+        range = OCIO::RangeTransform::Create();
+        range->setMinInValue(0.1);
+        range->setMinOutValue(0.1);
+        add("range_clamp_min", range);
+    }
+
+    {
+        OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+        const double value[4] = { 2.2, 2.2, 2.2, 1.0 };
+        exp->setValue(value);
+        add("exponent", exp);
+
+        OCIO::ExponentWithLinearTransformRcPtr expLin = OCIO::ExponentWithLinearTransform::Create();
+        const double gamma[4] = { 2.4, 2.4, 2.4, 1.0 };
+        const double offset[4] = { 0.055, 0.055, 0.055, 0.0 };
+        expLin->setGamma(gamma);
+        expLin->setOffset(offset);
+        add("exponent_with_linear", expLin);
+    }
+
+    {
+        OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+        log->setBase(2.0);
+        add("log", log);
+
+        OCIO::LogAffineTransformRcPtr logAffine = OCIO::LogAffineTransform::Create();
+        const double slope[3] = { 0.3, 0.3, 0.3 };
+        logAffine->setLogSideSlopeValue(slope);
+        add("log_affine", logAffine);
+
+        const double linSideBreak[3] = { 0.01, 0.01, 0.01 };
+        OCIO::LogCameraTransformRcPtr logCam = OCIO::LogCameraTransform::Create(linSideBreak);
+        add("log_camera", logCam);
+    }
+
+    {
+        OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+        const double slope[3] = { 1.1, 1.0, 0.9 };
+        const double offset[3] = { 0.01, 0.0, -0.01 };
+        const double power[3] = { 1.2, 1.0, 0.8 };
+        cdl->setSlope(slope);
+        cdl->setOffset(offset);
+        cdl->setPower(power);
+        cdl->setSat(1.2);
+        add("cdl", cdl);
+
+        OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+        ec->setExposure(0.5);
+        ec->setContrast(1.2);
+        add("exposure_contrast_linear", ec);
+
+        ec = OCIO::ExposureContrastTransform::Create();
+        ec->setStyle(OCIO::EXPOSURE_CONTRAST_LOGARITHMIC);
+        ec->setExposure(0.5);
+        ec->setContrast(1.2);
+        add("exposure_contrast_log", ec);
+    }
+
+    {
+        const struct
+        {
+            const char * m_name;
+            OCIO::FixedFunctionStyle m_style;
+        } fixedFunctions[] = {
+            { "fixed_function_aces_red_mod_10",     OCIO::FIXED_FUNCTION_ACES_RED_MOD_10 },
+            { "fixed_function_aces_glow_10",        OCIO::FIXED_FUNCTION_ACES_GLOW_10 },
+            { "fixed_function_aces_dark_to_dim_10", OCIO::FIXED_FUNCTION_ACES_DARK_TO_DIM_10 },
+            { "fixed_function_rgb_to_hsv",          OCIO::FIXED_FUNCTION_RGB_TO_HSV },
+            { "fixed_function_xyz_to_xyy",          OCIO::FIXED_FUNCTION_XYZ_TO_xyY },
+            { "fixed_function_xyz_to_uvy",          OCIO::FIXED_FUNCTION_XYZ_TO_uvY },
+            { "fixed_function_xyz_to_luv",          OCIO::FIXED_FUNCTION_XYZ_TO_LUV },
+            { "fixed_function_lin_to_pq",           OCIO::FIXED_FUNCTION_LIN_TO_PQ },
+        };
+
+        for (const auto & ff : fixedFunctions)
+        {
+            add(ff.m_name, OCIO::FixedFunctionTransform::Create(ff.m_style));
+        }
+
+        const double gamma[1] = { 0.78 };
+        add("fixed_function_rec2100_surround",
+            OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_REC2100_SURROUND, gamma, 1));
+
+        const double gamutComp[7] = { 1.147, 1.264, 1.312, 0.815, 0.803, 0.880, 1.2 };
+        add("fixed_function_aces_gamut_comp_13",
+            OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_ACES_GAMUT_COMP_13,
+                                                 gamutComp, 7));
+
+        // The ACES 2.0 output transforms need many parameters so use a built-in one.
+        const OCIO::BuiltinTransformRegistry & registry = *OCIO::BuiltinTransformRegistry::Get();
+        for (size_t idx = 0; idx < registry.getNumBuiltins(); ++idx)
+        {
+            const std::string style = registry.getBuiltinStyle(idx);
+            if (StringUtils::StartsWith(style, "ACES-OUTPUT") && StringUtils::EndsWith(style, "_2.0"))
+            {
+                OCIO::BuiltinTransformRcPtr builtin = OCIO::BuiltinTransform::Create();
+                builtin->setStyle(style.c_str());
+                add("builtin_aces_output_20", builtin);
+                break;
+            }
+        }
+    }
+
+    {
+        OCIO::GradingPrimary primary(OCIO::GRADING_LOG);
+        primary.m_contrast = OCIO::GradingRGBM(1.1, 1.0, 0.9, 1.2);
+        primary.m_saturation = 1.2;
+        OCIO::GradingPrimaryTransformRcPtr gp
+            = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+        gp->setValue(primary);
+        add("grading_primary", gp);
+
+        OCIO::GradingBSplineCurveRcPtr curve
+            = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 0.5f, 0.6f }, { 1.f, 1.f } });
+        OCIO::GradingRGBCurveTransformRcPtr rgbCurve
+            = OCIO::GradingRGBCurveTransform::Create(OCIO::GRADING_LOG);
+        rgbCurve->setValue(OCIO::GradingRGBCurve::Create(curve, curve, curve, curve));
+        add("grading_rgb_curve", rgbCurve);
+
+        OCIO::GradingTone tone(OCIO::GRADING_LOG);
+        tone.m_midtones.m_master = 1.2;
+        tone.m_scontrast = 1.1;
+        OCIO::GradingToneTransformRcPtr gt = OCIO::GradingToneTransform::Create(OCIO::GRADING_LOG);
+        gt->setValue(tone);
+        add("grading_tone", gt);
+
+        add("grading_hue_curve", OCIO::GradingHueCurveTransform::Create(OCIO::GRADING_LOG));
+    }
+
+    {
+        add("lut1d", CreateLut1D(4096, false));
+        add("lut1d_half_domain", CreateLut1D(65536, true));
+
+        OCIO::Lut1DTransformRcPtr inv = CreateLut1D(4096, false);
+        inv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        add("lut1d_inverse", inv);
+    }
+
+    {
+        add("lut3d_tetrahedral", CreateLut3D(33, OCIO::INTERP_TETRAHEDRAL));
+        add("lut3d_trilinear", CreateLut3D(33, OCIO::INTERP_LINEAR));
+
+        OCIO::Lut3DTransformRcPtr inv = CreateLut3D(33, OCIO::INTERP_TETRAHEDRAL);
+        inv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        add("lut3d_inverse", inv);
+    }
+
+    return benchmarks;
+}
+
+enum ImageLayout
+{
+    LAYOUT_PACKED_RGBA = 0,
+    LAYOUT_PACKED_RGB,
+    LAYOUT_PLANAR_RGBA,
+    LAYOUT_PLANAR_RGB
+};
+
+const char * LayoutToString(ImageLayout layout)
+{
+    switch (layout)
+    {
+        case LAYOUT_PACKED_RGBA: return "packed_rgba";
+        case LAYOUT_PACKED_RGB:  return "packed_rgb";
+        case LAYOUT_PLANAR_RGBA: return "planar_rgba";
+        case LAYOUT_PLANAR_RGB:  return "planar_rgb";
+    }
+    return "";
+}
+
+long GetChannelSizeInBytes(OCIO::BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case OCIO::BIT_DEPTH_UINT8:
+            return 1;
+        case OCIO::BIT_DEPTH_UINT10:
+        case OCIO::BIT_DEPTH_UINT12:
+        case OCIO::BIT_DEPTH_UINT16:
+        case OCIO::BIT_DEPTH_F16:
+            return 2;
+        case OCIO::BIT_DEPTH_F32:
+            return 4;
+        case OCIO::BIT_DEPTH_UINT14:
+        case OCIO::BIT_DEPTH_UINT32:
+        case OCIO::BIT_DEPTH_UNKNOWN:
+            break;
+    }
+
+    throw OCIO::Exception("Unsupported bit-depth.");
+}
+
+// An image buffer of a given bit-depth and layout. The planar images store the planes one
+// after the other in the same buffer.
+class Image
+{
+public:
+    Image(long width, long height, OCIO::BitDepth bitDepth, ImageLayout layout)
+        :   m_buffer(size_t(width * height * 4 * GetChannelSizeInBytes(bitDepth)))
+    {
+        const long chanSize = GetChannelSizeInBytes(bitDepth);
+        char * data = m_buffer.data();
+
+        switch (layout)
+        {
+            case LAYOUT_PACKED_RGBA:
+            case LAYOUT_PACKED_RGB:
+            {
+                const long numChannels = layout == LAYOUT_PACKED_RGBA ? 4 : 3;
+                m_desc = std::make_shared<OCIO::PackedImageDesc>(data, width, height,
+                                                                 numChannels, bitDepth,
+                                                                 chanSize,
+                                                                 chanSize * numChannels,
+                                                                 chanSize * numChannels * width);
+                break;
+            }
+            case LAYOUT_PLANAR_RGBA:
+            case LAYOUT_PLANAR_RGB:
+            {
+                const long planeSize = chanSize * width * height;
+                m_desc = std::make_shared<OCIO::PlanarImageDesc>(data,
+                                                                 data + planeSize,
+                                                                 data + 2 * planeSize,
+                                                                 layout == LAYOUT_PLANAR_RGBA
+                                                                    ? data + 3 * planeSize
+                                                                    : nullptr,
+                                                                 width, height, bitDepth,
+                                                                 chanSize,
+                                                                 chanSize * width);
+                break;
+            }
+        }
+    }
+
+    const OCIO::ImageDesc & getDesc() const { return *m_desc; }
+    OCIO::ImageDesc & getDesc() { return *m_desc; }
+
+private:
+    std::vector<char> m_buffer;
+    std::shared_ptr<OCIO::ImageDesc> m_desc;
+};
+
+struct OpSettings
+{
+    long m_width = 256;
+    long m_height = 64;
+    unsigned m_iterations = 10;
+    unsigned m_numThreads = 1;
+    OCIO::OptimizationFlags m_optimization = OCIO::OPTIMIZATION_NONE;
+    std::vector<OCIO::BitDepth> m_bitDepths;
+    std::vector<ImageLayout> m_layouts;
+};
+
+// Fill the image with a ramp of values (in the [0, 1] range) converted to its bit-depth and
+// layout using an identity processor.
+void FillImage(const OCIO::ConstConfigRcPtr & config, long width, long height, Image & img)
+{
+    std::vector<float> ramp(size_t(width * height * 4));
+    for (size_t idx = 0; idx < ramp.size(); ++idx)
+    {
+        ramp[idx] = float(idx % 1021) / 1020.f;
+    }
+
+    OCIO::PackedImageDesc rampDesc(ramp.data(), width, height, 4);
+
+    OCIO::ConstProcessorRcPtr identity
+        = config->getProcessor(OCIO::MatrixTransform::Create(), OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = identity->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                             img.getDesc().getBitDepth(),
+                                             OCIO::OPTIMIZATION_NONE);
+    cpu->apply(rampDesc, img.getDesc());
+}
+
+void RunOpBenchmarks(const OpSettings & settings,
+                     const std::string & filter,
+                     bool listOnly,
+                     std::vector<Result> & results)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    const long numPixels = settings.m_width * settings.m_height;
+
+    for (const auto & bench : GetOpBenchmarks())
+    {
+        OCIO::ConstProcessorRcPtr processor;
+
+        for (OCIO::BitDepth inBitDepth : settings.m_bitDepths)
+        {
+            for (OCIO::BitDepth outBitDepth : settings.m_bitDepths)
+            {
+                for (ImageLayout layout : settings.m_layouts)
+                {
+                    Result res;
+                    res.m_group = "op";
+                    res.m_name = bench.m_name;
+                    res.m_inBitDepth = OCIO::BitDepthToString(inBitDepth);
+                    res.m_outBitDepth = OCIO::BitDepthToString(outBitDepth);
+                    res.m_layout = LayoutToString(layout);
+                    res.m_numPixels = numPixels;
+
+                    if (!Matches(res.getID(), filter))
+                    {
+                        continue;
+                    }
+
+                    if (listOnly)
+                    {
+                        std::cout << res.getID() << std::endl;
+                        continue;
+                    }
+
+                    if (!processor)
+                    {
+                        processor = config->getProcessor(bench.m_transform,
+                                                         OCIO::TRANSFORM_DIR_FORWARD);
+                    }
+
+                    OCIO::ConstCPUProcessorRcPtr cpu
+                        = processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth,
+                                                              settings.m_optimization);
+
+                    Image src(settings.m_width, settings.m_height, inBitDepth, layout);
+                    Image dst(settings.m_width, settings.m_height, outBitDepth, layout);
+                    FillImage(config, settings.m_width, settings.m_height, src);
+
+                    Measure(res, settings.m_iterations, [&]()
+                    {
+                        cpu->apply(src.getDesc(), dst.getDesc(), settings.m_numThreads);
+                    });
+
+                    results.push_back(res);
+                }
+            }
+        }
+    }
+}
+
+
+//
+// Config loading & processor creation benchmarks.
+//
+
+struct ConfigSource
+{
+    std::string m_name;
+    std::string m_content;    // The config text.
+    std::string m_workingDir; // Used to find the LUT files of config files.
+};
+
+std::vector<ConfigSource> GetConfigSources(const std::string & configFile)
+{
+    std::vector<ConfigSource> sources;
+
+    const OCIO::BuiltinConfigRegistry & registry = OCIO::BuiltinConfigRegistry::Get();
+    for (size_t idx = 0; idx < registry.getNumBuiltinConfigs(); ++idx)
+    {
+        sources.push_back({ registry.getBuiltinConfigName(idx),
+                            registry.getBuiltinConfig(idx),
+                            "" });
+    }
+
+    if (!configFile.empty())
+    {
+        std::ifstream ifs(configFile);
+        if (!ifs)
+        {
+            throw OCIO::Exception(("Could not open the config file '" + configFile + "'.").c_str());
+        }
+
+        std::ostringstream oss;
+        oss << ifs.rdbuf();
+
+        sources.push_back({ std::filesystem::path(configFile).filename().string(),
+                            oss.str(),
+                            std::filesystem::path(configFile).parent_path().string() });
+    }
+
+    return sources;
+}
+
+OCIO::ConstConfigRcPtr LoadConfig(const ConfigSource & source)
+{
+    std::istringstream iss(source.m_content);
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateFromStream(iss)->createEditableCopy();
+    if (!source.m_workingDir.empty())
+    {
+        config->setWorkingDir(source.m_workingDir.c_str());
+    }
+    return config;
+}
+
+void RunConfigBenchmarks(unsigned iterations,
+                         const std::string & configFile,
+                         const std::string & filter,
+                         bool listOnly,
+                         std::vector<Result> & results)
+{
+    for (const auto & source : GetConfigSources(configFile))
+    {
+        Result load;
+        load.m_group = "config";
+        load.m_name = source.m_name;
+
+        Result proc;
+        proc.m_group = "processor";
+        proc.m_name = source.m_name;
+
+        const bool runLoad = Matches(load.getID(), filter);
+        const bool runProc = Matches(proc.getID(), filter);
+
+        if (listOnly)
+        {
+            if (runLoad) std::cout << load.getID() << std::endl;
+            if (runProc) std::cout << proc.getID() << std::endl;
+            continue;
+        }
+
+        if (runLoad)
+        {
+            Measure(load, iterations, [&source]()
+            {
+                LoadConfig(source);
+            });
+            results.push_back(load);
+        }
+
+        if (runProc)
+        {
+            OCIO::ConfigRcPtr config = LoadConfig(source)->createEditableCopy();
+            config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+            // Measure the creation of the default (display, view) processor from the scene
+            // linear role (or the first color space) with all the caches flushed.
+            const char * display = config->getDefaultDisplay();
+            const char * view = config->getDefaultView(display);
+
+            OCIO::ConstColorSpaceRcPtr src = config->getColorSpace(OCIO::ROLE_SCENE_LINEAR);
+            const std::string srcName = src ? src->getName()
+                                            : config->getColorSpaceNameByIndex(0);
+
+            if (!display || !*display || !view || !*view)
+            {
+                continue;
+            }
+
+            OCIO::DisplayViewTransformRcPtr dv = OCIO::DisplayViewTransform::Create();
+            dv->setSrc(srcName.c_str());
+            dv->setDisplay(display);
+            dv->setView(view);
+
+            Measure(proc, iterations, [&config, &dv]()
+            {
+                OCIO::ConstProcessorRcPtr p = config->getProcessor(dv);
+                p->getDefaultCPUProcessor();
+            },
+            []()
+            {
+                OCIO::ClearAllCaches();
+            });
+            results.push_back(proc);
+        }
+    }
+}
+
+
+//
+// LUT file parsing benchmarks.
+//
+
+// Name the baked files after the format as several formats share the same extension.
+std::string GetBakedLutFilename(int formatIdx)
+{
+    std::string filename = std::string(OCIO::Baker::getFormatNameByIndex(formatIdx)) + "."
+                         + OCIO::Baker::getFormatExtensionByIndex(formatIdx);
+    std::replace_if(filename.begin(), filename.end(),
+                    [](char c) { return c == ' ' || c == '/'; }, '_');
+    return filename;
+}
+
+// Bake a LUT for each format supporting the baking in the directory, and return the paths.
+std::vector<std::string> BakeLuts(const std::filesystem::path & dir)
+{
+    static constexpr const char * CONFIG = R"(
+ocio_profile_version: 2
+
+roles:
+  default: lin
+
+colorspaces:
+  - !<ColorSpace>
+    name: lin
+
+  - !<ColorSpace>
+    name: log
+    from_scene_reference: !<GroupTransform>
+      children:
+        - !<CDLTransform> {slope: [1.1, 1, 0.9], power: [0.9, 1, 1.1]}
+        - !<LogAffineTransform> {lin_side_offset: 0.01, log_side_slope: 0.3, log_side_offset: 0.6}
+)";
+
+    std::istringstream iss(CONFIG);
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateFromStream(iss);
+
+    std::vector<std::string> paths;
+
+    for (int idx = 0; idx < OCIO::Baker::getNumFormats(); ++idx)
+    {
+        const std::string format = OCIO::Baker::getFormatNameByIndex(idx);
+
+        OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+        baker->setConfig(config);
+        baker->setFormat(format.c_str());
+        baker->setInputSpace("lin");
+        baker->setTargetSpace("log");
+
+        const std::filesystem::path path = dir / GetBakedLutFilename(idx);
+        std::ofstream ofs(path);
+        baker->bake(ofs);
+
+        paths.push_back(path.string());
+    }
+
+    return paths;
+}
+
+void RunLutBenchmarks(unsigned iterations,
+                      const std::string & lutDir,
+                      const std::string & filter,
+                      bool listOnly,
+                      std::vector<Result> & results)
+{
+    std::vector<std::string> paths;
+
+    std::filesystem::path bakeDir;
+    if (!listOnly)
+    {
+        bakeDir = std::filesystem::temp_directory_path() / "ociobench_luts";
+        std::filesystem::create_directories(bakeDir);
+        paths = BakeLuts(bakeDir);
+    }
+    else
+    {
+        for (int idx = 0; idx < OCIO::Baker::getNumFormats(); ++idx)
+        {
+            paths.push_back(GetBakedLutFilename(idx));
+        }
+    }
+
+    if (!lutDir.empty())
+    {
+        // Also parse all the files of the directory having a known LUT file extension.
+        std::vector<std::string> extensions;
+        for (int idx = 0; idx < OCIO::FileTransform::GetNumFormats(); ++idx)
+        {
+            extensions.push_back(StringUtils::Lower(
+                OCIO::FileTransform::GetFormatExtensionByIndex(idx)));
+        }
+
+        std::vector<std::string> files;
+        for (const auto & entry : std::filesystem::directory_iterator(lutDir))
+        {
+            std::string ext = StringUtils::Lower(entry.path().extension().string());
+            if (entry.is_regular_file() && !ext.empty()
+                && std::find(extensions.begin(), extensions.end(), ext.substr(1)) != extensions.end())
+            {
+                files.push_back(entry.path().string());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        paths.insert(paths.end(), files.begin(), files.end());
+    }
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    for (const auto & path : paths)
+    {
+        Result res;
+        res.m_group = "lut";
+        res.m_name = std::filesystem::path(path).filename().string();
+
+        if (!Matches(res.getID(), filter))
+        {
+            continue;
+        }
+
+        if (listOnly)
+        {
+            std::cout << res.getID() << std::endl;
+            continue;
+        }
+
+        OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+        file->setSrc(path.c_str());
+        file->setInterpolation(OCIO::INTERP_BEST);
+
+        try
+        {
+            // The file cache is flushed before each iteration so the file is always parsed.
+            Measure(res, iterations, [&config, &file]()
+            {
+                config->getProcessor(file);
+            },
+            []()
+            {
+                OCIO::ClearAllCaches();
+            });
+            results.push_back(res);
+        }
+        catch (const OCIO::Exception & ex)
+        {
+            std::cerr << "Skipping '" << path << "': " << ex.what() << std::endl;
+        }
+    }
+
+    if (!bakeDir.empty())
+    {
+        std::filesystem::remove_all(bakeDir);
+    }
+}
+
+
+//
+// Outputs.
+//
+
+std::string JsonEscape(const std::string & str)
+{
+    std::ostringstream oss;
+    for (char c : str)
+    {
+        switch (c)
+        {
+            case '"':  oss << "\\\""; break;
+            case '\\': oss << "\\\\"; break;
+            case '\n': oss << "\\n";  break;
+            case '\t': oss << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                        << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    oss << c;
+                }
+        }
+    }
+    return oss.str();
+}
+
+// Quote a CSV field, the quotes in the field being doubled.
+std::string CsvQuote(const std::string & str)
+{
+    std::string quoted = "\"";
+    for (char c : str)
+    {
+        if (c == '"')
+        {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    quoted += '"';
+    return quoted;
+}
+
+void WriteJson(std::ostream & os, const std::vector<Result> & results, const OpSettings & settings)
+{
+    os << std::setprecision(6);
+    os << "{\n";
+    os << "  \"ocio_version\": \"" << OCIO::GetVersion() << "\",\n";
+    os << "  \"cpu_block_size\": " << OCIO::GetCPUProcessorBlockSize() << ",\n";
+    os << "  \"image_width\": " << settings.m_width << ",\n";
+    os << "  \"image_height\": " << settings.m_height << ",\n";
+    os << "  \"num_threads\": " << settings.m_numThreads << ",\n";
+    os << "  \"results\": [";
+
+    for (size_t idx = 0; idx < results.size(); ++idx)
+    {
+        const Result & res = results[idx];
+        os << (idx == 0 ? "\n" : ",\n");
+        os << "    {"
+           << "\"id\": \"" << JsonEscape(res.getID()) << "\", "
+           << "\"group\": \"" << res.m_group << "\", "
+           << "\"name\": \"" << JsonEscape(res.m_name) << "\", ";
+        if (!res.m_layout.empty())
+        {
+            os << "\"in_bit_depth\": \"" << res.m_inBitDepth << "\", "
+               << "\"out_bit_depth\": \"" << res.m_outBitDepth << "\", "
+               << "\"layout\": \"" << res.m_layout << "\", "
+               << "\"num_pixels\": " << res.m_numPixels << ", "
+               << "\"mpixels_per_sec\": " << res.getMPixelsPerSec() << ", ";
+        }
+        os << "\"iterations\": " << res.m_iterations << ", "
+           << "\"min_ms\": " << res.m_minMs << ", "
+           << "\"median_ms\": " << res.m_medianMs << ", "
+           << "\"mean_ms\": " << res.m_meanMs << "}";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+void WriteCsv(std::ostream & os, const std::vector<Result> & results)
+{
+    os << std::setprecision(6);
+    os << "id,group,name,in_bit_depth,out_bit_depth,layout,num_pixels,"
+          "iterations,min_ms,median_ms,mean_ms,mpixels_per_sec\n";
+
+    for (const auto & res : results)
+    {
+        // Quote the names as file names could contain commas or quotes.
+        os << CsvQuote(res.getID()) << ","
+           << res.m_group << ","
+           << CsvQuote(res.m_name) << ","
+           << res.m_inBitDepth << ","
+           << res.m_outBitDepth << ","
+           << res.m_layout << ","
+           << res.m_numPixels << ","
+           << res.m_iterations << ","
+           << res.m_minMs << ","
+           << res.m_medianMs << ","
+           << res.m_meanMs << ","
+           << res.getMPixelsPerSec() << "\n";
+    }
+}
+
+void WriteTable(std::ostream & os, const std::vector<Result> & results)
+{
+    size_t idWidth = 10;
+    for (const auto & res : results)
+    {
+        idWidth = std::max(idWidth, res.getID().size());
+    }
+
+    os << std::left << std::setw(int(idWidth)) << "Benchmark"
+       << std::right << std::setw(12) << "min (ms)"
+       << std::setw(12) << "median (ms)"
+       << std::setw(12) << "Mpixels/s" << "\n";
+
+    os << std::fixed << std::setprecision(4);
+    for (const auto & res : results)
+    {
+        os << std::left << std::setw(int(idWidth)) << res.getID()
+           << std::right << std::setw(12) << res.m_minMs
+           << std::setw(12) << res.m_medianMs;
+        if (res.m_numPixels > 0)
+        {
+            os << std::setw(12) << std::setprecision(2) << res.getMPixelsPerSec()
+               << std::setprecision(4);
+        }
+        os << "\n";
+    }
+}
+
+// Write the results to a file, or to the standard output for "-".
+void WriteResults(const std::string & filename,
+                  const std::function<void(std::ostream &)> & writer)
+{
+    if (filename == "-")
+    {
+        writer(std::cout);
+        return;
+    }
+
+    std::ofstream ofs(filename);
+    if (!ofs)
+    {
+        throw OCIO::Exception(("Could not open the output file '" + filename + "'.").c_str());
+    }
+    writer(ofs);
+}
+
+} // anon.
+
+
+int main(int argc, const char ** argv)
+{
+    bool help = false;
+    bool listOnly = false;
+    bool optimized = false;
+    std::string groupsStr("op,config,processor,lut");
+    std::string filter;
+    std::string bitDepthsStr("8ui,16ui,16f,32f");
+    std::string layoutsStr("packed_rgba,packed_rgb,planar_rgba,planar_rgb");
+    std::string configFile, lutDir;
+    std::string jsonFile, csvFile;
+    int width = 256, height = 64;
+    int iterations = 10;
+    int numThreads = 1;
+    int blockSize = -1;
+
+    ArgParse ap;
+    ap.options("ociobench -- measure the performance of the ops, processors and file formats\n\n"
+               "usage: ociobench [options]\n\n",
+               "--h",                   &help,          "Display the help and exit",
+               "--help",                &help,          "Display the help and exit",
+               "--list",                &listOnly,      "List the benchmarks and exit",
+               "--groups %s",           &groupsStr,
+                                        "Comma separated list of the benchmark groups to run "\
+                                        "among op, config, processor and lut. Default is all of them",
+               "--filter %s",           &filter,
+                                        "Only run the benchmarks whose identifier contains the string",
+               "--bitdepths %s",        &bitDepthsStr,
+                                        "Comma separated list of bit-depths (i.e. 8ui, 10ui, 12ui, "\
+                                        "16ui, 16f, 32f) whose all the pairs are used by the op "\
+                                        "benchmarks. Default is 8ui,16ui,16f,32f",
+               "--layouts %s",          &layoutsStr,
+                                        "Comma separated list of image layouts among packed_rgba, "\
+                                        "packed_rgb, planar_rgba and planar_rgb. Default is all of them",
+               "--size %d %d",          &width, &height,
+                                        "Image size used by the op benchmarks. Default is 256 64",
+               "--iter %d",             &iterations,
+                                        "Number of measured iterations of each benchmark. Default is 10",
+               "--threads %d",          &numThreads,
+                                        "Number of threads used to process the images, 0 uses all "\
+                                        "the hardware threads. Default is 1",
+               "--blocksize %d",        &blockSize,
+                                        "Number of pixels processed by all the ops before moving to "\
+                                        "the next pixels, 0 disables the blocking",
+               "--optimized",           &optimized,
+                                        "Use the default optimization of the op processors instead of "\
+                                        "none, so the ops could be combined",
+               "--config %s",           &configFile,
+                                        "Also measure the loading and processor creation of this config "\
+                                        "file in addition to the built-in configs",
+               "--lutdir %s",           &lutDir,
+                                        "Also measure the parsing of the LUT files of this directory in "\
+                                        "addition to LUTs baked in each supported format",
+               "--json %s",             &jsonFile,
+                                        "Write the results in JSON to the file ('-' for the standard output)",
+               "--csv %s",              &csvFile,
+                                        "Write the results in CSV to the file ('-' for the standard output)",
+               NULL);
+
+    if (ap.parse(argc, argv) < 0)
+    {
+        std::cerr << ap.geterror() << std::endl;
+        ap.usage();
+        return 1;
+    }
+
+    if (help)
+    {
+        ap.usage();
+        return 0;
+    }
+
+    try
+    {
+        if (width <= 0 || height <= 0 || iterations <= 0 || numThreads < 0)
+        {
+            throw OCIO::Exception("Invalid image size, number of iterations or of threads.");
+        }
+
+        if (blockSize >= 0)
+        {
+            OCIO::SetCPUProcessorBlockSize(static_cast<unsigned>(blockSize));
+        }
+
+        OpSettings settings;
+        settings.m_width = width;
+        settings.m_height = height;
+        settings.m_iterations = static_cast<unsigned>(iterations);
+        settings.m_numThreads = static_cast<unsigned>(numThreads);
+        settings.m_optimization = optimized ? OCIO::OPTIMIZATION_DEFAULT
+                                            : OCIO::OPTIMIZATION_NONE;
+
+        for (const auto & str : StringUtils::Split(bitDepthsStr, ','))
+        {
+            const OCIO::BitDepth bitDepth = OCIO::BitDepthFromString(StringUtils::Trim(str).c_str());
+            GetChannelSizeInBytes(bitDepth); // Throws for unsupported bit-depths.
+            settings.m_bitDepths.push_back(bitDepth);
+        }
+
+        for (const auto & str : StringUtils::Split(layoutsStr, ','))
+        {
+            const std::string name = StringUtils::Trim(str);
+            bool found = false;
+            for (ImageLayout layout : { LAYOUT_PACKED_RGBA, LAYOUT_PACKED_RGB,
+                                        LAYOUT_PLANAR_RGBA, LAYOUT_PLANAR_RGB })
+            {
+                if (name == LayoutToString(layout))
+                {
+                    settings.m_layouts.push_back(layout);
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                throw OCIO::Exception(("Unknown image layout '" + name + "'.").c_str());
+            }
+        }
+
+        std::vector<std::string> groups;
+        for (const auto & str : StringUtils::Split(groupsStr, ','))
+        {
+            groups.push_back(StringUtils::Trim(str));
+        }
+
+        auto hasGroup = [&groups](const char * group)
+        {
+            return std::find(groups.begin(), groups.end(), group) != groups.end();
+        };
+
+        std::vector<Result> results;
+
+        if (hasGroup("op"))
+        {
+            RunOpBenchmarks(settings, filter, listOnly, results);
+        }
+
+        if (hasGroup("config") || hasGroup("processor"))
+        {
+            // The group names are part of the identifiers so filter out the unwanted group.
+            const size_t numResults = results.size();
+            RunConfigBenchmarks(settings.m_iterations, configFile, filter, listOnly, results);
+            results.erase(std::remove_if(results.begin() + numResults, results.end(),
+                                         [&hasGroup](const Result & res)
+                                         {
+                                             return !hasGroup(res.m_group.c_str());
+                                         }),
+                          results.end());
+        }
+
+        if (hasGroup("lut"))
+        {
+            RunLutBenchmarks(settings.m_iterations, lutDir, filter, listOnly, results);
+        }
+
+        if (listOnly)
+        {
+            return 0;
+        }
+
+        if (!jsonFile.empty())
+        {
+            WriteResults(jsonFile, [&](std::ostream & os) { WriteJson(os, results, settings); });
+        }
+
+        if (!csvFile.empty())
+        {
+            WriteResults(csvFile, [&](std::ostream & os) { WriteCsv(os, results); });
+        }
+
+        if (jsonFile != "-" && csvFile != "-")
+        {
+            WriteTable(std::cout, results);
+        }
+    }
+    catch (const OCIO::Exception & ex)
+    {
+        std::cerr << "ociobench error: " << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const std::exception & ex)
+    {
+        std::cerr << "ociobench error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
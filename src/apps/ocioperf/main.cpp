@@ -7,6 +7,7 @@
 #include "apputils/argparse.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <limits>
@@ -177,6 +178,7 @@ int main(int argc, const char **argv)
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
     unsigned iterations = 50;
     bool nocache = false, nooptim = false;
+    int blockSize = -1;
 
     bool useColorspaces = false;
     bool useDisplayview = false;
@@ -218,6 +220,9 @@ int main(int argc, const char **argv)
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--blocksize %d",            &blockSize,
+                                            "Number of pixels processed by all the ops before moving to the next "\
+                                            "pixels, 0 disables the blocking. Default is 1024",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -233,10 +238,16 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (blockSize >= 0)
+    {
+        OCIO::SetCPUProcessorBlockSize(static_cast<unsigned>(blockSize));
+    }
+
     if (verbose)
     {
         std::cout << std::endl;
         std::cout << "OCIO Version: " << OCIO::GetVersion() << std::endl;
+        std::cout << "CPU block size: " << OCIO::GetCPUProcessorBlockSize() << " pixels" << std::endl;
     }
 
     if (!transformFile.empty())
@@ -654,6 +665,52 @@ int main(int argc, const char **argv)
                     m.pause();
                 }
             }
+
+            // Compare the blocked op-chain execution with the op-by-op execution of each scanline.
+
+            const unsigned currentBlockSize = OCIO::GetCPUProcessorBlockSize();
+            if (currentBlockSize > 0 && inBitDepth == outBitDepth)
+            {
+                std::vector<float>    inImg_f32  = img_f32_ref;
+                std::vector<uint16_t> inImg_ui16 = img_ui16_ref;
+
+                OCIO::PackedImageDesc imgDesc(inBitDepth == OCIO::BIT_DEPTH_F32
+                                                ? (void*)&inImg_f32[0] : (void*)&inImg_ui16[0],
+                                              width,
+                                              height,
+                                              numChannels,
+                                              inBitDepth,
+                                              OCIO::AutoStride,
+                                              OCIO::AutoStride,
+                                              OCIO::AutoStride);
+
+                auto MeasureBlockSize = [&](unsigned numPixels) -> float
+                {
+                    OCIO::SetCPUProcessorBlockSize(numPixels);
+
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    for(unsigned iter=0; iter<iterations; ++iter)
+                    {
+                        cpuProcessor->apply(imgDesc);
+                    }
+                    const std::chrono::duration<float, std::milli> duration
+                        = std::chrono::high_resolution_clock::now() - start;
+
+                    return duration.count() / float(std::max(iterations, 1u));
+                };
+
+                const float unblocked = MeasureBlockSize(0);
+                const float blocked   = MeasureBlockSize(currentBlockSize);
+
+                OCIO::SetCPUProcessorBlockSize(currentBlockSize);
+
+                std::cout << "Process the complete image (in place) op by op:\t\t\t"
+                          << unblocked << " ms" << std::endl;
+                std::cout << "Process the complete image (in place) by blocks of "
+                          << currentBlockSize << " pixels:\t"
+                          << blocked << " ms (gain: "
+                          << (blocked > 0.0f ? unblocked / blocked : 0.0f) << "x)" << std::endl;
+            }
         }
 
         if ((testType == 1 || testType == -1) && inBitDepth == outBitDepth)
@@ -3,6 +3,9 @@
 
 #include <fstream>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "PyOpenColorIO.h"
 #include "PyUtils.h"
@@ -125,6 +128,10 @@ Each item is a tuple containing format name and format extension.
              DOC(Baker, getCubeSize))
         .def("setCubeSize", &Baker::setCubeSize, "cubeSize"_a, 
              DOC(Baker, setCubeSize))
+        .def("getNumThreads", &Baker::getNumThreads, 
+             DOC(Baker, getNumThreads))
+        .def("setNumThreads", &Baker::setNumThreads, "numThreads"_a, 
+             DOC(Baker, setNumThreads))
         .def("bake", [](BakerRcPtr & self, const std::string & fileName) 
             {
                 std::ofstream f(fileName.c_str());
@@ -138,7 +145,49 @@ Each item is a tuple containing format name and format extension.
                 self->bake(os);
                 return os.str();
             },
-            DOC(Baker, bake));
+            DOC(Baker, bake))
+        .def("bakeDisplayViews", [](BakerRcPtr & self, 
+                                    const std::vector<std::pair<std::string, std::string>> & displayViews)
+            {
+                const int numDisplayViews = static_cast<int>(displayViews.size());
+
+                std::vector<const char *> displays(numDisplayViews);
+                std::vector<const char *> views(numDisplayViews);
+                std::vector<std::ostringstream> streams(numDisplayViews);
+                std::vector<std::ostream *> outputs(numDisplayViews);
+
+                for (int i = 0; i < numDisplayViews; ++i)
+                {
+                    displays[i] = displayViews[i].first.c_str();
+                    views[i]    = displayViews[i].second.c_str();
+                    outputs[i]  = &streams[i];
+                }
+
+                {
+                    py::gil_scoped_release release;
+                    self->bakeDisplayViews(displays.data(), views.data(), 
+                                           outputs.data(), numDisplayViews);
+                }
+
+                std::vector<std::string> luts;
+                for (const auto & os : streams)
+                {
+                    luts.push_back(os.str());
+                }
+                return luts;
+            },
+             "displayViews"_a,
+             R"doc(
+Bake one LUT per (display, view) tuple of the list and return the LUTs
+as a list of strings, in the same order. All the other baker settings
+are shared by the display / view pairs, which are baked concurrently 
+according to the number of threads.
+
+.. note::
+    The GIL is released during baking, freeing up Python to execute 
+    other threads concurrently.
+
+)doc");
 
     clsFormatIterator
         .def("__len__", [](FormatIterator & /* it */) { return Baker::getNumFormats(); })
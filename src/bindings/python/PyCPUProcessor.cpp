@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
 #include <sstream>
 #include <vector>
 
@@ -12,6 +15,219 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// Flattened buffers are processed as rows of this many pixels so the scanlines could be split
+// across several threads.
+constexpr long FLAT_BUFFER_ROW_SIZE = 1024;
+
+// Describe the pixels of a packed RGB or RGBA Python buffer without copying it.
+struct PyPixelLayout
+{
+    long m_width = 0;
+    long m_height = 0;
+    ptrdiff_t m_chanStrideBytes = 0;
+    ptrdiff_t m_xStrideBytes = 0;
+    ptrdiff_t m_yStrideBytes = 0;
+    // Last partial row of a flattened buffer, processed separately.
+    long m_numRemainingPixels = 0;
+    ptrdiff_t m_remainingOffsetBytes = 0;
+};
+
+PyPixelLayout getPixelLayout(const py::buffer_info & info, long numChannels)
+{
+    checkBufferDivisible(info, numChannels);
+
+    const bool hasChannelAxis = info.ndim >= 2 && info.shape[info.ndim - 1] == numChannels;
+
+    PyPixelLayout layout;
+
+    if (hasChannelAxis && info.ndim == 3)
+    {
+        // A (height, width, channels) image with any strides.
+        layout.m_height = (long)info.shape[0];
+        layout.m_width = (long)info.shape[1];
+        layout.m_chanStrideBytes = (ptrdiff_t)info.strides[2];
+        layout.m_xStrideBytes = (ptrdiff_t)info.strides[1];
+        layout.m_yStrideBytes = (ptrdiff_t)info.strides[0];
+
+        // The processing is independent of the pixel order so transposed images (i.e. with
+        // rows and columns swapped) are processed as is.
+        if (std::abs(layout.m_yStrideBytes) < std::abs(layout.m_xStrideBytes))
+        {
+            std::swap(layout.m_height, layout.m_width);
+            std::swap(layout.m_yStrideBytes, layout.m_xStrideBytes);
+        }
+    }
+    else
+    {
+        // Otherwise, the buffer is a sequence of pixels.
+        long numPixels = 0;
+        ptrdiff_t pixelStrideBytes = 0;
+
+        if (hasChannelAxis && info.ndim == 2)
+        {
+            numPixels = (long)info.shape[0];
+            layout.m_chanStrideBytes = (ptrdiff_t)info.strides[1];
+            pixelStrideBytes = (ptrdiff_t)info.strides[0];
+        }
+        else if (info.ndim == 1)
+        {
+            numPixels = (long)info.size / numChannels;
+            layout.m_chanStrideBytes = (ptrdiff_t)info.strides[0];
+            pixelStrideBytes = layout.m_chanStrideBytes * numChannels;
+        }
+        else
+        {
+            // Any other shape is only supported when the values could be flattened.
+            checkCContiguousArray(info);
+
+            numPixels = (long)info.size / numChannels;
+            layout.m_chanStrideBytes = (ptrdiff_t)info.itemsize;
+            pixelStrideBytes = layout.m_chanStrideBytes * numChannels;
+        }
+
+        layout.m_width = std::min(numPixels, FLAT_BUFFER_ROW_SIZE);
+        layout.m_height = layout.m_width > 0 ? numPixels / layout.m_width : 0;
+        layout.m_xStrideBytes = pixelStrideBytes;
+        layout.m_yStrideBytes = pixelStrideBytes * layout.m_width;
+
+        layout.m_numRemainingPixels = numPixels - layout.m_width * layout.m_height;
+        layout.m_remainingOffsetBytes = layout.m_yStrideBytes * layout.m_height;
+    }
+
+    if (layout.m_height == 1)
+    {
+        // The row stride of a single row image is meaningless.
+        layout.m_yStrideBytes = layout.m_xStrideBytes * layout.m_width;
+    }
+
+    if (std::abs(layout.m_chanStrideBytes) < (ptrdiff_t)info.itemsize
+        || std::abs(layout.m_chanStrideBytes * numChannels) > std::abs(layout.m_xStrideBytes)
+        || std::abs(layout.m_xStrideBytes * layout.m_width) > std::abs(layout.m_yStrideBytes))
+    {
+        std::ostringstream os;
+        os << "Incompatible buffer strides: the pixels of the array with shape ";
+        os << getBufferShapeStr(info) << " overlap or are not stored in rows";
+        throw std::runtime_error(os.str().c_str());
+    }
+
+    return layout;
+}
+
+// Apply to a packed RGB or RGBA Python buffer (in place when dst is null). It is called with
+// the GIL held which is then released during the processing.
+void applyBuffer(const CPUProcessorRcPtr & self,
+                 const py::buffer_info & src,
+                 const py::buffer_info * dst,
+                 long numChannels,
+                 unsigned numThreads)
+{
+    const PyPixelLayout srcLayout = getPixelLayout(src, numChannels);
+    const BitDepth srcBitDepth = getBufferBitDepth(src);
+
+    PyPixelLayout dstLayout = srcLayout;
+    BitDepth dstBitDepth = srcBitDepth;
+    void * dstPtr = src.ptr;
+
+    if (dst)
+    {
+        if (dst->shape != src.shape)
+        {
+            std::ostringstream os;
+            os << "Incompatible buffer dimensions: expected " << getBufferShapeStr(src);
+            os << ", but received " << getBufferShapeStr(*dst);
+            throw std::runtime_error(os.str().c_str());
+        }
+
+        dstLayout = getPixelLayout(*dst, numChannels);
+        dstBitDepth = getBufferBitDepth(*dst);
+        dstPtr = dst->ptr;
+
+        if (dstLayout.m_width != srcLayout.m_width || dstLayout.m_height != srcLayout.m_height)
+        {
+            throw std::runtime_error("Incompatible buffer strides: the source and destination "
+                                     "arrays must have the same row and column order");
+        }
+    }
+
+    py::gil_scoped_release release;
+
+    auto applyImage = [&](char * srcData, char * dstData, long width, long height)
+    {
+        PackedImageDesc srcImg(srcData, width, height, numChannels, srcBitDepth,
+                               srcLayout.m_chanStrideBytes,
+                               srcLayout.m_xStrideBytes,
+                               height > 1 ? srcLayout.m_yStrideBytes
+                                          : srcLayout.m_xStrideBytes * width);
+
+        if (!dst)
+        {
+            self->apply(srcImg, numThreads);
+            return;
+        }
+
+        PackedImageDesc dstImg(dstData, width, height, numChannels, dstBitDepth,
+                               dstLayout.m_chanStrideBytes,
+                               dstLayout.m_xStrideBytes,
+                               height > 1 ? dstLayout.m_yStrideBytes
+                                          : dstLayout.m_xStrideBytes * width);
+
+        self->apply(srcImg, dstImg, numThreads);
+    };
+
+    char * srcData = static_cast<char *>(src.ptr);
+    char * dstData = static_cast<char *>(dstPtr);
+
+    applyImage(srcData, dstData, srcLayout.m_width, srcLayout.m_height);
+
+    if (srcLayout.m_numRemainingPixels > 0)
+    {
+        applyImage(srcData + srcLayout.m_remainingOffsetBytes,
+                   dstData + dstLayout.m_remainingOffsetBytes,
+                   srcLayout.m_numRemainingPixels, 1);
+    }
+}
+
+// Allocate the dst array of an apply to src when None is given. The array has the same axis
+// order as src so a transposed src keeps the same row and column order. A src whose last axis
+// is not the innermost one (e.g. a Fortran-ordered array) is replaced by a C-contiguous copy.
+py::array createDstArray(py::buffer & src, py::buffer_info & srcInfo, BitDepth bitDepth)
+{
+    // Axes from the outermost to the innermost one.
+    std::vector<py::ssize_t> axes(srcInfo.ndim);
+    std::iota(axes.begin(), axes.end(), 0);
+    std::stable_sort(axes.begin(), axes.end(), [&srcInfo](py::ssize_t a, py::ssize_t b)
+    {
+        return std::abs(srcInfo.strides[a]) > std::abs(srcInfo.strides[b]);
+    });
+
+    if (!axes.empty() && axes.back() != srcInfo.ndim - 1)
+    {
+        src = py::array::ensure(src, py::array::c_style);
+        if (!src)
+        {
+            throw std::runtime_error("Unable to copy the src buffer to a C-contiguous array");
+        }
+        srcInfo = src.request();
+        return py::array(bitDepthToDtype(bitDepth), srcInfo.shape);
+    }
+
+    std::vector<py::ssize_t> shape(axes.size());
+    std::vector<py::ssize_t> srcAxes(axes.size());
+    for (size_t i = 0; i < axes.size(); ++i)
+    {
+        shape[i] = srcInfo.shape[axes[i]];
+        srcAxes[axes[i]] = (py::ssize_t)i;
+    }
+
+    py::array dst(bitDepthToDtype(bitDepth), shape);
+    return dst.attr("transpose")(py::tuple(py::cast(srcAxes))).cast<py::array>();
+}
+
+} // anon.
+
 void bindPyCPUProcessor(py::module & m)
 {
     auto clsCPUProcessor = 
@@ -43,6 +259,33 @@ void bindPyCPUProcessor(py::module & m)
              DOC(CPUProcessor, hasDynamicProperty))
         .def("isDynamic", &CPUProcessor::isDynamic,
              DOC(CPUProcessor, isDynamic))
+        .def("setProfilingEnabled", &CPUProcessor::setProfilingEnabled, "enabled"_a,
+             DOC(CPUProcessor, setProfilingEnabled))
+        .def("isProfilingEnabled", &CPUProcessor::isProfilingEnabled,
+             DOC(CPUProcessor, isProfilingEnabled))
+        .def("resetProfiling", &CPUProcessor::resetProfiling,
+             DOC(CPUProcessor, resetProfiling))
+        .def("getNumProfiledOps", &CPUProcessor::getNumProfiledOps,
+             DOC(CPUProcessor, getNumProfiledOps))
+        .def("getProfiledOpType", &CPUProcessor::getProfiledOpType, "index"_a,
+             DOC(CPUProcessor, getProfiledOpType))
+        .def("getProfiledOpFormatMetadata", &CPUProcessor::getProfiledOpFormatMetadata,
+             "index"_a,
+             py::return_value_policy::reference_internal,
+             DOC(CPUProcessor, getProfiledOpFormatMetadata))
+        .def("getProfiledOpTime", &CPUProcessor::getProfiledOpTime, "index"_a,
+             DOC(CPUProcessor, getProfiledOpTime))
+        .def("getProfiledOpNumPixels", &CPUProcessor::getProfiledOpNumPixels, "index"_a,
+             DOC(CPUProcessor, getProfiledOpNumPixels))
+        .def("getProfiledOpNumBytes", &CPUProcessor::getProfiledOpNumBytes, "index"_a,
+             DOC(CPUProcessor, getProfiledOpNumBytes))
+        .def("getProfiledPackTime", &CPUProcessor::getProfiledPackTime,
+             DOC(CPUProcessor, getProfiledPackTime))
+        .def("getProfiledUnpackTime", &CPUProcessor::getProfiledUnpackTime,
+             DOC(CPUProcessor, getProfiledUnpackTime))
+
+        .def("createDynamicPropertySnapshot", &CPUProcessor::createDynamicPropertySnapshot,
+             DOC(CPUProcessor, createDynamicPropertySnapshot))
 
         .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc) 
             {
@@ -91,43 +334,101 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     ``ImageDesc`` on the C++ side so avoid the copy.
 
 )doc")
-        .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
+        .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc, unsigned numThreads) 
             {
-                py::buffer_info info = data.request();
-                checkBufferDivisible(info, 3);
+                self->apply((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Apply to an image with any kind of channel ordering while respecting 
+the input and output bit-depths. Image values are modified in place. 
+The scanlines are split across numThreads threads, where 0 uses all 
+the hardware threads.
 
-                // --- detect C-contiguous ---
-                checkCContiguousArray(info);
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
 
-                // --- proceed normally ---
-                BitDepth bitDepth = getBufferBitDepth(info);
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Apply to an image with any kind of channel ordering while respecting 
+the input and output bit-depths. Modified srcImgDesc image values are
+written to the dstImgDesc image, leaving srcImgDesc unchanged. The 
+scanlines are split across numThreads threads, where 0 uses all the 
+hardware threads.
 
-                py::gil_scoped_release release;
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
 
-                long numChannels = 3;
-                long width = (long)info.size / numChannels;
-                long height = 1;
-                ptrdiff_t chanStrideBytes = (ptrdiff_t)info.itemsize;
-                ptrdiff_t xStrideBytes = chanStrideBytes * numChannels;
-                ptrdiff_t yStrideBytes = xStrideBytes * width;
-
-                PackedImageDesc img(info.ptr, 
-                                    width, height, 
-                                    numChannels, 
-                                    bitDepth, 
-                                    chanStrideBytes, 
-                                    xStrideBytes, 
-                                    yStrideBytes);
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & imgDesc, 
+                         const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                         unsigned numThreads) 
+            {
+                self->apply((*imgDesc.m_img), snapshot, numThreads);
+            },
+             "imgDesc"_a, "snapshot"_a, "numThreads"_a = 1,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Apply to an image using the dynamic property values of the snapshot 
+instead of the ones of the processor. Image values are modified in 
+place. The snapshot must come from this processor.
 
-                self->apply(img);
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         const ConstDynamicPropertySnapshotRcPtr & snapshot,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), snapshot, numThreads);
             },
-             "data"_a, 
+             "srcImgDesc"_a, "dstImgDesc"_a, "snapshot"_a, "numThreads"_a = 1,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Apply to an image using the dynamic property values of the snapshot 
+instead of the ones of the processor. Modified srcImgDesc image values 
+are written to the dstImgDesc image, leaving srcImgDesc unchanged. The 
+snapshot must come from this processor.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data, unsigned numThreads) 
+            {
+                py::buffer_info info = data.request();
+                applyBuffer(self, info, nullptr, 3, numThreads);
+            },
+             "data"_a, "numThreads"_a = 1,
              R"doc(
 Apply to a packed RGB array adhering to the Python buffer protocol. 
 This will typically be a NumPy array. Input and output bit-depths are
-respected but must match. Any array size or shape is supported as long
-as the flattened array size is divisible by 3. Array values are 
-modified in place.
+respected but must match. Array values are modified in place.
+
+A (height, width, 3) or (N, 3) array is processed using its 
+strides so views of a larger array (e.g. crops or flipped images) are 
+supported without any copy. Any other array size or shape is supported 
+as long as the array is C-contiguous and the flattened array size is 
+divisible by 3. The scanlines are split across numThreads threads, 
+where 0 uses all the hardware threads.
 
 .. note::
     This differs from the C++ implementation which only applies to a 
@@ -136,6 +437,41 @@ modified in place.
     during processing, freeing up Python to execute other threads 
     concurrently.
 
+)doc")
+        .def("applyRGB", [](CPUProcessorRcPtr & self, 
+                            py::buffer & src, 
+                            py::object dst, 
+                            unsigned numThreads) -> py::object
+            {
+                py::buffer_info srcInfo = src.request();
+
+                if (dst.is_none())
+                {
+                    dst = createDstArray(src, srcInfo, self->getOutputBitDepth());
+                }
+
+                py::buffer_info dstInfo = dst.cast<py::buffer>().request(true);
+                applyBuffer(self, srcInfo, &dstInfo, 3, numThreads);
+
+                return dst;
+            },
+             "src"_a, "dst"_a, "numThreads"_a = 1,
+             R"doc(
+Apply to a packed RGB array adhering to the Python buffer protocol,
+writing the processed values to the dst array of the same shape and 
+leaving src unchanged. The src and dst arrays respectively respect the 
+input and output bit-depths. A new array with the same axis order as 
+src is allocated when dst is None, src being copied first when its last
+axis is not the innermost one. The dst array is returned.
+
+Array shapes and strides are handled as by the in place ``applyRGB``.
+The scanlines are split across numThreads threads, where 0 uses all the
+hardware threads.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, std::vector<float> & data) 
             {
@@ -170,41 +506,23 @@ float values is returned, leaving the input list unchanged.
     modified in place.
 
 )doc")
-        .def("applyRGBA", [](CPUProcessorRcPtr & self, py::buffer & data) 
+        .def("applyRGBA", [](CPUProcessorRcPtr & self, py::buffer & data, unsigned numThreads) 
             {
                 py::buffer_info info = data.request();
-                checkBufferDivisible(info, 4);
-
-                // --- detect C-contiguous ---
-                checkCContiguousArray(info);
-                // Interpret as single row of RGBA pixels
-                BitDepth bitDepth = getBufferBitDepth(info);
-
-                py::gil_scoped_release release;
-
-                long numChannels = 4;
-                long width = (long)info.size / numChannels;
-                long height = 1;
-                ptrdiff_t chanStrideBytes = (ptrdiff_t)info.itemsize;
-                ptrdiff_t xStrideBytes = chanStrideBytes * numChannels;
-                ptrdiff_t yStrideBytes = xStrideBytes * width;
-
-                PackedImageDesc img(info.ptr, 
-                                    width, height, 
-                                    numChannels, 
-                                    bitDepth, 
-                                    chanStrideBytes, 
-                                    xStrideBytes, 
-                                    yStrideBytes);
-                self->apply(img);
+                applyBuffer(self, info, nullptr, 4, numThreads);
             },
-             "data"_a, 
+             "data"_a, "numThreads"_a = 1,
              R"doc(
 Apply to a packed RGBA array adhering to the Python buffer protocol. 
 This will typically be a NumPy array. Input and output bit-depths are
-respected but must match. Any array size or shape is supported as long
-as the flattened array size is divisible by 4. Array values are 
-modified in place.
+respected but must match. Array values are modified in place.
+
+A (height, width, 4) or (N, 4) array is processed using its 
+strides so views of a larger array (e.g. crops or flipped images) are 
+supported without any copy. Any other array size or shape is supported 
+as long as the array is C-contiguous and the flattened array size is 
+divisible by 4. The scanlines are split across numThreads threads, 
+where 0 uses all the hardware threads.
 
 .. note::
     This differs from the C++ implementation which only applies to a 
@@ -213,6 +531,41 @@ modified in place.
     during processing, freeing up Python to execute other threads 
     concurrently.
 
+)doc")
+        .def("applyRGBA", [](CPUProcessorRcPtr & self, 
+                            py::buffer & src, 
+                            py::object dst, 
+                            unsigned numThreads) -> py::object
+            {
+                py::buffer_info srcInfo = src.request();
+
+                if (dst.is_none())
+                {
+                    dst = createDstArray(src, srcInfo, self->getOutputBitDepth());
+                }
+
+                py::buffer_info dstInfo = dst.cast<py::buffer>().request(true);
+                applyBuffer(self, srcInfo, &dstInfo, 4, numThreads);
+
+                return dst;
+            },
+             "src"_a, "dst"_a, "numThreads"_a = 1,
+             R"doc(
+Apply to a packed RGBA array adhering to the Python buffer protocol,
+writing the processed values to the dst array of the same shape and 
+leaving src unchanged. The src and dst arrays respectively respect the 
+input and output bit-depths. A new array with the same axis order as 
+src is allocated when dst is None, src being copied first when its last
+axis is not the innermost one. The dst array is returned.
+
+Array shapes and strides are handled as by the in place ``applyRGBA``.
+The scanlines are split across numThreads threads, where 0 uses all the
+hardware threads.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
 )doc")
         .def("applyRGBA", [](CPUProcessorRcPtr & self, std::vector<float> & data) 
             {
@@ -247,6 +600,24 @@ float values is returned, leaving the input list unchanged.
     modified in place.
 
 )doc");
+
+    auto clsDynamicPropertySnapshot = 
+        py::class_<DynamicPropertySnapshot, DynamicPropertySnapshotRcPtr>(
+            m.attr("DynamicPropertySnapshot"))
+
+        .def("createEditableCopy", &DynamicPropertySnapshot::createEditableCopy,
+             DOC(DynamicPropertySnapshot, createEditableCopy))
+        .def("getDynamicProperty", [](DynamicPropertySnapshotRcPtr & self, 
+                                      DynamicPropertyType type) 
+            {
+                return PyDynamicProperty(self->getDynamicProperty(type));
+            }, 
+            "type"_a, 
+             DOC(DynamicPropertySnapshot, getDynamicProperty))
+        .def("hasDynamicProperty", &DynamicPropertySnapshot::hasDynamicProperty, "type"_a,
+             DOC(DynamicPropertySnapshot, hasDynamicProperty))
+        .def("isDynamic", &DynamicPropertySnapshot::isDynamic,
+             DOC(DynamicPropertySnapshot, isDynamic));
 }
 
 } // namespace OCIO_NAMESPACE
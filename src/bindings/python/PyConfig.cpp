@@ -719,6 +719,28 @@ void bindPyConfig(py::module & m)
         .def("filepathOnlyMatchesDefaultRule", &Config::filepathOnlyMatchesDefaultRule, 
              "filePath"_a, 
              DOC(Config, filepathOnlyMatchesDefaultRule))
+        .def("getColorSpacesFromFilepaths",
+            [](ConfigRcPtr & self, const std::vector<std::string> & filePaths)
+            {
+                std::vector<const char *> paths(filePaths.size());
+                for (size_t i = 0; i < filePaths.size(); ++i)
+                {
+                    paths[i] = filePaths[i].c_str();
+                }
+
+                std::vector<const char *> csNames(filePaths.size(), nullptr);
+                std::vector<size_t> ruleIndices(filePaths.size(), 0);
+                self->getColorSpacesFromFilepaths(paths.data(), paths.size(),
+                                                  csNames.data(), ruleIndices.data());
+
+                py::list results;
+                for (size_t i = 0; i < filePaths.size(); ++i)
+                {
+                    results.append(py::make_tuple(std::string(csNames[i]), ruleIndices[i]));
+                }
+                return results;
+            }, "filePaths"_a, 
+            DOC(Config, getColorSpacesFromFilepaths))
 
         // Processors
         .def("getProcessor", 
@@ -965,6 +987,11 @@ void bindPyConfig(py::module & m)
              DOC(Config, setProcessorCacheFlags))
         .def("clearProcessorCache", &Config::clearProcessorCache, 
              DOC(Config, setProcessorCacheFlags))
+        .def("setProcessorCacheCapacity", &Config::setProcessorCacheCapacity, 
+             "maxEntries"_a, "maxBytes"_a,
+             DOC(Config, setProcessorCacheCapacity))
+        .def("getProcessorCacheStatistics", &Config::getProcessorCacheStatistics, 
+             DOC(Config, getProcessorCacheStatistics))
 
         // Archiving
         .def("isArchivable", &Config::isArchivable, DOC(Config, isArchivable))
@@ -40,6 +40,18 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("SetFileCacheCapacity", &SetFileCacheCapacity, "maxEntries"_a, "maxBytes"_a,
+          DOC(PyOpenColorIO, SetFileCacheCapacity));
+    m.def("GetFileCacheStatistics", &GetFileCacheStatistics,
+          DOC(PyOpenColorIO, GetFileCacheStatistics));
+    m.def("SetGpuShaderCacheCapacity", &SetGpuShaderCacheCapacity, "maxEntries"_a, "maxBytes"_a,
+          DOC(PyOpenColorIO, SetGpuShaderCacheCapacity));
+    m.def("GetGpuShaderCacheStatistics", &GetGpuShaderCacheStatistics,
+          DOC(PyOpenColorIO, GetGpuShaderCacheStatistics));
+    m.def("SetProcessorDiskCacheDirectory", &SetProcessorDiskCacheDirectory, "dirname"_a,
+          DOC(PyOpenColorIO, SetProcessorDiskCacheDirectory));
+    m.def("GetProcessorDiskCacheDirectory", &GetProcessorDiskCacheDirectory,
+          DOC(PyOpenColorIO, GetProcessorDiskCacheDirectory));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
@@ -58,6 +70,14 @@ PYBIND11_MODULE(PyOpenColorIO, m)
           DOC(PyOpenColorIO, SetComputeHashFunction));
     m.def("ResetComputeHashFunction", &ResetComputeHashFunction,
           DOC(PyOpenColorIO, ResetComputeHashFunction));
+    m.def("GetCPUProcessorBlockSize", &GetCPUProcessorBlockSize,
+          DOC(PyOpenColorIO, GetCPUProcessorBlockSize));
+    m.def("SetCPUProcessorBlockSize", &SetCPUProcessorBlockSize, "numPixels"_a,
+          DOC(PyOpenColorIO, SetCPUProcessorBlockSize));
+    m.def("GetInverseLut3DGridSize", &GetInverseLut3DGridSize,
+          DOC(PyOpenColorIO, GetInverseLut3DGridSize));
+    m.def("SetInverseLut3DGridSize", &SetInverseLut3DGridSize, "gridSize"_a,
+          DOC(PyOpenColorIO, SetInverseLut3DGridSize));
     m.def("GetEnvVariable", &GetEnvVariable, "name"_a,
           DOC(PyOpenColorIO, GetEnvVariable));
     m.def("SetEnvVariable", &SetEnvVariable, "name"_a, "value"_a,
@@ -70,6 +70,9 @@ void bindPyProcessor(py::module & m)
              &Processor::getOptimizedProcessor,
              "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
              DOC(Processor, getOptimizedProcessor))
+        .def("createPatchedProcessor", &Processor::createPatchedProcessor,
+             "index"_a, "transform"_a,
+             DOC(Processor, createPatchedProcessor))
 
         // GPU Renderer
         .def("getDefaultGPUProcessor", &Processor::getDefaultGPUProcessor,
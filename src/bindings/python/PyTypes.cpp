@@ -42,6 +42,10 @@ void bindPyTypes(py::module & m)
         m, "CPUProcessor", 
         DOC(CPUProcessor));
 
+    py::class_<DynamicPropertySnapshot, DynamicPropertySnapshotRcPtr /* holder */>(
+        m, "DynamicPropertySnapshot", 
+        DOC(DynamicPropertySnapshot));
+
     py::class_<FileRules, FileRulesRcPtr /* holder */>(
         m, "FileRules", 
         DOC(FileRules));
@@ -831,6 +835,8 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_BAKE_EXPENSIVE_OPS", OPTIMIZATION_BAKE_EXPENSIVE_OPS, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_BAKE_EXPENSIVE_OPS))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -859,6 +865,26 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, ProcessorCacheFlags, PROCESSOR_CACHE_DEFAULT))
         .export_values();
 
+    py::class_<CacheStatistics>(
+        m, "CacheStatistics", 
+        DOC(CacheStatistics))
+
+        .def(py::init<>())
+        .def_readonly("numEntries", &CacheStatistics::m_numEntries, 
+                      DOC(CacheStatistics, m_numEntries))
+        .def_readonly("numBytes", &CacheStatistics::m_numBytes, 
+                      DOC(CacheStatistics, m_numBytes))
+        .def_readonly("maxEntries", &CacheStatistics::m_maxEntries, 
+                      DOC(CacheStatistics, m_maxEntries))
+        .def_readonly("maxBytes", &CacheStatistics::m_maxBytes, 
+                      DOC(CacheStatistics, m_maxBytes))
+        .def_readonly("numHits", &CacheStatistics::m_numHits, 
+                      DOC(CacheStatistics, m_numHits))
+        .def_readonly("numMisses", &CacheStatistics::m_numMisses, 
+                      DOC(CacheStatistics, m_numMisses))
+        .def_readonly("numEvictions", &CacheStatistics::m_numEvictions, 
+                      DOC(CacheStatistics, m_numEvictions));
+
     // Conversion
     m.def("BoolToString", &BoolToString, "value"_a, 
           DOC(PyOpenColorIO, BoolToString));
@@ -976,6 +1002,7 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_DISABLE_ALL_CACHES") = OCIO_DISABLE_ALL_CACHES;
     m.attr("OCIO_DISABLE_PROCESSOR_CACHES") = OCIO_DISABLE_PROCESSOR_CACHES;
     m.attr("OCIO_DISABLE_CACHE_FALLBACK") = OCIO_DISABLE_CACHE_FALLBACK;
+    m.attr("OCIO_PROCESSOR_DISK_CACHE_DIR") = OCIO_PROCESSOR_DISK_CACHE_DIR;
 
     m.attr("OCIO_CONFIG_DEFAULT_NAME") = OCIO_CONFIG_DEFAULT_NAME;
     m.attr("OCIO_CONFIG_DEFAULT_FILE_EXT") = OCIO_CONFIG_DEFAULT_FILE_EXT;
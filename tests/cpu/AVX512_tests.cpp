@@ -5,6 +5,7 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX512
 
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -512,4 +513,55 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+DEFINE_SIMD_TEST(log2_exp2_power_test)
+{
+    // The approximations are the same as the SSE ones i.e. about 15 good bits of mantissa
+    // (relative error for exp2).
+    const float rtol = powf(2.f, -14.f);
+
+    AVX512_ALIGN(float result[16]);
+
+    const float logValues[] = { 1e-010f, .1f, .5f, 1.f, 11.f, 112.f, 2425.f, 2e015f };
+    for (const float value : logValues)
+    {
+        _mm512_store_ps(result, OCIO::avx512Log2(_mm512_set1_ps(value)));
+        for (const float res : result)
+        {
+            OCIO_CHECK_CLOSE(res, log2f(value), rtol);
+        }
+    }
+
+    const float expValues[] = { -125.f, -10.5f, -1.f, -0.25f, 0.f, 0.3f, 1.f, 7.7f, 127.f };
+    for (const float value : expValues)
+    {
+        _mm512_store_ps(result, OCIO::avx512Exp2(_mm512_set1_ps(value)));
+        for (const float res : result)
+        {
+            OCIO_CHECK_CLOSE(res / exp2f(value), 1.f, rtol);
+        }
+    }
+
+    // Underflow and overflow.
+    _mm512_store_ps(result, OCIO::avx512Exp2(_mm512_set1_ps(-200.f)));
+    OCIO_CHECK_EQUAL(result[0], 0.f);
+    _mm512_store_ps(result, OCIO::avx512Exp2(_mm512_set1_ps(200.f)));
+    OCIO_CHECK_EQUAL(result[0], std::numeric_limits<float>::infinity());
+
+    const float powValues[] = { 1e-010f, .1f, .5f, 1.f, .7f, .112f, .2425f, .3f };
+    for (const float value : powValues)
+    {
+        _mm512_store_ps(result, OCIO::avx512Power(_mm512_set1_ps(value), _mm512_set1_ps(2.2f)));
+        for (const float res : result)
+        {
+            OCIO_CHECK_CLOSE(res, powf(value, 2.2f), powf(2.f, -12.f));
+        }
+    }
+
+    // The power of zero or of a negative value is zero.
+    _mm512_store_ps(result, OCIO::avx512Power(_mm512_set1_ps(0.f), _mm512_set1_ps(2.2f)));
+    OCIO_CHECK_EQUAL(result[0], 0.f);
+    _mm512_store_ps(result, OCIO::avx512Power(_mm512_set1_ps(-0.5f), _mm512_set1_ps(2.2f)));
+    OCIO_CHECK_EQUAL(result[0], 0.f);
+}
+
 #endif // OCIO_USE_AVX
\ No newline at end of file
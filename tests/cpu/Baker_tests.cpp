@@ -578,3 +578,127 @@ OCIO_ADD_TEST(Baker, baking_validation)
     OCIO_CHECK_THROW_WHAT(bake->bake(os), OCIO::Exception,
         "Could not find target colorspace 'Log2NT'.");
 }
+
+OCIO_ADD_TEST(Baker, bake_display_views)
+{
+    constexpr auto myProfile = R"(
+        ocio_profile_version: 2
+
+        file_rules:
+          - !<Rule> {name: Default, colorspace: lnh}
+
+        displays:
+          display1:
+            - !<View> {name: view1, colorspace: gamma22}
+            - !<View> {name: view2, looks: satlook, colorspace: gamma22}
+          display2:
+            - !<View> {name: view1, colorspace: log}
+
+        looks:
+          - !<Look>
+            name: satlook
+            process_space: lnh
+            transform: !<CDLTransform> {sat: 2}
+
+        colorspaces:
+          - !<ColorSpace>
+            name: lnh
+
+          - !<ColorSpace>
+            name: gamma22
+            to_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}
+
+          - !<ColorSpace>
+            name: log
+            from_reference: !<LogTransform> {base: 2}
+    )";
+
+    std::istringstream is(myProfile);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+
+    OCIO::BakerRcPtr baker = OCIO::Baker::Create();
+    baker->setConfig(config);
+    baker->setFormat("resolve_cube");
+    baker->setInputSpace("lnh");
+    OCIO_CHECK_EQUAL(baker->getNumThreads(), 1u);
+    // The cube size is large enough for the LUT entries to be split in several rows with a
+    // partial last row.
+    baker->setCubeSize(17);
+
+    const char * displays[] = { "display1", "display1", "display2" };
+    const char * views[]    = { "view1", "view2", "view1" };
+
+    // Bake each display / view pair on its own with a single thread.
+    std::vector<std::string> expected;
+    for (int i = 0; i < 3; ++i)
+    {
+        OCIO::BakerRcPtr oven = baker->createEditableCopy();
+        oven->setDisplayView(displays[i], views[i]);
+
+        std::ostringstream os;
+        OCIO_CHECK_NO_THROW(oven->bake(os));
+        expected.push_back(os.str());
+
+        // The LUT entries processed by several threads give the same LUT.
+        oven->setNumThreads(3);
+        OCIO_CHECK_EQUAL(oven->getNumThreads(), 3u);
+
+        std::ostringstream osThreads;
+        OCIO_CHECK_NO_THROW(oven->bake(osThreads));
+        OCIO_CHECK_EQUAL(osThreads.str(), expected.back());
+    }
+
+    OCIO_CHECK_NE(expected[0], expected[1]);
+    OCIO_CHECK_NE(expected[0], expected[2]);
+
+    for (unsigned numThreads : { 1u, 2u, 5u, 0u })
+    {
+        baker->setNumThreads(numThreads);
+
+        std::ostringstream streams[3];
+        std::ostream * outputs[] = { &streams[0], &streams[1], &streams[2] };
+
+        OCIO_CHECK_NO_THROW(baker->bakeDisplayViews(displays, views, outputs, 3));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            OCIO_CHECK_EQUAL(streams[i].str(), expected[i]);
+        }
+    }
+
+    // The target space of the baker is ignored.
+    {
+        baker->setTargetSpace("gamma22");
+
+        std::ostringstream os;
+        std::ostream * outputs[] = { &os };
+        OCIO_CHECK_NO_THROW(baker->bakeDisplayViews(&displays[2], &views[2], outputs, 1));
+        OCIO_CHECK_EQUAL(os.str(), expected[2]);
+
+        baker->setTargetSpace("");
+    }
+
+    // Errors.
+    {
+        const char * badViews[] = { "view1", "view3", "view1" };
+
+        std::ostringstream streams[3];
+        std::ostream * outputs[] = { &streams[0], &streams[1], &streams[2] };
+
+        OCIO_CHECK_THROW_WHAT(baker->bakeDisplayViews(displays, badViews, outputs, 3),
+                              OCIO::Exception,
+                              "Could not find view 'view3'.");
+
+        outputs[1] = nullptr;
+        OCIO_CHECK_THROW_WHAT(baker->bakeDisplayViews(displays, views, outputs, 3),
+                              OCIO::Exception,
+                              "Invalid output stream to bake.");
+
+        OCIO_CHECK_THROW_WHAT(baker->bakeDisplayViews(displays, views, outputs, -1),
+                              OCIO::Exception,
+                              "Invalid display / view pairs to bake.");
+
+        OCIO_CHECK_NO_THROW(baker->bakeDisplayViews(nullptr, nullptr, nullptr, 0));
+    }
+}
@@ -4,6 +4,10 @@
 
 #include "CPUProcessor.cpp"
 
+#include <limits>
+#include <thread>
+
+#include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
 #include "ScanlineHelper.h"
@@ -2908,3 +2912,1165 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+OCIO_ADD_TEST(CPUProcessor, multithreaded_apply)
+{
+    // The unit test validates that splitting the scanlines across several threads gives
+    // the same result as the single-threaded processing.
+
+    constexpr long width  = 97;
+    constexpr long height = 61;
+
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    exp->setValue({ 2.2, 2.0, 1.8, 1.0 });
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.);
+    range->setMinOutValue(0.);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(exp);
+    group->appendTransform(OCIO::MatrixTransform::Create());
+    group->appendTransform(range);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                              OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    std::vector<uint16_t> inBuf(width * height * 3);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = uint16_t((idx * 37) % 65536);
+    }
+
+    // In-place processing with a packed RGBA F32 image.
+    {
+        std::vector<float> refBuf(width * height * 4);
+        for (size_t idx = 0; idx < refBuf.size(); ++idx)
+        {
+            refBuf[idx] = float(idx) / float(refBuf.size());
+        }
+        std::vector<float> buf = refBuf;
+
+        OCIO::ConstCPUProcessorRcPtr cpuFloat;
+        OCIO_CHECK_NO_THROW(cpuFloat = processor->getDefaultCPUProcessor());
+
+        OCIO::PackedImageDesc refImg(&refBuf[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuFloat->apply(refImg));
+
+        for (unsigned numThreads : { 0u, 1u, 2u, 5u, 200u })
+        {
+            std::vector<float> outBuf = buf;
+            OCIO::PackedImageDesc img(&outBuf[0], width, height, 4);
+            OCIO_CHECK_NO_THROW(cpuFloat->apply(img, numThreads));
+
+            for (size_t idx = 0; idx < outBuf.size(); ++idx)
+            {
+                OCIO_CHECK_EQUAL(outBuf[idx], refBuf[idx]);
+            }
+        }
+    }
+
+    // From a packed RGB uint16 image to a planar RGBA F32 image.
+    {
+        const OCIO::PackedImageDesc srcImg(&inBuf[0], width, height, 3,
+                                           OCIO::BIT_DEPTH_UINT16,
+                                           OCIO::AutoStride,
+                                           OCIO::AutoStride,
+                                           OCIO::AutoStride);
+
+        std::vector<float> refR(width * height), refG(width * height),
+                           refB(width * height), refA(width * height);
+        OCIO::PlanarImageDesc refImg(&refR[0], &refG[0], &refB[0], &refA[0], width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImg, refImg));
+
+        for (unsigned numThreads : { 0u, 1u, 3u, 8u })
+        {
+            std::vector<float> outR(width * height, -1.f), outG(width * height, -1.f),
+                               outB(width * height, -1.f), outA(width * height, -1.f);
+            OCIO::PlanarImageDesc dstImg(&outR[0], &outG[0], &outB[0], &outA[0], width, height);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImg, dstImg, numThreads));
+
+            for (size_t idx = 0; idx < outR.size(); ++idx)
+            {
+                OCIO_CHECK_EQUAL(outR[idx], refR[idx]);
+                OCIO_CHECK_EQUAL(outG[idx], refG[idx]);
+                OCIO_CHECK_EQUAL(outB[idx], refB[idx]);
+                OCIO_CHECK_EQUAL(outA[idx], refA[idx]);
+            }
+        }
+
+        // The image dimensions must match.
+        std::vector<float> outBuf(width * (height - 1) * 4);
+        OCIO::PackedImageDesc dstImg(&outBuf[0], width, height - 1, 4);
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcImg, dstImg, 4),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, scanline_helper_reuse)
+{
+    // The scanline helpers and their buffers are kept alive across apply calls. Validate
+    // that reusing them with images of different sizes and layouts gives correct results.
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = BuildCPUProcessor(OCIO::TRANSFORM_DIR_FORWARD));
+
+    for (size_t iter = 0; iter < 3; ++iter)
+    {
+        // Packed RGBA F32 in place.
+        std::vector<float> buf = inImg;
+        OCIO::PackedImageDesc packedImg(&buf[0], NB_PIXELS, 1, 4);
+        Process(cpuProcessor, packedImg, __LINE__);
+
+        // Packed RGBA F32 in place, with a different width.
+        std::vector<float> buf2 = inImg;
+        OCIO::PackedImageDesc packedImg2(&buf2[0], 1, NB_PIXELS, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(packedImg2));
+        Validate(OCIO::PackedImageDesc(&buf2[0], NB_PIXELS, 1, 4), __LINE__);
+
+        // Packed to planar.
+        OCIO::PackedImageDesc srcImgDesc((void*)&inImg[0], NB_PIXELS, 1, 4);
+        std::vector<float> outR(NB_PIXELS), outG(NB_PIXELS), outB(NB_PIXELS), outA(NB_PIXELS);
+        OCIO::PlanarImageDesc dstImgDesc(&outR[0], &outG[0], &outB[0], &outA[0], NB_PIXELS, 1);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, dstImgDesc));
+
+        for(size_t idx=0; idx<NB_PIXELS; ++idx)
+        {
+            OCIO_CHECK_CLOSE(outR[idx], resImg[4*idx+0], 1e-6f);
+            OCIO_CHECK_CLOSE(outG[idx], resImg[4*idx+1], 1e-6f);
+            OCIO_CHECK_CLOSE(outB[idx], resImg[4*idx+2], 1e-6f);
+            OCIO_CHECK_CLOSE(outA[idx], resImg[4*idx+3], 1e-6f);
+        }
+
+        // A failing apply must not break the next ones.
+        std::vector<float> badBuf(NB_PIXELS * 4 * 2);
+        OCIO::PackedImageDesc badImgDesc(&badBuf[0], NB_PIXELS, 2, 4);
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcImgDesc, badImgDesc),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, block_size)
+{
+    // The op chain runs on blocks of pixels. Validate that the results do not depend on the
+    // block size, including when the last block of a scanline is partial.
+
+    const unsigned defaultBlockSize = OCIO::GetCPUProcessorBlockSize();
+    OCIO_CHECK_EQUAL(defaultBlockSize, 1024u);
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = BuildCPUProcessor(OCIO::TRANSFORM_DIR_FORWARD));
+
+    for (unsigned blockSize : { 0u, 1u, 4u, 6u, 7u, defaultBlockSize })
+    {
+        OCIO::SetCPUProcessorBlockSize(blockSize);
+        OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorBlockSize(), blockSize);
+
+        std::vector<float> buf = inImg;
+        OCIO::PackedImageDesc packedImg(&buf[0], NB_PIXELS, 1, 4);
+        Process(cpuProcessor, packedImg, __LINE__);
+
+        OCIO::PackedImageDesc srcImgDesc((void*)&inImg[0], NB_PIXELS, 1, 4);
+        std::vector<float> outR(NB_PIXELS), outG(NB_PIXELS), outB(NB_PIXELS), outA(NB_PIXELS);
+        OCIO::PlanarImageDesc dstImgDesc(&outR[0], &outG[0], &outB[0], &outA[0], NB_PIXELS, 1);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, dstImgDesc));
+
+        for(size_t idx=0; idx<NB_PIXELS; ++idx)
+        {
+            OCIO_CHECK_CLOSE(outR[idx], resImg[4*idx+0], 1e-6f);
+            OCIO_CHECK_CLOSE(outG[idx], resImg[4*idx+1], 1e-6f);
+            OCIO_CHECK_CLOSE(outB[idx], resImg[4*idx+2], 1e-6f);
+            OCIO_CHECK_CLOSE(outA[idx], resImg[4*idx+3], 1e-6f);
+        }
+    }
+
+    OCIO::SetCPUProcessorBlockSize(defaultBlockSize);
+}
+
+OCIO_ADD_TEST(CPUProcessor, half_float_bit_depth_cast)
+{
+    // The half <-> float bit-depth conversions may use the hardware instructions, validate them
+    // against the scalar conversions. Note that the number of values is not a multiple of the
+    // SIMD width to also cover the remaining values.
+
+    // Half to float for all the half codes.
+
+    const long numPixels = 65536 / 4 - 1;
+    std::vector<half> inHalf(numPixels * 4);
+    for (size_t idx = 0; idx < inHalf.size(); ++idx)
+    {
+        inHalf[idx].setBits((unsigned short)idx);
+    }
+
+    OCIO::ConstOpCPURcPtr op;
+    OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F16,
+                                                               OCIO::BIT_DEPTH_F32));
+
+    std::vector<float> outFloat(numPixels * 4, -1.f);
+    op->apply(inHalf.data(), outFloat.data(), numPixels);
+
+    std::vector<float> resFloat(numPixels * 4);
+    OCIO::ConvertHalfToFloat(inHalf.data(), resFloat.data(), numPixels * 4);
+
+    for (size_t idx = 0; idx < outFloat.size(); ++idx)
+    {
+        if (inHalf[idx].isNan())
+        {
+            OCIO_CHECK_ASSERT(OCIO::IsNan(outFloat[idx]));
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(outFloat[idx], resFloat[idx]);
+        }
+    }
+
+    // Float to half including the rounding, the overflow and the denormal values.
+
+    std::vector<float> inFloat;
+    for (const float v : { 0.f, -0.f, 1.f, 65504.f, 65519.f, 65520.f, 1e6f,
+                           std::numeric_limits<float>::infinity(),
+                           -std::numeric_limits<float>::infinity(),
+                           5.96046448e-08f, 2.98023224e-08f, 1e-10f, 6.09755516e-05f })
+    {
+        inFloat.push_back(v);
+        inFloat.push_back(-v);
+    }
+    for (int i = 0; i < 4000; ++i)
+    {
+        // Covers the values that are half way between two half values.
+        inFloat.push_back(1.0f + float(i) * 0.00048828125f * 0.5f);
+        inFloat.push_back(-1e-5f * float(i) - 0.001f);
+    }
+    inFloat.push_back(std::numeric_limits<float>::quiet_NaN());
+    inFloat.resize(((inFloat.size() + 3) / 4) * 4 + 4 * 5, 0.25f);
+
+    const long numFloatPixels = long(inFloat.size() / 4);
+
+    OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F16));
+
+    std::vector<half> outHalf(inFloat.size());
+    op->apply(inFloat.data(), outHalf.data(), numFloatPixels);
+
+    std::vector<half> resHalf(inFloat.size());
+    OCIO::ConvertFloatToHalf(inFloat.data(), resHalf.data(), long(inFloat.size()));
+
+    for (size_t idx = 0; idx < outHalf.size(); ++idx)
+    {
+        if (OCIO::IsNan(inFloat[idx]))
+        {
+            OCIO_CHECK_ASSERT(outHalf[idx].isNan());
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(outHalf[idx].bits(), resHalf[idx].bits());
+        }
+    }
+}
+
+namespace
+{
+
+// Process the same image using several channel layouts and compare to the packed RGBA result.
+template<OCIO::BitDepth BD>
+void ValidateChannelLayouts(unsigned lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<BD>::Type Type;
+
+    // The width is not a multiple of the SIMD widths to also cover the remaining pixels.
+    constexpr long width     = 37;
+    constexpr long height    = 3;
+    constexpr long numPixels = width * height;
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m[16] = { 0.8, 0.1, 0.0, 0.0,
+                               0.0, 0.9, 0.0, 0.0,
+                               0.1, 0.0, 0.7, 0.0,
+                               0.0, 0.0, 0.0, 0.6 };
+    constexpr double offset[4] = { 0.05, 0.1, 0.02, 0.1 };
+    matrix->setMatrix(m);
+    matrix->setOffset(offset);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(matrix);
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = processor->getOptimizedCPUProcessor(BD, BD, OCIO::OPTIMIZATION_NONE);
+
+    const float maxValue = float(OCIO::BitDepthInfo<BD>::maxValue);
+
+    std::vector<Type> inRGBA(numPixels * 4);
+    for (size_t idx = 0; idx < inRGBA.size(); ++idx)
+    {
+        const float v = float((idx * 7) % 101) / 100.0f;
+        inRGBA[idx] = OCIO::BitDepthInfo<BD>::isFloat ? Type(v * 1.5f - 0.2f)
+                                                      : Type(v * maxValue + 0.5f);
+    }
+
+    // The references, with and without the alpha channel.
+
+    std::vector<Type> inRGB0 = inRGBA;
+    for (long pxl = 0; pxl < numPixels; ++pxl)
+    {
+        inRGB0[4 * pxl + 3] = Type(0.0f);
+    }
+
+    std::vector<Type> refRGBA(numPixels * 4), refRGB0(numPixels * 4);
+    {
+        OCIO::PackedImageDesc srcTyped(inRGBA.data(), width, height, 4, BD,
+                                       sizeof(Type), 4 * sizeof(Type), 4 * width * sizeof(Type));
+        OCIO::PackedImageDesc dst(refRGBA.data(), width, height, 4, BD,
+                                  sizeof(Type), 4 * sizeof(Type), 4 * width * sizeof(Type));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(srcTyped, dst), lineNo);
+
+        OCIO::PackedImageDesc src0(inRGB0.data(), width, height, 4, BD,
+                                   sizeof(Type), 4 * sizeof(Type), 4 * width * sizeof(Type));
+        OCIO::PackedImageDesc dst0(refRGB0.data(), width, height, 4, BD,
+                                   sizeof(Type), 4 * sizeof(Type), 4 * width * sizeof(Type));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(src0, dst0), lineNo);
+    }
+
+    auto checkPixel = [&](const std::vector<Type> & ref, long pxl, int channel, const Type & val)
+    {
+        OCIO_CHECK_ASSERT_FROM(memcmp(&ref[4 * pxl + channel], &val, sizeof(Type)) == 0, lineNo);
+    };
+
+    // Planar layouts, with and without the alpha plane.
+
+    for (const bool hasAlpha : { true, false })
+    {
+        std::vector<Type> r(numPixels), g(numPixels), b(numPixels), a(numPixels);
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            r[pxl] = inRGBA[4 * pxl + 0];
+            g[pxl] = inRGBA[4 * pxl + 1];
+            b[pxl] = inRGBA[4 * pxl + 2];
+            a[pxl] = inRGBA[4 * pxl + 3];
+        }
+
+        OCIO::PlanarImageDesc img(r.data(), g.data(), b.data(), hasAlpha ? a.data() : nullptr,
+                                  width, height, BD, sizeof(Type), width * sizeof(Type));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(img), lineNo);
+
+        const std::vector<Type> & ref = hasAlpha ? refRGBA : refRGB0;
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            checkPixel(ref, pxl, 0, r[pxl]);
+            checkPixel(ref, pxl, 1, g[pxl]);
+            checkPixel(ref, pxl, 2, b[pxl]);
+            if (hasAlpha) checkPixel(ref, pxl, 3, a[pxl]);
+        }
+    }
+
+    // Interleaved layouts i.e. the channel orderings and a padded pixel.
+
+    struct Layout
+    {
+        OCIO::ChannelOrdering m_order;
+        int m_numChannels;
+        int m_pixelStride;
+        int m_offsets[4];
+    };
+
+    const Layout layouts[] = {
+        { OCIO::CHANNEL_ORDERING_BGRA, 4, 4, { 2, 1, 0,  3 } },
+        { OCIO::CHANNEL_ORDERING_ABGR, 4, 4, { 3, 2, 1,  0 } },
+        { OCIO::CHANNEL_ORDERING_RGB,  3, 3, { 0, 1, 2, -1 } },
+        { OCIO::CHANNEL_ORDERING_BGR,  3, 3, { 2, 1, 0, -1 } },
+        { OCIO::CHANNEL_ORDERING_RGBA, 4, 5, { 0, 1, 2,  3 } },
+        { OCIO::CHANNEL_ORDERING_BGR,  3, 5, { 2, 1, 0, -1 } },
+    };
+
+    for (const auto & layout : layouts)
+    {
+        const int stride = layout.m_pixelStride;
+
+        std::vector<Type> buf(numPixels * stride, Type(0.0f));
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                if (layout.m_offsets[c] >= 0)
+                {
+                    buf[pxl * stride + layout.m_offsets[c]] = inRGBA[4 * pxl + c];
+                }
+            }
+        }
+
+        OCIO::PackedImageDesc img(buf.data(), width, height, layout.m_order, BD,
+                                  sizeof(Type), stride * sizeof(Type),
+                                  width * stride * sizeof(Type));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(img), lineNo);
+
+        const std::vector<Type> & ref = layout.m_offsets[3] >= 0 ? refRGBA : refRGB0;
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                if (layout.m_offsets[c] >= 0)
+                {
+                    checkPixel(ref, pxl, c, buf[pxl * stride + layout.m_offsets[c]]);
+                }
+            }
+        }
+    }
+
+    // Strided planar layout i.e. the generic copy loop.
+
+    {
+        std::vector<Type> r(2 * numPixels), g(2 * numPixels), b(2 * numPixels), a(2 * numPixels);
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            r[2 * pxl] = inRGBA[4 * pxl + 0];
+            g[2 * pxl] = inRGBA[4 * pxl + 1];
+            b[2 * pxl] = inRGBA[4 * pxl + 2];
+            a[2 * pxl] = inRGBA[4 * pxl + 3];
+        }
+
+        OCIO::PlanarImageDesc img(r.data(), g.data(), b.data(), a.data(), width, height, BD,
+                                  2 * sizeof(Type), 2 * width * sizeof(Type));
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(img), lineNo);
+
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            checkPixel(refRGBA, pxl, 0, r[2 * pxl]);
+            checkPixel(refRGBA, pxl, 1, g[2 * pxl]);
+            checkPixel(refRGBA, pxl, 2, b[2 * pxl]);
+            checkPixel(refRGBA, pxl, 3, a[2 * pxl]);
+        }
+    }
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, channel_layouts)
+{
+    // The planar and interleaved layouts have dedicated copy loops, validate all the layouts
+    // against the packed RGBA layout for all the supported bit-depths.
+
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_UINT8>(__LINE__);
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_UINT10>(__LINE__);
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_UINT12>(__LINE__);
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_UINT16>(__LINE__);
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_F16>(__LINE__);
+    ValidateChannelLayouts<OCIO::BIT_DEPTH_F32>(__LINE__);
+}
+
+OCIO_ADD_TEST(CPUProcessor, integer_float_bit_depth_cast)
+{
+    // The integer <-> float bit-depth conversions may be vectorized, validate them against the
+    // scalar conversions. Note that the number of values is not a multiple of the SIMD widths.
+
+    {
+        std::vector<uint16_t> in(65536 + 12);
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            in[idx] = uint16_t(idx * 7);
+        }
+
+        const long numPixels = long(in.size() / 4);
+
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_UINT16,
+                                                                   OCIO::BIT_DEPTH_F32));
+        std::vector<float> out(in.size());
+        op->apply(in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(out[idx], float(in[idx]) * (1.0f / 65535.0f));
+        }
+    }
+
+    {
+        std::vector<uint8_t> in(256 + 4 * 5);
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            in[idx] = uint8_t(idx);
+        }
+
+        const long numPixels = long(in.size() / 4);
+
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_UINT8,
+                                                                   OCIO::BIT_DEPTH_F32));
+        std::vector<float> out(in.size());
+        op->apply(in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(out[idx], float(in[idx]) * (1.0f / 255.0f));
+        }
+    }
+
+    // Float to integer including the rounding, the clamping and the special values.
+
+    std::vector<float> in;
+    for (int i = -100; i < 1200; ++i)
+    {
+        in.push_back(float(i) / 1000.0f);
+        in.push_back(float(i) / 1023.0f + 0.5f / 1023.0f);
+    }
+    in.push_back(std::numeric_limits<float>::infinity());
+    in.push_back(-std::numeric_limits<float>::infinity());
+    in.push_back(-0.0f);
+    in.push_back(1e20f);
+    in.resize(((in.size() + 3) / 4) * 4 + 4 * 3, 0.5f);
+
+    const long numPixels = long(in.size() / 4);
+
+    {
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_UINT8));
+        std::vector<uint8_t> out(in.size());
+        op->apply(in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(out[idx],
+                             OCIO::Converter<OCIO::BIT_DEPTH_UINT8>::CastValue(in[idx] * 255.0f));
+        }
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_UINT10));
+        std::vector<uint16_t> out(in.size());
+        op->apply(in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(out[idx],
+                             OCIO::Converter<OCIO::BIT_DEPTH_UINT10>::CastValue(in[idx] * 1023.0f));
+        }
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::CreateGenericBitDepthHelper(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_UINT16));
+        std::vector<uint16_t> out(in.size());
+        op->apply(in.data(), out.data(), numPixels);
+
+        for (size_t idx = 0; idx < in.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(
+                out[idx], OCIO::Converter<OCIO::BIT_DEPTH_UINT16>::CastValue(in[idx] * 65535.0f));
+        }
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, packed_rgb_in_place)
+{
+    // The packed RGB 32-bit float images are processed in place (i.e. without the intermediate
+    // RGBA buffer) when the alpha channel has no effect on the color channels. Validate the
+    // results against the same pixels processed as RGBA pixels with a zero alpha.
+
+    constexpr long width  = 301;
+    constexpr long height = 3;
+
+    std::vector<float> inRGB(width * height * 3);
+    for (size_t idx = 0; idx < inRGB.size(); ++idx)
+    {
+        inRGB[idx] = float((idx * 13) % 211) / 150.0f - 0.2f;
+    }
+
+    auto validate = [&](const OCIO::ConstCPUProcessorRcPtr & cpu, unsigned lineNo)
+    {
+        std::vector<float> refRGBA(width * height * 4, 0.0f);
+        for (long pxl = 0; pxl < width * height; ++pxl)
+        {
+            refRGBA[4 * pxl + 0] = inRGB[3 * pxl + 0];
+            refRGBA[4 * pxl + 1] = inRGB[3 * pxl + 1];
+            refRGBA[4 * pxl + 2] = inRGB[3 * pxl + 2];
+        }
+        OCIO::PackedImageDesc refImg(refRGBA.data(), width, height, 4);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(refImg), lineNo);
+
+        // In place, from a source to a destination and with a block size.
+
+        std::vector<float> inPlace = inRGB;
+        OCIO::PackedImageDesc img(inPlace.data(), width, height, 3);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(img), lineNo);
+
+        std::vector<float> dst(inRGB.size(), -1.0f);
+        OCIO::PackedImageDesc srcImg(inRGB.data(), width, height, 3);
+        OCIO::PackedImageDesc dstImg(dst.data(), width, height, 3);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(srcImg, dstImg), lineNo);
+
+        const unsigned defaultBlockSize = OCIO::GetCPUProcessorBlockSize();
+        OCIO::SetCPUProcessorBlockSize(7);
+        std::vector<float> blocks = inRGB;
+        OCIO::PackedImageDesc blocksImg(blocks.data(), width, height, 3);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(blocksImg), lineNo);
+        OCIO::SetCPUProcessorBlockSize(defaultBlockSize);
+
+        for (long pxl = 0; pxl < width * height; ++pxl)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                const float ref = refRGBA[4 * pxl + c];
+                OCIO_CHECK_CLOSE_FROM(inPlace[3 * pxl + c], ref, 1e-5f, lineNo);
+                OCIO_CHECK_CLOSE_FROM(dst[3 * pxl + c], ref, 1e-5f, lineNo);
+                OCIO_CHECK_CLOSE_FROM(blocks[3 * pxl + c], ref, 1e-5f, lineNo);
+            }
+        }
+
+        // The input image is unchanged.
+        OCIO_CHECK_EQUAL_FROM(inRGB[5], float((5 * 13) % 211) / 150.0f - 0.2f, lineNo);
+    };
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m[16] = { 0.6, 0.3, 0.1, 0.0,
+                               0.2, 0.7, 0.1, 0.0,
+                               0.0, 0.1, 0.9, 0.0,
+                               0.0, 0.0, 0.0, 1.0 };
+    constexpr double offset[4] = { 0.01, 0.02, 0.03, 0.5 };
+    matrix->setMatrix(m);
+    matrix->setOffset(offset);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.0);
+    range->setMinOutValue(0.0);
+
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.0, 1.8, 1.0 };
+    exp->setValue(gamma);
+
+    {
+        // Only ops having a 3-channel renderer.
+        auto group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(range);
+
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+        validate(proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE), __LINE__);
+    }
+
+    {
+        // Mix of ops with and without a 3-channel renderer.
+        auto group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(range);
+        group->appendTransform(exp);
+        group->appendTransform(matrix);
+
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+        validate(proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE), __LINE__);
+        validate(proc->getDefaultCPUProcessor(), __LINE__);
+    }
+
+    {
+        // The alpha channel changes the color channels so the RGBA processing is used.
+        OCIO::MatrixTransformRcPtr alphaMatrix = OCIO::MatrixTransform::Create();
+        constexpr double am[16] = { 1.0, 0.0, 0.0, 0.5,
+                                    0.0, 1.0, 0.0, 0.0,
+                                    0.0, 0.0, 1.0, 0.0,
+                                    0.0, 0.0, 0.0, 1.0 };
+        alphaMatrix->setMatrix(am);
+
+        auto group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(exp);
+        group->appendTransform(alphaMatrix);
+
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+        validate(proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE), __LINE__);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, profiling)
+{
+    constexpr long width  = 301;
+    constexpr long height = 3;
+    constexpr unsigned long long numPixels = width * height;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m[16] = { 0.6, 0.3, 0.1, 0.0,
+                               0.2, 0.7, 0.1, 0.0,
+                               0.0, 0.1, 0.9, 0.0,
+                               0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m);
+    matrix->getFormatMetadata().setName("look matrix");
+    matrix->getFormatMetadata().setID("matrix-id");
+
+    OCIO::ExponentTransformRcPtr exp = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.0, 1.8, 1.0 };
+    exp->setValue(gamma);
+    exp->getFormatMetadata().setName("look gamma");
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.0);
+    range->setMinOutValue(0.0);
+
+    auto group = OCIO::GroupTransform::Create();
+    group->appendTransform(matrix);
+    group->appendTransform(exp);
+    group->appendTransform(range);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+
+    std::vector<uint8_t> src(width * height * 4);
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        src[idx] = uint8_t((idx * 13) % 256);
+    }
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32,
+                                         OCIO::OPTIMIZATION_NONE);
+
+    // The profiling is disabled by default but the ops are already known.
+
+    OCIO_CHECK_ASSERT(!cpu->isProfilingEnabled());
+    OCIO_REQUIRE_EQUAL(cpu->getNumProfiledOps(), 3);
+
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(0)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(1)), "<GammaOp>");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(2)), "<RangeOp>");
+
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpFormatMetadata(0).getName()), "look matrix");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpFormatMetadata(0).getID()), "matrix-id");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpFormatMetadata(1).getName()), "look gamma");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpFormatMetadata(2).getName()), "");
+
+    OCIO_CHECK_THROW_WHAT(cpu->getProfiledOpType(3), OCIO::Exception,
+                          "Invalid profiled op index 3 where the number of profiled ops is 3.");
+    OCIO_CHECK_THROW_WHAT(cpu->getProfiledOpTime(-1), OCIO::Exception,
+                          "Invalid profiled op index -1");
+
+    std::vector<float> ref(width * height * 4);
+    OCIO::PackedImageDesc srcImg(src.data(), width, height, 4, OCIO::BIT_DEPTH_UINT8,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc refImg(ref.data(), width, height, 4);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, refImg));
+
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumPixels(idx), 0ULL);
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpTime(idx), 0.0);
+    }
+    OCIO_CHECK_EQUAL(cpu->getProfiledPackTime(), 0.0);
+
+    // Enable the profiling and validate that the results are unchanged.
+
+    cpu->setProfilingEnabled(true);
+    OCIO_CHECK_ASSERT(cpu->isProfilingEnabled());
+
+    std::vector<float> dst(width * height * 4, -1.0f);
+    OCIO::PackedImageDesc dstImg(dst.data(), width, height, 4);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg));
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg, 2));
+
+    for (size_t idx = 0; idx < dst.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(dst[idx], ref[idx]);
+    }
+
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumPixels(idx), 2 * numPixels);
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumBytes(idx), 2 * numPixels * 32);
+        OCIO_CHECK_ASSERT(cpu->getProfiledOpTime(idx) > 0.0);
+    }
+    OCIO_CHECK_ASSERT(cpu->getProfiledPackTime() > 0.0);
+    OCIO_CHECK_ASSERT(cpu->getProfiledUnpackTime() > 0.0);
+
+    // The single pixel methods are not profiled.
+
+    float pixel[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+    OCIO::ConstCPUProcessorRcPtr cpuF32 = proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+    cpuF32->setProfilingEnabled(true);
+    cpuF32->applyRGBA(pixel);
+    OCIO_CHECK_EQUAL(cpuF32->getProfiledOpNumPixels(0), 0ULL);
+
+    // The packed RGB float images are also profiled. The gamma op does not have a 3-channel
+    // renderer so its pixels are copied to and from an RGBA buffer.
+
+    std::vector<float> rgb(width * height * 3, 0.5f);
+    OCIO::PackedImageDesc rgbImg(rgb.data(), width, height, 3);
+    OCIO_CHECK_NO_THROW(cpuF32->apply(rgbImg));
+
+    OCIO_CHECK_EQUAL(cpuF32->getProfiledOpNumPixels(0), numPixels);
+    OCIO_CHECK_EQUAL(cpuF32->getProfiledOpNumBytes(0), numPixels * 24);
+    OCIO_CHECK_EQUAL(cpuF32->getProfiledOpNumBytes(1), numPixels * 32);
+    OCIO_CHECK_EQUAL(cpuF32->getProfiledOpNumBytes(2), numPixels * 24);
+    OCIO_CHECK_ASSERT(cpuF32->getProfiledPackTime() > 0.0);
+
+    // Reset the statistics, and disable the profiling.
+
+    cpu->resetProfiling();
+    cpu->setProfilingEnabled(false);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg));
+
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumPixels(idx), 0ULL);
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumBytes(idx), 0ULL);
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpTime(idx), 0.0);
+    }
+    OCIO_CHECK_EQUAL(cpu->getProfiledPackTime(), 0.0);
+    OCIO_CHECK_EQUAL(cpu->getProfiledUnpackTime(), 0.0);
+}
+
+OCIO_ADD_TEST(CPUProcessor, profiling_merged_ops)
+{
+    // The first and last ops are merged with the bit-depth conversions when the profiling is
+    // disabled. Validate that the profiling processes them separately with the same results.
+
+    constexpr long width  = 64;
+    constexpr long height = 2;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(1024, false);
+    for (unsigned long idx = 0; idx < 1024; ++idx)
+    {
+        const float v = float(idx) / 1023.0f;
+        lut->setValue(idx, v * v, v, std::sqrt(v));
+    }
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    auto group = OCIO::GroupTransform::Create();
+    group->appendTransform(lut);
+    group->appendTransform(ec);
+    group->appendTransform(lut);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+
+    std::vector<uint16_t> src(width * height * 4);
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        src[idx] = uint16_t((idx * 1013) % 65536);
+    }
+
+    OCIO::PackedImageDesc srcImg(src.data(), width, height, 4, OCIO::BIT_DEPTH_UINT16,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT16,
+                                         OCIO::OPTIMIZATION_NONE);
+    OCIO_REQUIRE_EQUAL(cpu->getNumProfiledOps(), 3);
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(0)), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(1)), "<ExposureContrastOp>");
+    OCIO_CHECK_EQUAL(std::string(cpu->getProfiledOpType(2)), "<Lut1DOp>");
+
+    // The dynamic property is shared by the profiled ops.
+    OCIO::DynamicPropertyRcPtr dp = cpu->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    auto exposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+    exposure->setValue(-0.5);
+
+    std::vector<uint16_t> ref(src.size());
+    OCIO::PackedImageDesc refImg(ref.data(), width, height, 4, OCIO::BIT_DEPTH_UINT16,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, refImg));
+
+    cpu->setProfilingEnabled(true);
+
+    std::vector<uint16_t> dst(src.size());
+    OCIO::PackedImageDesc dstImg(dst.data(), width, height, 4, OCIO::BIT_DEPTH_UINT16,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg));
+
+    for (size_t idx = 0; idx < dst.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(float(dst[idx]), float(ref[idx]), 1.0f);
+    }
+
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumPixels(idx), (unsigned long long)(width * height));
+    }
+
+    cpu->setProfilingEnabled(false);
+}
+
+namespace
+{
+
+// Process the image with the dynamic exposure of the CPU processor set to a given value.
+std::vector<float> ApplyWithExposure(const OCIO::ConstCPUProcessorRcPtr & cpu,
+                                     const std::vector<float> & src,
+                                     long width, long height,
+                                     double exposureValue)
+{
+    OCIO::DynamicPropertyRcPtr dp = cpu->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    auto exposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+
+    const double previousValue = exposure->getValue();
+    exposure->setValue(exposureValue);
+
+    std::vector<float> dst = src;
+    OCIO::PackedImageDesc img(dst.data(), width, height, 4);
+    cpu->apply(img);
+
+    exposure->setValue(previousValue);
+
+    return dst;
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, dynamic_property_snapshot)
+{
+    // Validate that several snapshots share one CPU processor while each one uses its own
+    // dynamic property values.
+
+    constexpr long width  = 64;
+    constexpr long height = 16;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(1024, false);
+    for (unsigned long idx = 0; idx < 1024; ++idx)
+    {
+        const float v = float(idx) / 1023.0f;
+        lut->setValue(idx, v * v, v, std::sqrt(v));
+    }
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->makeExposureDynamic();
+    ec->makeContrastDynamic();
+
+    auto group = OCIO::GroupTransform::Create();
+    group->appendTransform(lut);
+    group->appendTransform(ec);
+    group->appendTransform(lut);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+    OCIO_REQUIRE_ASSERT(cpu->isDynamic());
+
+    std::vector<float> src(width * height * 4);
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        src[idx] = float(idx % 251) / 250.0f;
+    }
+
+    const std::vector<float> ref0 = ApplyWithExposure(cpu, src, width, height, 0.0);
+    const std::vector<float> ref1 = ApplyWithExposure(cpu, src, width, height, 1.0);
+    const std::vector<float> ref2 = ApplyWithExposure(cpu, src, width, height, -1.5);
+
+    // The snapshots hold their own dynamic properties.
+
+    OCIO::DynamicPropertySnapshotRcPtr snapshot1 = cpu->createDynamicPropertySnapshot();
+    OCIO::DynamicPropertySnapshotRcPtr snapshot2 = cpu->createDynamicPropertySnapshot();
+
+    OCIO_CHECK_ASSERT(snapshot1->isDynamic());
+    OCIO_CHECK_ASSERT(snapshot1->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+    OCIO_CHECK_ASSERT(snapshot1->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_CONTRAST));
+    OCIO_CHECK_ASSERT(!snapshot1->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_GAMMA));
+    OCIO_CHECK_THROW_WHAT(snapshot1->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GAMMA),
+                          OCIO::Exception,
+                          "Cannot find dynamic property; not used by the dynamic property snapshot.");
+
+    OCIO::DynamicPropertyRcPtr dp1 = snapshot1->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO::DynamicPropertyRcPtr dp2 = snapshot2->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO::DynamicPropertyRcPtr dp = cpu->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO_CHECK_NE(dp1.get(), dp2.get());
+    OCIO_CHECK_NE(dp1.get(), dp.get());
+
+    OCIO::DynamicPropertyValue::AsDouble(dp1)->setValue(1.0);
+    OCIO::DynamicPropertyValue::AsDouble(dp2)->setValue(-1.5);
+    OCIO_CHECK_EQUAL(OCIO::DynamicPropertyValue::AsDouble(dp)->getValue(), 0.0);
+
+    // Concurrent apply calls sharing the CPU processor.
+
+    std::vector<float> dst1(src.size()), dst2(src.size()), dst0(src.size());
+    {
+        auto ApplyLoop = [&cpu, &src](std::vector<float> & dst,
+                                      const OCIO::ConstDynamicPropertySnapshotRcPtr & snapshot)
+        {
+            for (int iter = 0; iter < 20; ++iter)
+            {
+                dst = src;
+                OCIO::PackedImageDesc img(dst.data(), width, height, 4);
+                cpu->apply(img, snapshot);
+            }
+        };
+
+        std::thread thread1(ApplyLoop, std::ref(dst1), snapshot1);
+        std::thread thread2(ApplyLoop, std::ref(dst2), snapshot2);
+        std::thread thread0(ApplyLoop, std::ref(dst0), nullptr);
+        thread1.join();
+        thread2.join();
+        thread0.join();
+    }
+
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(dst0[idx], ref0[idx]);
+        OCIO_CHECK_EQUAL(dst1[idx], ref1[idx]);
+        OCIO_CHECK_EQUAL(dst2[idx], ref2[idx]);
+    }
+
+    // With several threads and from a source to a destination image.
+    {
+        std::vector<float> dst(src.size());
+        OCIO::PackedImageDesc srcImg(const_cast<float *>(src.data()), width, height, 4);
+        OCIO::PackedImageDesc dstImg(dst.data(), width, height, 4);
+        OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg, snapshot2, 4));
+
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(dst[idx], ref2[idx]);
+        }
+    }
+
+    // The single pixel methods.
+    {
+        float rgba[4]{ src[0], src[1], src[2], src[3] };
+        cpu->applyRGBA(rgba, snapshot1);
+        OCIO_CHECK_EQUAL(rgba[0], ref1[0]);
+        OCIO_CHECK_EQUAL(rgba[1], ref1[1]);
+        OCIO_CHECK_EQUAL(rgba[2], ref1[2]);
+
+        float rgb[3]{ src[0], src[1], src[2] };
+        cpu->applyRGB(rgb, snapshot1);
+        OCIO_CHECK_EQUAL(rgb[0], ref1[0]);
+        OCIO_CHECK_EQUAL(rgb[1], ref1[1]);
+        OCIO_CHECK_EQUAL(rgb[2], ref1[2]);
+    }
+
+    // The profiling also uses the snapshot values.
+    {
+        cpu->setProfilingEnabled(true);
+
+        std::vector<float> dst = src;
+        OCIO::PackedImageDesc img(dst.data(), width, height, 4);
+        OCIO_CHECK_NO_THROW(cpu->apply(img, snapshot1));
+
+        cpu->setProfilingEnabled(false);
+
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(dst[idx], ref1[idx], 1e-6f);
+        }
+        OCIO_REQUIRE_EQUAL(cpu->getNumProfiledOps(), 3);
+        OCIO_CHECK_EQUAL(cpu->getProfiledOpNumPixels(1), (unsigned long long)(width * height));
+    }
+
+    // A snapshot copies the current values.
+
+    OCIO::DynamicPropertyValue::AsDouble(dp)->setValue(-1.5);
+    OCIO::DynamicPropertySnapshotRcPtr snapshot3 = cpu->createDynamicPropertySnapshot();
+    OCIO::DynamicPropertyValue::AsDouble(dp)->setValue(0.0);
+
+    OCIO::DynamicPropertySnapshotRcPtr snapshot4 = snapshot1->createEditableCopy();
+    OCIO::DynamicPropertyRcPtr dp4 = snapshot4->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO_CHECK_NE(dp4.get(), dp1.get());
+    OCIO_CHECK_EQUAL(OCIO::DynamicPropertyValue::AsDouble(dp4)->getValue(), 1.0);
+    OCIO::DynamicPropertyValue::AsDouble(dp1)->setValue(-1.5);
+    OCIO_CHECK_EQUAL(OCIO::DynamicPropertyValue::AsDouble(dp4)->getValue(), 1.0);
+
+    {
+        std::vector<float> dst3 = src;
+        OCIO::PackedImageDesc img3(dst3.data(), width, height, 4);
+        cpu->apply(img3, snapshot3);
+
+        std::vector<float> dst4 = src;
+        OCIO::PackedImageDesc img4(dst4.data(), width, height, 4);
+        cpu->apply(img4, snapshot4);
+
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(dst3[idx], ref2[idx]);
+            OCIO_CHECK_EQUAL(dst4[idx], ref1[idx]);
+        }
+    }
+
+    // A snapshot only works with its CPU processor.
+
+    OCIO::ConstCPUProcessorRcPtr otherCpu
+        = proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_LOSSLESS);
+    OCIO_REQUIRE_ASSERT(otherCpu.get() != cpu.get());
+    {
+        std::vector<float> dst = src;
+        OCIO::PackedImageDesc img(dst.data(), width, height, 4);
+        OCIO_CHECK_THROW_WHAT(otherCpu->apply(img, snapshot1),
+                              OCIO::Exception,
+                              "The dynamic property snapshot does not come from this CPU processor.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, dynamic_property_snapshot_first_op)
+{
+    // The dynamic op is the only op, so its CPU op also converts the input and output
+    // bit-depths (i.e. for 32-bit float images).
+
+    constexpr long width  = 32;
+    constexpr long height = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GradingPrimaryTransformRcPtr gp
+        = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LIN);
+    gp->makeDynamic();
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(gp);
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+
+    OCIO::DynamicPropertySnapshotRcPtr snapshot = cpu->createDynamicPropertySnapshot();
+    OCIO_REQUIRE_ASSERT(snapshot->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY));
+
+    OCIO::GradingPrimary values(OCIO::GRADING_LIN);
+    values.m_offset = OCIO::GradingRGBM(0.1, 0.2, 0.3, 0.0);
+
+    OCIO::DynamicPropertyRcPtr dp
+        = snapshot->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY);
+    OCIO::DynamicPropertyValue::AsGradingPrimary(dp)->setValue(values);
+
+    std::vector<float> src(width * height * 4);
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        src[idx] = float(idx % 17) / 16.0f;
+    }
+
+    // Packed RGBA and packed RGB images.
+    for (long numChannels : { 4, 3 })
+    {
+        std::vector<float> srcImg(width * height * numChannels);
+        for (long pxl = 0; pxl < width * height; ++pxl)
+        {
+            for (long c = 0; c < numChannels; ++c)
+            {
+                srcImg[pxl * numChannels + c] = src[pxl * 4 + c];
+            }
+        }
+
+        std::vector<float> dst = srcImg;
+        OCIO::PackedImageDesc img(dst.data(), width, height, numChannels);
+        OCIO_CHECK_NO_THROW(cpu->apply(img, snapshot));
+
+        std::vector<float> ref = srcImg;
+        OCIO::PackedImageDesc refImg(ref.data(), width, height, numChannels);
+        OCIO_CHECK_NO_THROW(cpu->apply(refImg));
+
+        for (long pxl = 0; pxl < width * height; ++pxl)
+        {
+            for (long c = 0; c < 3; ++c)
+            {
+                const long idx = pxl * numChannels + c;
+                OCIO_CHECK_EQUAL(ref[idx], srcImg[idx]);
+                OCIO_CHECK_CLOSE(dst[idx], srcImg[idx] + 0.1f * float(c + 1), 1e-6f);
+            }
+        }
+    }
+}
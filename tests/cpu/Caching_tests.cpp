@@ -107,6 +107,141 @@ OCIO_ADD_TEST(Caching, generic_cache)
     }
 }
 
+OCIO_ADD_TEST(Caching, generic_cache_capacity)
+{
+    // A unit test to check the LRU eviction & the statistics of the GenericCache class.
+
+    {
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        OCIO::CacheStatistics stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+        OCIO_CHECK_EQUAL(stats.m_maxEntries, 0);
+        OCIO_CHECK_EQUAL(stats.m_maxBytes, 0);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            // Unlimited by default.
+            cache["entry1"] = std::make_shared<Data>();
+            cache["entry2"] = std::make_shared<Data>();
+            cache["entry3"] = std::make_shared<Data>();
+        }
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+        OCIO_CHECK_EQUAL(stats.m_numMisses, 3);
+        OCIO_CHECK_EQUAL(stats.m_numHits, 0);
+        OCIO_CHECK_EQUAL(stats.m_numEvictions, 0);
+        OCIO_CHECK_EQUAL(stats.m_numBytes, 3 * (sizeof(std::string) + sizeof(DataRcPtr)));
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            // Use entry1 so entry2 becomes the least recently used one.
+            OCIO_CHECK_ASSERT(cache["entry1"]);
+        }
+
+        cache.setCapacity(2, 0);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            OCIO_CHECK_ASSERT(cache.exists("entry1"));
+            OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+            OCIO_CHECK_ASSERT(cache.exists("entry3"));
+        }
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+        OCIO_CHECK_EQUAL(stats.m_maxEntries, 2);
+        OCIO_CHECK_EQUAL(stats.m_numHits, 1);
+        OCIO_CHECK_EQUAL(stats.m_numEvictions, 1);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            // Adding a new entry evicts the least recently used one i.e. entry3.
+            cache["entry4"] = std::make_shared<Data>();
+
+            OCIO_CHECK_ASSERT(cache.exists("entry1"));
+            OCIO_CHECK_ASSERT(!cache.exists("entry3"));
+            OCIO_CHECK_ASSERT(cache.exists("entry4"));
+        }
+
+        OCIO_CHECK_EQUAL(cache.getStatistics().m_numEvictions, 2);
+
+        // Limit the number of bytes.
+        cache.setCapacity(0, 1000);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            cache.setEntrySize("entry1", 600);
+            cache.setEntrySize("entry4", 300);
+
+            OCIO_CHECK_ASSERT(cache.exists("entry1"));
+            OCIO_CHECK_ASSERT(cache.exists("entry4"));
+        }
+
+        OCIO_CHECK_EQUAL(cache.getStatistics().m_numBytes, 900);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            // entry1 is the least recently used one.
+            cache["entry5"] = std::make_shared<Data>();
+            cache.setEntrySize("entry5", 200);
+
+            OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+            OCIO_CHECK_ASSERT(cache.exists("entry4"));
+            OCIO_CHECK_ASSERT(cache.exists("entry5"));
+        }
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+        OCIO_CHECK_EQUAL(stats.m_numBytes, 500);
+        OCIO_CHECK_EQUAL(stats.m_numEvictions, 3);
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+
+            // The most recently used entry is always kept even if too large.
+            cache["entry6"] = std::make_shared<Data>();
+            cache.setEntrySize("entry6", 2000);
+
+            OCIO_CHECK_ASSERT(cache.exists("entry6"));
+        }
+
+        OCIO_CHECK_EQUAL(cache.getStatistics().m_numEntries, 1);
+
+        // Clearing the cache keeps the capacity & the counters.
+        cache.clear();
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+        OCIO_CHECK_EQUAL(stats.m_numBytes, 0);
+        OCIO_CHECK_EQUAL(stats.m_maxBytes, 1000);
+        OCIO_CHECK_EQUAL(stats.m_numEvictions, 5);
+    }
+
+    {
+        // Disable all the caches.
+        Guard guard;
+
+        OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+        {
+            OCIO::AutoMutex m(cache.lock());
+            cache["entry1"] = std::make_shared<Data>();
+        }
+
+        const OCIO::CacheStatistics stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+        OCIO_CHECK_EQUAL(stats.m_numMisses, 0);
+    }
+}
+
 OCIO_ADD_TEST(Caching, processor_cache)
 {
     // A unit test to check the ProcessorCache class.
@@ -244,4 +379,87 @@ OCIO_ADD_TEST(Caching, processor_cache)
             OCIO_CHECK_EQUAL(procA, procB); 
         }
     }
-}
\ No newline at end of file
+}
+
+OCIO_ADD_TEST(Caching, processor_cache_capacity)
+{
+    // Test the capacity of the Config processor cache & of the global file cache.
+
+    static const std::string CONFIG = 
+        "ocio_profile_version: 2\n"
+        "\n"
+        "search_path: " + OCIO::GetTestFilesDir() + "\n"
+        "\n"
+        "roles:\n"
+        "  default: cs1\n"
+        "\n"
+        "displays:\n"
+        "  disp1:\n"
+        "    - !<View> {name: view1, colorspace: cs3}\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    from_scene_reference: !<MatrixTransform> {offset: [0.11, 0.12, 0.13, 0]}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs3\n"
+        "    from_scene_reference: !<FileTransform> {src: lut1d_green.ctf}\n";
+
+    std::istringstream iss;
+    iss.str(CONFIG);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    OCIO::ConfigRcPtr cfg = config->createEditableCopy();
+    cfg->setProcessorCacheCapacity(1, 0);
+
+    OCIO::ClearAllCaches();
+    const OCIO::CacheStatistics fileStats = OCIO::GetFileCacheStatistics();
+
+    OCIO::ConstProcessorRcPtr procA = cfg->getProcessor("cs1", "cs2");
+    OCIO_CHECK_EQUAL(procA, cfg->getProcessor("cs1", "cs2"));
+
+    OCIO::CacheStatistics stats = cfg->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_maxEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 1);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 1);
+    OCIO_CHECK_EQUAL(stats.m_numEvictions, 0);
+
+    // The processor with a LUT evicts the first one.
+    OCIO::ConstProcessorRcPtr procB = cfg->getProcessor("cs1", "cs3");
+
+    stats = cfg->getProcessorCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numEvictions, 1);
+    // The LUT values are part of the estimated size.
+    OCIO_CHECK_GT(stats.m_numBytes, 32 * 3 * sizeof(float));
+
+    OCIO_CHECK_NE(procA, cfg->getProcessor("cs1", "cs2"));
+
+    // The LUT file was loaded once and its file size is accounted for.
+    OCIO::CacheStatistics stats2 = OCIO::GetFileCacheStatistics();
+    OCIO_CHECK_EQUAL(stats2.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats2.m_numMisses, fileStats.m_numMisses + 1);
+    OCIO_CHECK_GT(stats2.m_numBytes, 400);
+
+    // The capacity is kept by config copies.
+    OCIO::ConfigRcPtr cfg2 = cfg->createEditableCopy();
+    OCIO_CHECK_EQUAL(cfg2->getProcessorCacheStatistics().m_maxEntries, 1);
+    OCIO_CHECK_EQUAL(cfg2->getProcessorCacheStatistics().m_numEntries, 0);
+
+    // Limit the file cache.
+    OCIO::SetFileCacheCapacity(0, 10);
+    stats2 = OCIO::GetFileCacheStatistics();
+    OCIO_CHECK_EQUAL(stats2.m_maxBytes, 10);
+    // The most recently used entry is kept.
+    OCIO_CHECK_EQUAL(stats2.m_numEntries, 1);
+
+    OCIO::SetFileCacheCapacity(0, 0);
+    OCIO::ClearAllCaches();
+}
@@ -13,6 +13,7 @@
 #include "UnitTestUtils.h"
 #include "utils/StringUtils.h"
 #include "Platform.h"
+#include "ThreadUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -8136,6 +8137,85 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, processor_cache_multithreaded)
+{
+    // Validation of the processor cache of the Config class when several threads concurrently
+    // request the same and different processors.
+
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<BuiltinTransform> {style: ACEScct_to_ACES2065-1}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}
+
+  - !<ColorSpace>
+    name: cs3
+    from_scene_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}
+
+  - !<ColorSpace>
+    name: cs4
+    from_scene_reference: !<ColorSpaceTransform> {src: ref, dst: cs1}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+    OCIO_CHECK_NO_THROW(config->validate());
+
+    static const std::vector<std::string> dstNames{ "cs1", "cs2", "cs3", "cs4" };
+
+    static constexpr long NumRequests = 64;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(NumRequests);
+
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(8, NumRequests, [&](long begin, long end)
+    {
+        for (long idx = begin; idx < end; ++idx)
+        {
+            processors[idx] = config->getProcessor("ref", dstNames[idx % dstNames.size()].c_str());
+        }
+    }));
+
+    // All the requests of the same processor share the same instance (including the ones with
+    // a different key but an identical processor i.e. cs1 & cs4).
+
+    for (long idx = 0; idx < NumRequests; ++idx)
+    {
+        OCIO_REQUIRE_ASSERT(processors[idx]);
+
+        const std::string & dstName = dstNames[idx % dstNames.size()];
+        OCIO_CHECK_EQUAL(processors[idx].get(), config->getProcessor("ref", dstName.c_str()).get());
+    }
+
+    OCIO_CHECK_EQUAL(processors[0].get(), processors[3].get());
+    OCIO_CHECK_NE(processors[0].get(), processors[1].get());
+    OCIO_CHECK_NE(processors[1].get(), processors[2].get());
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
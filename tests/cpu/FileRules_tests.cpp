@@ -1092,6 +1092,107 @@ OCIO_ADD_TEST(FileRules, rules_priority)
     OCIO_CHECK_ASSERT(colorSpace != nullptr && 0 == strcmp(colorSpace, OCIO::ROLE_DEFAULT));
 }
 
+OCIO_ADD_TEST(FileRules, rules_batch)
+{
+    std::istringstream is;
+    is.str(g_config);
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is)->createEditableCopy());
+    auto rules = config->getFileRules()->createEditableCopy();
+    OCIO_CHECK_NO_THROW(rules->insertRule(0, "literal prefix", "cs1", "/mnt/plates/*", "exr"));
+    OCIO_CHECK_NO_THROW(rules->insertRule(1, "literal name", "cs2", "/mnt/media/a.b", "Tif"));
+    OCIO_CHECK_NO_THROW(rules->insertPathSearchRule(2));
+    OCIO_CHECK_NO_THROW(rules->insertRule(3, "glob extension", "raw", "*", "[dD][pP]x"));
+    OCIO_CHECK_NO_THROW(rules->insertRule(4, "regex rule", "cs2", ".*\\.jpe?g"));
+    config->setFileRules(rules);
+
+    const std::vector<const char *> filePaths{
+        "/mnt/plates/file.exr",
+        "/mnt/plates/file.EXR",
+        "/mnt/plates/file.exr.bak",
+        "/mnt/plates",
+        "/mnt/PLATES/file.exr",
+        "/mnt/media/a.b.tif",
+        "/mnt/media/a.b.TIF",
+        "/mnt/media/aXb.tif",
+        "/mnt/media/a.b.tiff",
+        "/mnt/media/other_cs1.tif",
+        "/mnt/plates/other_cs1.exr",
+        "/mnt/media/file.dpx",
+        "/mnt/media/file.Dpx",
+        "/mnt/media/file.DPX",
+        "/mnt/media/file.jpg",
+        "/mnt/media/file.jpeg",
+        "/mnt/media/file.JPG",
+        ".exr",
+        "exr",
+        "",
+        nullptr
+    };
+    const size_t numFilePaths = filePaths.size();
+
+    std::vector<const char *> colorSpaces(numFilePaths, nullptr);
+    std::vector<size_t> ruleIndices(numFilePaths, 0);
+    OCIO_CHECK_NO_THROW(config->getColorSpacesFromFilepaths(filePaths.data(),
+                                                            numFilePaths,
+                                                            colorSpaces.data(),
+                                                            ruleIndices.data()));
+
+    // The batch results must be identical to the ones of the single file path method.
+    for (size_t idx = 0; idx < numFilePaths; ++idx)
+    {
+        size_t rulePos = 0;
+        const char * colorSpace = config->getColorSpaceFromFilepath(filePaths[idx], rulePos);
+        OCIO_REQUIRE_ASSERT(colorSpaces[idx] != nullptr);
+        OCIO_CHECK_EQUAL(std::string(colorSpaces[idx]), std::string(colorSpace));
+        OCIO_CHECK_EQUAL(ruleIndices[idx], rulePos);
+    }
+
+    static const std::vector<size_t> expectedRules{ 0, 0, 5, 5, 5,
+                                                    1, 1, 5, 5, 2, 0,
+                                                    3, 3, 5,
+                                                    4, 4, 5,
+                                                    5, 5, 5, 5 };
+    for (size_t idx = 0; idx < numFilePaths; ++idx)
+    {
+        OCIO_CHECK_EQUAL(ruleIndices[idx], expectedRules[idx]);
+    }
+
+    // The path search rule returns the color space found in the file path.
+    OCIO_CHECK_EQUAL(std::string(colorSpaces[9]), std::string("other_cs1"));
+    OCIO_CHECK_EQUAL(std::string(colorSpaces[10]), std::string("cs1"));
+
+    // The rule indices are optional.
+    std::vector<const char *> otherColorSpaces(numFilePaths, nullptr);
+    OCIO_CHECK_NO_THROW(config->getColorSpacesFromFilepaths(filePaths.data(),
+                                                            numFilePaths,
+                                                            otherColorSpaces.data()));
+    for (size_t idx = 0; idx < numFilePaths; ++idx)
+    {
+        OCIO_CHECK_EQUAL(std::string(otherColorSpaces[idx]), std::string(colorSpaces[idx]));
+    }
+
+    // The rules are still correct once copied.
+    OCIO::ConstConfigRcPtr copy = config->createEditableCopy();
+    OCIO_CHECK_NO_THROW(copy->getColorSpacesFromFilepaths(filePaths.data(),
+                                                          numFilePaths,
+                                                          otherColorSpaces.data(),
+                                                          ruleIndices.data()));
+    for (size_t idx = 0; idx < numFilePaths; ++idx)
+    {
+        OCIO_CHECK_EQUAL(ruleIndices[idx], expectedRules[idx]);
+    }
+
+    // Faulty arguments.
+    OCIO_CHECK_NO_THROW(config->getColorSpacesFromFilepaths(nullptr, 0, nullptr));
+    OCIO_CHECK_THROW_WHAT(config->getColorSpacesFromFilepaths(nullptr, 1, colorSpaces.data()),
+                          OCIO::Exception,
+                          "File rules: the list of file paths is null.");
+    OCIO_CHECK_THROW_WHAT(config->getColorSpacesFromFilepaths(filePaths.data(), 1, nullptr),
+                          OCIO::Exception,
+                          "File rules: the list of color spaces is null.");
+}
+
 OCIO_ADD_TEST(FileRules, config_no_default)
 {
     constexpr char configNoDefault[] = { R"(ocio_profile_version: 2
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "GPUProcessor.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::ConstGPUProcessorRcPtr BuildGPUProcessor(bool dynamic)
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto lut1d = OCIO::Lut1DTransform::Create(1024, false);
+    for (unsigned long idx = 0; idx < 1024; ++idx)
+    {
+        const float val = float(idx) / 1023.f;
+        lut1d->setValue(idx, val * val, val, std::sqrt(val));
+    }
+    group->appendTransform(lut1d);
+
+    auto lut3d = OCIO::Lut3DTransform::Create(5);
+    lut3d->setValue(1, 2, 3, 0.1f, 0.2f, 0.3f);
+    group->appendTransform(lut3d);
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    if (dynamic)
+    {
+        ec->makeExposureDynamic();
+    }
+    group->appendTransform(ec);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    return config->getProcessor(group)->getDefaultGPUProcessor();
+}
+
+OCIO::GpuShaderDescRcPtr CreateShaderDesc(const char * functionName)
+{
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    shaderDesc->setLanguage(OCIO::GPU_LANGUAGE_GLSL_4_0);
+    shaderDesc->setFunctionName(functionName);
+    return shaderDesc;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(GPUProcessor, shader_cache)
+{
+    OCIO::ClearAllCaches();
+
+    // The cache is bounded by default.
+    OCIO::CacheStatistics stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_maxEntries, OCIO::ShaderCache::MaxEntries);
+    OCIO_CHECK_EQUAL(stats.m_maxBytes, OCIO::ShaderCache::MaxBytes);
+
+    OCIO::ConstGPUProcessorRcPtr gpu = BuildGPUProcessor(false);
+
+    OCIO::GpuShaderDescRcPtr shaderDesc1 = CreateShaderDesc("OCIOMain");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc1));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 1);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 0);
+    // The texture values are part of the estimated size.
+    OCIO_CHECK_GT(stats.m_numBytes, (1024 * 3 + 5 * 5 * 5 * 3) * sizeof(float));
+
+    OCIO_REQUIRE_EQUAL(shaderDesc1->getNumTextures(), 1);
+    OCIO_REQUIRE_EQUAL(shaderDesc1->getNum3DTextures(), 1);
+
+    // Another shader description with the same parameters shares the shader program information.
+
+    OCIO::GpuShaderDescRcPtr shaderDesc2 = CreateShaderDesc("OCIOMain");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc2));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 1);
+
+    OCIO_CHECK_EQUAL(std::string(shaderDesc1->getShaderText()),
+                     std::string(shaderDesc2->getShaderText()));
+    OCIO_CHECK_EQUAL(std::string(shaderDesc1->getCacheID()),
+                     std::string(shaderDesc2->getCacheID()));
+    OCIO_CHECK_EQUAL(shaderDesc1->getShaderText(), shaderDesc2->getShaderText());
+
+    OCIO_REQUIRE_EQUAL(shaderDesc2->getNumTextures(), 1);
+    OCIO_REQUIRE_EQUAL(shaderDesc2->getNum3DTextures(), 1);
+
+    const char * textureName1 = nullptr;
+    const char * samplerName1 = nullptr;
+    unsigned width1 = 0, height1 = 0;
+    OCIO::GpuShaderDesc::TextureType channel1 = OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL;
+    OCIO::GpuShaderDesc::TextureDimensions dimensions1 = OCIO::GpuShaderDesc::TEXTURE_1D;
+    OCIO::Interpolation interpolation1 = OCIO::INTERP_UNKNOWN;
+    shaderDesc1->getTexture(0, textureName1, samplerName1, width1, height1,
+                            channel1, dimensions1, interpolation1);
+
+    const char * textureName2 = nullptr;
+    const char * samplerName2 = nullptr;
+    unsigned width2 = 0, height2 = 0;
+    OCIO::GpuShaderDesc::TextureType channel2 = OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL;
+    OCIO::GpuShaderDesc::TextureDimensions dimensions2 = OCIO::GpuShaderDesc::TEXTURE_1D;
+    OCIO::Interpolation interpolation2 = OCIO::INTERP_UNKNOWN;
+    shaderDesc2->getTexture(0, textureName2, samplerName2, width2, height2,
+                            channel2, dimensions2, interpolation2);
+
+    OCIO_CHECK_EQUAL(std::string(textureName1), std::string(textureName2));
+    OCIO_CHECK_EQUAL(std::string(samplerName1), std::string(samplerName2));
+    OCIO_CHECK_EQUAL(width1, width2);
+    OCIO_CHECK_EQUAL(height1, height2);
+    OCIO_CHECK_EQUAL(channel1, channel2);
+    OCIO_CHECK_EQUAL(dimensions1, dimensions2);
+    OCIO_CHECK_EQUAL(interpolation1, interpolation2);
+
+    // The texture values are shared.
+
+    const float * values1 = nullptr;
+    const float * values2 = nullptr;
+    shaderDesc1->getTextureValues(0, values1);
+    shaderDesc2->getTextureValues(0, values2);
+    OCIO_CHECK_EQUAL(values1, values2);
+
+    shaderDesc1->get3DTextureValues(0, values1);
+    shaderDesc2->get3DTextureValues(0, values2);
+    OCIO_CHECK_EQUAL(values1, values2);
+
+    // The shader description parameters are part of the key.
+
+    OCIO::GpuShaderDescRcPtr shaderDesc3 = CreateShaderDesc("OtherMain");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc3));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 2);
+    OCIO_CHECK_NE(std::string(shaderDesc1->getShaderText()),
+                  std::string(shaderDesc3->getShaderText()));
+
+    OCIO::GpuShaderDescRcPtr shaderDesc4 = CreateShaderDesc("OCIOMain");
+    shaderDesc4->setAllowTexture1D(false);
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc4));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+    OCIO_REQUIRE_EQUAL(shaderDesc4->getNumTextures(), 1);
+
+    const char * textureName4 = nullptr;
+    const char * samplerName4 = nullptr;
+    unsigned width4 = 0, height4 = 0;
+    OCIO::GpuShaderDesc::TextureType channel4 = OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL;
+    OCIO::GpuShaderDesc::TextureDimensions dimensions4 = OCIO::GpuShaderDesc::TEXTURE_1D;
+    OCIO::Interpolation interpolation4 = OCIO::INTERP_UNKNOWN;
+    shaderDesc4->getTexture(0, textureName4, samplerName4, width4, height4,
+                            channel4, dimensions4, interpolation4);
+    OCIO_CHECK_EQUAL(dimensions4, OCIO::GpuShaderDesc::TEXTURE_2D);
+
+    // A shader description already containing a shader program does not use the cache.
+
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc2));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 1);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 3);
+    OCIO_CHECK_EQUAL(shaderDesc2->getNumTextures(), 2);
+
+    // The processors with dynamic properties do not use the cache.
+
+    OCIO::ConstGPUProcessorRcPtr dynamicGpu = BuildGPUProcessor(true);
+
+    OCIO::GpuShaderDescRcPtr shaderDesc5 = CreateShaderDesc("OCIOMain");
+    OCIO_CHECK_NO_THROW(dynamicGpu->extractGpuShaderInfo(shaderDesc5));
+    OCIO::GpuShaderDescRcPtr shaderDesc6 = CreateShaderDesc("OCIOMain");
+    OCIO_CHECK_NO_THROW(dynamicGpu->extractGpuShaderInfo(shaderDesc6));
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 3);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 3);
+
+    OCIO_CHECK_EQUAL(shaderDesc5->getNumUniforms(), 1);
+    OCIO_CHECK_EQUAL(shaderDesc6->getNumUniforms(), 1);
+    OCIO_CHECK_NE(shaderDesc5->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE).get(),
+                  shaderDesc6->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE).get());
+
+    // Limit the cache.
+
+    OCIO::SetGpuShaderCacheCapacity(1, 0);
+
+    stats = OCIO::GetGpuShaderCacheStatistics();
+    OCIO_CHECK_EQUAL(stats.m_maxEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats.m_numEvictions, 2);
+
+    // The evicted entries are still valid in the shader descriptions.
+    shaderDesc1->getTextureValues(0, values1);
+    OCIO_CHECK_EQUAL(values1[1023 * 3], 1.f);
+
+    OCIO::SetGpuShaderCacheCapacity(OCIO::ShaderCache::MaxEntries, OCIO::ShaderCache::MaxBytes);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetGpuShaderCacheStatistics().m_numEntries, 0);
+}
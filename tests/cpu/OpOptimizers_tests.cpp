@@ -1683,3 +1683,205 @@ OCIO_ADD_TEST(OpOptimizers, replace_ops)
     oData = o->data();
     OCIO_CHECK_EQUAL(oData->getType(), OCIO::OpData::CDLType);
 }
+
+OCIO_ADD_TEST(OpOptimizers, bake_expensive_ops)
+{
+    // The ACES 2 Output Transform (i.e. Rec.709 100 nits) is expensive enough to be baked.
+    const OCIO::FixedFunctionOpData::Params params = {
+        100., 0.64, 0.33, 0.3, 0.6, 0.15, 0.06, 0.3127, 0.329
+    };
+    auto ot = std::make_shared<OCIO::FixedFunctionOpData>(
+        OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD, params);
+
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(0, 0.9);
+    matrix->setArrayValue(1, 0.1);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO::OpRcPtrVec optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimize(AllBut(OCIO::OPTIMIZATION_BAKE_EXPENSIVE_OPS)));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 2);
+    OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(optOps[1]->getInfo(), "<FixedFunctionOp>");
+
+    // The whole chain is replaced by a log shaper and a 3D LUT.
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimize(OCIO::OPTIMIZATION_DRAFT));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 2);
+    OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<LogOp>");
+    OCIO_CHECK_EQUAL(optOps[1]->getInfo(), "<Lut3DOp>");
+
+    OCIO::ConstOpRcPtr op1 = optOps[1];
+    auto lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(op1->data());
+    OCIO_REQUIRE_ASSERT(lut);
+    OCIO_CHECK_EQUAL(lut->getGridSize(), (long)OCIO::BAKE_LUT3D_GRID_SIZE);
+
+    // Scene-linear values.
+    const std::vector<float> img = {
+        0.18f,   0.18f,   0.18f,  1.f,
+        0.005f,  0.01f,   0.008f, 0.5f,
+        0.5f,    0.3f,    0.2f,   0.f,
+        1.f,     1.f,     1.f,    1.f,
+        4.f,     3.5f,    2.5f,   1.f,
+        30.f,    25.f,    28.f,   1.f,
+        0.001f,  0.002f,  0.f,    1.f };
+
+    const long numPixels = (long)img.size() / 4;
+
+    std::vector<float> ref = img;
+    for (const auto & op : ops)
+    {
+        op->apply(&ref[0], &ref[0], numPixels);
+    }
+
+    std::vector<float> res = img;
+    for (const auto & op : optOps)
+    {
+        op->apply(&res[0], &res[0], numPixels);
+    }
+
+    // Note that the baking is lossy.
+    for (size_t idx = 0; idx < img.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], ref[idx], 5e-3f);
+    }
+}
+
+OCIO_ADD_TEST(OpOptimizers, bake_expensive_ops_boundaries)
+{
+    const OCIO::FixedFunctionOpData::Params params = {
+        100., 0.64, 0.33, 0.3, 0.6, 0.15, 0.06, 0.3127, 0.329
+    };
+
+    // A leading clamp to [0, 1] is kept and replaces the shaper.
+    {
+        auto range = std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.);
+        auto ot = std::make_shared<OCIO::FixedFunctionOpData>(
+            OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV, params);
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, range, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(ops.finalize());
+        OCIO_CHECK_NO_THROW(ops.optimize(OCIO::OPTIMIZATION_DRAFT));
+
+        OCIO_REQUIRE_EQUAL(ops.size(), 2);
+        OCIO_CHECK_EQUAL(ops[0]->getInfo(), "<RangeOp>");
+        OCIO_CHECK_EQUAL(ops[1]->getInfo(), "<Lut3DOp>");
+    }
+
+    // Ops with dynamic properties and ops ending in a non RGB-like color space (i.e. the hue
+    // would be interpolated) are not baked.
+    {
+        auto ot = std::make_shared<OCIO::FixedFunctionOpData>(
+            OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD, params);
+
+        auto toJMh = std::make_shared<OCIO::FixedFunctionOpData>(
+            OCIO::FixedFunctionOpData::ACES_RGB_TO_JMh_20,
+            OCIO::FixedFunctionOpData::Params{ 0.64, 0.33, 0.3, 0.6, 0.15, 0.06, 0.3127, 0.329 });
+
+        auto exposure = std::make_shared<OCIO::ExposureContrastOpData>();
+        exposure->getExposureProperty()->makeDynamic();
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateExposureContrastOp(ops, exposure,
+                                                           OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, toJMh, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(ops.finalize());
+        OCIO_CHECK_NO_THROW(ops.optimize(AllBut(OCIO::OPTIMIZATION_NO_DYNAMIC_PROPERTIES)));
+
+        OCIO_REQUIRE_EQUAL(ops.size(), 6);
+        OCIO_CHECK_EQUAL(ops[0]->getInfo(), "<LogOp>");
+        OCIO_CHECK_EQUAL(ops[1]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(ops[2]->getInfo(), "<ExposureContrastOp>");
+        OCIO_CHECK_EQUAL(ops[3]->getInfo(), "<LogOp>");
+        OCIO_CHECK_EQUAL(ops[4]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(ops[5]->getInfo(), "<FixedFunctionOp>");
+    }
+
+    // Ops changing the alpha channel are not baked as the 3D LUT preserves it.
+    {
+        auto ot = std::make_shared<OCIO::FixedFunctionOpData>(
+            OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD, params);
+
+        const double exp4[4]{ 1., 1., 1., 2. };
+        auto exponent = std::make_shared<OCIO::ExponentOpData>(exp4);
+
+        auto gamma = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::BASIC_FWD,
+                                                         OCIO::GammaOpData::Params{ 1. },
+                                                         OCIO::GammaOpData::Params{ 1. },
+                                                         OCIO::GammaOpData::Params{ 1. },
+                                                         OCIO::GammaOpData::Params{ 2.2 });
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exponent, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_INVERSE));
+        OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(ops, ot, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(ops.finalize());
+
+        const std::vector<float> img = {
+            0.18f,  0.18f, 0.18f, 0.5f,
+            0.5f,   0.3f,  0.2f,  0.25f,
+            4.f,    3.5f,  2.5f,  1.f };
+        const long numPixels = (long)img.size() / 4;
+
+        std::vector<float> ref = img;
+        for (const auto & op : ops)
+        {
+            op->apply(&ref[0], &ref[0], numPixels);
+        }
+
+        OCIO_CHECK_NO_THROW(ops.optimize(OCIO::OPTIMIZATION_DRAFT));
+
+        OCIO_REQUIRE_EQUAL(ops.size(), 8);
+        OCIO_CHECK_EQUAL(ops[0]->getInfo(), "<LogOp>");
+        OCIO_CHECK_EQUAL(ops[1]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(ops[2]->getInfo(), "<ExponentOp>");
+        OCIO_CHECK_EQUAL(ops[3]->getInfo(), "<LogOp>");
+        OCIO_CHECK_EQUAL(ops[4]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(ops[5]->getInfo(), "<GammaOp>");
+        OCIO_CHECK_EQUAL(ops[6]->getInfo(), "<LogOp>");
+        OCIO_CHECK_EQUAL(ops[7]->getInfo(), "<Lut3DOp>");
+
+        std::vector<float> res = img;
+        for (const auto & op : ops)
+        {
+            op->apply(&res[0], &res[0], numPixels);
+        }
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_CLOSE(res[4 * idx + 3], ref[4 * idx + 3], 1e-6f);
+        }
+    }
+
+    // Cheap ops are not baked.
+    {
+        OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+        matrix->setArrayValue(1, 0.1);
+
+        auto gamma = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::BASIC_FWD,
+                                                         OCIO::GammaOpData::Params{ 2.2 },
+                                                         OCIO::GammaOpData::Params{ 2.2 },
+                                                         OCIO::GammaOpData::Params{ 2.2 },
+                                                         OCIO::GammaOpData::Params{ 1. });
+
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(ops.finalize());
+        OCIO_CHECK_NO_THROW(ops.optimize(OCIO::OPTIMIZATION_DRAFT));
+
+        OCIO_REQUIRE_EQUAL(ops.size(), 2);
+        OCIO_CHECK_EQUAL(ops[0]->getInfo(), "<MatrixOffsetOp>");
+        OCIO_CHECK_EQUAL(ops[1]->getInfo(), "<GammaOp>");
+    }
+}
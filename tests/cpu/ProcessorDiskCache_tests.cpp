@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <filesystem>
+#include <fstream>
+
+#include "ProcessorDiskCache.cpp"
+
+#include "ops/exposurecontrast/ExposureContrastOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "OpBuilders.h"
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Restore the on-disk processor cache directory at the end of a test.
+struct DiskCacheDirectoryGuard
+{
+    explicit DiskCacheDirectoryGuard(const std::string & dirname)
+        : m_previous(OCIO::GetProcessorDiskCacheDirectory())
+    {
+        OCIO::SetProcessorDiskCacheDirectory(dirname.c_str());
+    }
+    ~DiskCacheDirectoryGuard()
+    {
+        OCIO::SetProcessorDiskCacheDirectory(m_previous.c_str());
+    }
+
+    std::string m_previous;
+};
+
+OCIO::GroupTransformRcPtr CreateTestTransform()
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto mat = OCIO::MatrixTransform::Create();
+    const double offset[4]{ 0.1, 0.2, 0.3, 0. };
+    mat->setOffset(offset);
+    group->appendTransform(mat);
+
+    auto exp = OCIO::ExponentTransform::Create();
+    const double gamma[4]{ 2.2, 2.2, 2.2, 1. };
+    exp->setValue(gamma);
+    group->appendTransform(exp);
+
+    auto lut = OCIO::Lut1DTransform::Create(1024, false);
+    for (unsigned long i = 0; i < 1024; ++i)
+    {
+        const float v = float(i) / 1023.f;
+        lut->setValue(i, v * v, v, std::sqrt(v));
+    }
+    group->appendTransform(lut);
+
+    return group;
+}
+
+// Build the ops the same way the processor does to compute the expected cache filename.
+std::string GetCacheFilename(const OCIO::ConstConfigRcPtr & config,
+                             const OCIO::ConstTransformRcPtr & transform,
+                             const std::string & dirname,
+                             OCIO::OptimizationFlags oFlags)
+{
+    OCIO::OpRcPtrVec ops;
+    OCIO::BuildOps(ops, *config, config->getCurrentContext(), transform,
+                   OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+    const std::string key = OCIO::GetProcessorDiskCacheKey(ops,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           oFlags);
+    return pystring::os::path::join(dirname, key + ".ociob");
+}
+
+bool FileExists(const std::string & filename)
+{
+    std::ifstream f = OCIO::Platform::CreateInputFileStream(filename.c_str(), std::ios_base::in);
+    return f.good();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ProcessorDiskCache, directory)
+{
+    DiskCacheDirectoryGuard guard("");
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetProcessorDiskCacheDirectory()), "");
+
+    OCIO::SetProcessorDiskCacheDirectory("/some/dir");
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetProcessorDiskCacheDirectory()), "/some/dir");
+
+    OCIO::SetProcessorDiskCacheDirectory(nullptr);
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetProcessorDiskCacheDirectory()), "");
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, key)
+{
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_EQUAL(OCIO::GetProcessorDiskCacheKey(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_DEFAULT), "");
+
+    const double offset[4]{ 0.1, 0.2, 0.3, 0. };
+    OCIO::CreateOffsetOp(ops, offset, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    const std::string key = OCIO::GetProcessorDiskCacheKey(ops,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::OPTIMIZATION_DEFAULT);
+    OCIO_CHECK_ASSERT(!key.empty());
+
+    // The bit-depths and the optimization flags are part of the key.
+    OCIO_CHECK_NE(key, OCIO::GetProcessorDiskCacheKey(ops,
+                                                      OCIO::BIT_DEPTH_UINT8,
+                                                      OCIO::BIT_DEPTH_F32,
+                                                      OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_NE(key, OCIO::GetProcessorDiskCacheKey(ops,
+                                                      OCIO::BIT_DEPTH_F32,
+                                                      OCIO::BIT_DEPTH_F32,
+                                                      OCIO::OPTIMIZATION_NONE));
+
+    // Ops with dynamic properties are never cached to disk.
+    auto ec = std::make_shared<OCIO::ExposureContrastOpData>();
+    ec->getExposureProperty()->makeDynamic();
+    OCIO::CreateExposureContrastOp(ops, ec, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+    OCIO_CHECK_EQUAL(OCIO::GetProcessorDiskCacheKey(ops, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_DEFAULT), "");
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, save_and_load)
+{
+    const std::string dirname = OCIO::CreateTemporaryDirectory("ProcessorDiskCache");
+    DiskCacheDirectoryGuard guard(dirname);
+
+    const OCIO::OptimizationFlags oFlags = OCIO::OPTIMIZATION_DEFAULT;
+
+    float src[12]{ 0.0f,  0.1f, 0.2f, 1.0f,
+                   0.5f,  0.6f, 0.7f, 0.5f,
+                   1.2f, -0.1f, 0.9f, 0.0f };
+
+    // The first processor optimizes the ops and saves them.
+
+    float ref[12];
+    std::string filename;
+    {
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        OCIO::ConstTransformRcPtr transform = CreateTestTransform();
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(transform);
+
+        filename = GetCacheFilename(config, transform, dirname, oFlags);
+        OCIO_CHECK_ASSERT(!FileExists(filename));
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(oFlags));
+        OCIO_CHECK_ASSERT(FileExists(filename));
+
+        OCIO::PackedImageDesc desc(src, 3, 1, 4);
+        std::copy(src, src + 12, ref);
+        OCIO::PackedImageDesc refDesc(ref, 3, 1, 4);
+        cpu->apply(desc, refDesc);
+    }
+
+    // A new config (i.e. an empty in-memory processor cache) loads the optimized ops from disk.
+    {
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(CreateTestTransform());
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(oFlags));
+
+        float dst[12];
+        OCIO::PackedImageDesc desc(src, 3, 1, 4);
+        OCIO::PackedImageDesc dstDesc(dst, 3, 1, 4);
+        cpu->apply(desc, dstDesc);
+
+        for (size_t i = 0; i < 12; ++i)
+        {
+            OCIO_CHECK_EQUAL(dst[i], ref[i]);
+        }
+    }
+
+    // Check that the file really is the source of the ops by replacing its content.
+    {
+        OCIO::OpRcPtrVec ops;
+        const double scale[4]{ 2., 2., 2., 1. };
+        OCIO::CreateScaleOp(ops, scale, OCIO::TRANSFORM_DIR_FORWARD);
+        ops.finalize();
+
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::binary);
+        OCIO::WriteOpsToBinary(ops, ostream);
+        ostream.close();
+
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(CreateTestTransform());
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(oFlags));
+
+        float dst[12];
+        OCIO::PackedImageDesc desc(src, 3, 1, 4);
+        OCIO::PackedImageDesc dstDesc(dst, 3, 1, 4);
+        cpu->apply(desc, dstDesc);
+
+        OCIO_CHECK_EQUAL(dst[0], 0.0f);
+        OCIO_CHECK_EQUAL(dst[1], 0.2f);
+        OCIO_CHECK_EQUAL(dst[2], 0.4f);
+        OCIO_CHECK_EQUAL(dst[3], 1.0f);
+    }
+
+    // An invalid file is ignored.
+    {
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::trunc);
+        ostream << "OCIOBOPS";
+        ostream.close();
+
+        OCIO::ConfigRcPtr config = OCIO::Config::Create();
+        OCIO::ConstProcessorRcPtr proc = config->getProcessor(CreateTestTransform());
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(oFlags));
+
+        float dst[12];
+        OCIO::PackedImageDesc desc(src, 3, 1, 4);
+        OCIO::PackedImageDesc dstDesc(dst, 3, 1, 4);
+        cpu->apply(desc, dstDesc);
+
+        for (size_t i = 0; i < 12; ++i)
+        {
+            OCIO_CHECK_EQUAL(dst[i], ref[i]);
+        }
+    }
+
+    OCIO::RemoveTemporaryDirectory(dirname);
+}
+
+OCIO_ADD_TEST(ProcessorDiskCache, patched_processor)
+{
+    const std::string dirname = OCIO::CreateTemporaryDirectory("ProcessorDiskCachePatch");
+    DiskCacheDirectoryGuard guard(dirname);
+
+    const OCIO::OptimizationFlags oFlags = OCIO::OPTIMIZATION_DEFAULT;
+
+    auto NumCacheFiles = [&dirname]()
+    {
+        size_t numFiles = 0;
+        for (const auto & entry : std::filesystem::directory_iterator(dirname))
+        {
+            numFiles += entry.is_regular_file() ? 1 : 0;
+        }
+        return numFiles;
+    };
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(CreateTestTransform());
+    OCIO_REQUIRE_EQUAL(proc->getNumTransforms(), 3);
+
+    OCIO_CHECK_NO_THROW(proc->getOptimizedCPUProcessor(oFlags));
+    OCIO_CHECK_EQUAL(NumCacheFiles(), 1);
+
+    // Interactive edits of the first transform only save the ops after it, once.
+    for (int i = 1; i <= 4; ++i)
+    {
+        auto mat = OCIO::MatrixTransform::Create();
+        const double offset[4]{ 0.01 * i, 0., 0., 0. };
+        mat->setOffset(offset);
+
+        OCIO::ConstProcessorRcPtr patched;
+        OCIO_CHECK_NO_THROW(patched = proc->createPatchedProcessor(0, mat));
+        OCIO_CHECK_NO_THROW(patched->getOptimizedCPUProcessor(oFlags));
+        OCIO_CHECK_NO_THROW(patched->getOptimizedProcessor(oFlags));
+
+        OCIO_CHECK_ASSERT(!FileExists(GetCacheFilename(OCIO::Config::CreateRaw(), mat,
+                                                       dirname, oFlags)));
+        OCIO_CHECK_EQUAL(NumCacheFiles(), 2);
+    }
+
+    OCIO::RemoveTemporaryDirectory(dirname);
+}
@@ -519,3 +519,252 @@ OCIO_ADD_TEST(Processor, cache_gpu_processors)
     OCIO_CHECK_EQUAL(proc1->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_DEFAULT).get(),
                      proc1->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_DEFAULT).get());
 }
+
+namespace OCIO_NAMESPACE
+{
+
+class CPUProcessorTestAccess
+{
+public:
+    static ConstOpCPURcPtrVec GetCPUOps(const ConstCPUProcessorRcPtr & cpu)
+    {
+        return cpu->getImpl()->getCPUOps();
+    }
+};
+
+} // namespace OCIO_NAMESPACE
+
+namespace
+{
+
+OCIO::GroupTransformRcPtr BuildPatchTestGroup(const OCIO::ConstTransformRcPtr & grading,
+                                              const OCIO::ConstTransformRcPtr & last = nullptr)
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] { 1.8, 2.0, 2.2, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    auto lut = OCIO::Lut3DTransform::Create(5);
+    for (unsigned long r = 0; r < 5; ++r)
+    {
+        for (unsigned long g = 0; g < 5; ++g)
+        {
+            for (unsigned long b = 0; b < 5; ++b)
+            {
+                lut->setValue(r, g, b, 0.25f * float(g), 0.25f * float(b), 0.0625f * float(r * r));
+            }
+        }
+    }
+    group->appendTransform(lut);
+
+    group->appendTransform(grading->createEditableCopy());
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+    group->appendTransform(ec);
+
+    if (last)
+    {
+        group->appendTransform(last->createEditableCopy());
+    }
+    else
+    {
+        auto matrix = OCIO::MatrixTransform::Create();
+        const double offset[4] { 0.01, 0.02, 0.03, 0. };
+        matrix->setOffset(offset);
+        group->appendTransform(matrix);
+    }
+
+    return group;
+}
+
+OCIO::ConstTransformRcPtr BuildPatchTestGrading(double brightness)
+{
+    auto grading = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    OCIO::GradingPrimary values(OCIO::GRADING_LOG);
+    values.m_brightness = OCIO::GradingRGBM(brightness, 0., -brightness, 0.);
+    values.m_saturation = 1.2;
+    grading->setValue(values);
+    return grading;
+}
+
+void CheckPatchedProcessor(const OCIO::ConstProcessorRcPtr & patched,
+                           const OCIO::ConstProcessorRcPtr & expected,
+                           OCIO::BitDepth inBitDepth,
+                           OCIO::BitDepth outBitDepth,
+                           unsigned lineNo)
+{
+    OCIO::ConstCPUProcessorRcPtr patchedCPU
+        = patched->getOptimizedCPUProcessor(inBitDepth, outBitDepth, OCIO::OPTIMIZATION_DEFAULT);
+    OCIO::ConstCPUProcessorRcPtr expectedCPU
+        = expected->getOptimizedCPUProcessor(inBitDepth, outBitDepth, OCIO::OPTIMIZATION_DEFAULT);
+
+    const float srcValues[] = {  0.0f,  0.0f,  0.0f, 1.0f,
+                                 0.18f, 0.18f, 0.18f, 0.5f,
+                                 0.9f,  0.2f,  0.05f, 0.0f,
+                                 0.3f,  0.6f,  0.95f, 1.0f };
+
+    std::vector<float> patchedValues(srcValues, srcValues + 16);
+    std::vector<float> expectedValues(srcValues, srcValues + 16);
+
+    if (inBitDepth == OCIO::BIT_DEPTH_F32 && outBitDepth == OCIO::BIT_DEPTH_F32)
+    {
+        OCIO::PackedImageDesc patchedDesc(patchedValues.data(), 4, 1, 4);
+        patchedCPU->apply(patchedDesc);
+        OCIO::PackedImageDesc expectedDesc(expectedValues.data(), 4, 1, 4);
+        expectedCPU->apply(expectedDesc);
+
+        for (size_t idx = 0; idx < patchedValues.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE_FROM(patchedValues[idx], expectedValues[idx], 1e-5f, lineNo);
+        }
+    }
+    else
+    {
+        // Processing from 8-bit to 16-bit integer values.
+        uint8_t srcInt[16];
+        for (size_t idx = 0; idx < 16; ++idx)
+        {
+            srcInt[idx] = uint8_t(srcValues[idx] * 255.f + 0.5f);
+        }
+
+        uint16_t patchedInt[16];
+        uint16_t expectedInt[16];
+
+        OCIO::PackedImageDesc srcDesc(srcInt, 4, 1, 4, OCIO::BIT_DEPTH_UINT8,
+                                      1, 4, 16);
+        OCIO::PackedImageDesc patchedDesc(patchedInt, 4, 1, 4, OCIO::BIT_DEPTH_UINT16,
+                                          2, 8, 32);
+        OCIO::PackedImageDesc expectedDesc(expectedInt, 4, 1, 4, OCIO::BIT_DEPTH_UINT16,
+                                           2, 8, 32);
+
+        patchedCPU->apply(srcDesc, patchedDesc);
+        expectedCPU->apply(srcDesc, expectedDesc);
+
+        for (size_t idx = 0; idx < 16; ++idx)
+        {
+            OCIO_CHECK_CLOSE_FROM(float(patchedInt[idx]), float(expectedInt[idx]), 1.f, lineNo);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(Processor, patched_processor)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::ConstProcessorRcPtr proc
+        = config->getProcessor(BuildPatchTestGroup(BuildPatchTestGrading(0.)));
+    OCIO_REQUIRE_EQUAL(proc->getNumTransforms(), 5);
+
+    // Replace the grading transform.
+
+    OCIO::ConstProcessorRcPtr patched1;
+    OCIO_CHECK_NO_THROW(patched1 = proc->createPatchedProcessor(2, BuildPatchTestGrading(0.1)));
+    OCIO_REQUIRE_ASSERT(patched1);
+    OCIO_CHECK_NE(patched1.get(), proc.get());
+    OCIO_CHECK_EQUAL(patched1->getNumTransforms(), 5);
+    OCIO_CHECK_NE(std::string(patched1->getCacheID()), std::string(proc->getCacheID()));
+
+    OCIO::ConstProcessorRcPtr expected1
+        = config->getProcessor(BuildPatchTestGroup(BuildPatchTestGrading(0.1)));
+    OCIO_CHECK_EQUAL(std::string(patched1->getCacheID()), std::string(expected1->getCacheID()));
+
+    CheckPatchedProcessor(patched1, expected1, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, __LINE__);
+    CheckPatchedProcessor(patched1, expected1, OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16,
+                          __LINE__);
+
+    // Patching again the patched transform reuses the work done on the other ops.
+
+    OCIO::ConstProcessorRcPtr patched2;
+    OCIO_CHECK_NO_THROW(patched2 = patched1->createPatchedProcessor(2,
+                                                                    BuildPatchTestGrading(-0.1)));
+    OCIO::ConstProcessorRcPtr expected2
+        = config->getProcessor(BuildPatchTestGroup(BuildPatchTestGrading(-0.1)));
+
+    CheckPatchedProcessor(patched2, expected2, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, __LINE__);
+    CheckPatchedProcessor(patched2, expected2, OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16,
+                          __LINE__);
+
+    // The original processors are not modified.
+
+    CheckPatchedProcessor(patched1, expected1, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, __LINE__);
+    CheckPatchedProcessor(proc,
+                          config->getProcessor(BuildPatchTestGroup(BuildPatchTestGrading(0.))),
+                          OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, __LINE__);
+
+    // Patching another transform, the transform could also create several ops.
+
+    auto group = OCIO::GroupTransform::Create();
+    auto matrix = OCIO::MatrixTransform::Create();
+    const double offset[4] { -0.01, 0.0, 0.01, 0. };
+    matrix->setOffset(offset);
+    group->appendTransform(matrix);
+    auto range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.);
+    range->setMinOutValue(0.);
+    group->appendTransform(range);
+
+    OCIO::ConstProcessorRcPtr patched3;
+    OCIO_CHECK_NO_THROW(patched3 = patched2->createPatchedProcessor(4, group));
+    OCIO_CHECK_EQUAL(patched3->getNumTransforms(), 6);
+
+    OCIO::ConstProcessorRcPtr expected3
+        = config->getProcessor(BuildPatchTestGroup(BuildPatchTestGrading(-0.1), group));
+
+    CheckPatchedProcessor(patched3, expected3, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, __LINE__);
+
+    // The CPU ops of the prefix and suffix ops are shared by the patched processors, except the
+    // dynamic ones as their properties are decoupled.
+
+    {
+        const OCIO::ConstOpCPURcPtrVec cpuOps1
+            = OCIO::CPUProcessorTestAccess::GetCPUOps(patched1->getDefaultCPUProcessor());
+        const OCIO::ConstOpCPURcPtrVec cpuOps2
+            = OCIO::CPUProcessorTestAccess::GetCPUOps(patched2->getDefaultCPUProcessor());
+        OCIO_REQUIRE_EQUAL(cpuOps1.size(), 5);
+        OCIO_REQUIRE_EQUAL(cpuOps2.size(), 5);
+
+        OCIO_CHECK_EQUAL(cpuOps1[0].get(), cpuOps2[0].get()); // Exponent.
+        OCIO_CHECK_EQUAL(cpuOps1[1].get(), cpuOps2[1].get()); // Lut3D.
+        OCIO_CHECK_NE(cpuOps1[2].get(), cpuOps2[2].get());    // The patched grading.
+        OCIO_CHECK_NE(cpuOps1[3].get(), cpuOps2[3].get());    // The dynamic exposure.
+        OCIO_CHECK_EQUAL(cpuOps1[4].get(), cpuOps2[4].get()); // Matrix.
+    }
+
+    // The dynamic properties of the CPU processors are still decoupled.
+
+    OCIO::ConstCPUProcessorRcPtr cpu1 = patched1->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr cpu2 = patched2->getDefaultCPUProcessor();
+
+    OCIO::DynamicPropertyRcPtr prop1
+        = cpu1->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO::DynamicPropertyRcPtr prop2
+        = cpu2->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO_CHECK_NE(prop1.get(), prop2.get());
+
+    OCIO::DynamicPropertyDoubleRcPtr exposure = OCIO::DynamicPropertyValue::AsDouble(prop1);
+    exposure->setValue(1.5);
+    OCIO_CHECK_EQUAL(OCIO::DynamicPropertyValue::AsDouble(prop2)->getValue(), 0.5);
+
+    // Faulty cases.
+
+    OCIO_CHECK_THROW_WHAT(proc->createPatchedProcessor(-1, matrix),
+                          OCIO::Exception,
+                          "Processor patch: invalid transform index -1, the processor has 5 "
+                          "transforms.");
+    OCIO_CHECK_THROW_WHAT(proc->createPatchedProcessor(5, matrix),
+                          OCIO::Exception,
+                          "invalid transform index 5");
+    OCIO_CHECK_THROW_WHAT(proc->createPatchedProcessor(0, OCIO::ConstTransformRcPtr()),
+                          OCIO::Exception,
+                          "Processor patch: the transform is null.");
+    OCIO_CHECK_THROW_WHAT(proc->createPatchedProcessor(0, OCIO::ColorSpaceTransform::Create()),
+                          OCIO::Exception,
+                          "ColorSpaceTransform: empty source color space name");
+}
@@ -73,6 +73,7 @@ OCIO_ADD_TEST_AVX2(packed_uint16_to_f32_test)
 #endif
 OCIO_ADD_TEST_AVX2(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX2(packed_all_test)
+OCIO_ADD_TEST_AVX2(log2_exp2_power_test)
 
 #endif
 
@@ -96,5 +97,6 @@ OCIO_ADD_TEST_AVX512(packed_uint16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_f16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX512(packed_all_test)
+OCIO_ADD_TEST_AVX512(log2_exp2_power_test)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+
+#include "ThreadUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadUtils, get_num_threads)
+{
+    OCIO_CHECK_GE(OCIO::GetNumThreads(0), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(1), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(7), 7u);
+}
+
+OCIO_ADD_TEST(ThreadUtils, get_num_threads_for_items)
+{
+    const unsigned maxThreads = OCIO::GetNumThreads(0);
+
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreadsForItems(0, 100), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreadsForItems(199, 100), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreadsForItems(200, 100), std::min(maxThreads, 2u));
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreadsForItems(100000, 100), std::min(maxThreads, 1000u));
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreadsForItems(10, 0), std::min(maxThreads, 10u));
+}
+
+OCIO_ADD_TEST(ThreadUtils, parallel_for)
+{
+    // Each item must be processed exactly once whatever the number of threads.
+
+    for (unsigned numThreads : { 0u, 1u, 2u, 3u, 8u, 64u })
+    {
+        for (long numItems : { 0L, 1L, 5L, 8L, 100L })
+        {
+            std::vector<std::atomic<int>> counts(numItems);
+            for (auto & count : counts)
+            {
+                count = 0;
+            }
+
+            OCIO_CHECK_NO_THROW(OCIO::ParallelFor(numThreads, numItems, [&counts](long begin, long end)
+            {
+                for (long idx = begin; idx < end; ++idx)
+                {
+                    ++counts[idx];
+                }
+            }));
+
+            for (const auto & count : counts)
+            {
+                OCIO_CHECK_EQUAL(count.load(), 1);
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(ThreadUtils, parallel_for_exception)
+{
+    // An exception thrown by a worker thread is propagated to the calling thread.
+
+    OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(4, 100, [](long begin, long /*end*/)
+                          {
+                              if (begin != 0)
+                              {
+                                  throw OCIO::Exception("Worker failure.");
+                              }
+                          }),
+                          OCIO::Exception,
+                          "Worker failure.");
+}
@@ -2,8 +2,11 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <sstream>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "Logging.h"
 #include "OpBuilders.h"
 #include "UnitTestUtils.h"
@@ -189,4 +192,85 @@ void RemoveTemporaryDirectory(const std::string & sDirectoryPath)
 
 }
 
+void ForEachCPUInstructionSet(const std::function<void(const std::string & name)> & testFunc)
+{
+    CPUInfo & cpu = CPUInfo::instance();
+    const unsigned int flags = cpu.flags;
+
+    const unsigned int sseFlags = X86_CPU_FLAG_SSE2 | X86_CPU_FLAG_SSE2_SLOW
+                                  | X86_CPU_FLAG_SSE3 | X86_CPU_FLAG_SSE3_SLOW
+                                  | X86_CPU_FLAG_SSSE3 | X86_CPU_FLAG_SSSE3_SLOW
+                                  | X86_CPU_FLAG_SSE4 | X86_CPU_FLAG_SSE42;
+
+    struct InstructionSet
+    {
+        std::string m_name;
+        unsigned int m_flags;
+        bool m_supported;
+    };
+
+    const InstructionSet instructionSets[] = {
+        { cpu.hasSSE2() ? "SSE2" : "scalar", flags & sseFlags, true },
+        { "AVX2", flags & ~X86_CPU_FLAG_AVX512, cpu.hasAVX2() },
+        { "AVX512", flags, cpu.hasAVX512() }
+    };
+
+    // Restore the CPU flags even if the test function throws.
+    struct FlagsGuard
+    {
+        ~FlagsGuard() { m_cpu.flags = m_flags; }
+        CPUInfo & m_cpu;
+        const unsigned int m_flags;
+    } guard{ cpu, flags };
+
+    for (const auto & instructionSet : instructionSets)
+    {
+        if (instructionSet.m_supported)
+        {
+            cpu.flags = instructionSet.m_flags;
+            testFunc(instructionSet.m_name);
+        }
+    }
+}
+
+std::string CompareCPUInstructionSets(const std::function<ConstOpCPURcPtr()> & createRenderer,
+                                      const std::vector<float> & rgbaImage,
+                                      float relError,
+                                      float minExpected)
+{
+    const long numPixels = long(rgbaImage.size() / 4);
+
+    std::string baseName;
+    std::vector<float> baseImage;
+    std::string mismatch;
+
+    ForEachCPUInstructionSet([&](const std::string & name)
+    {
+        std::vector<float> image(rgbaImage.size());
+        createRenderer()->apply(rgbaImage.data(), image.data(), numPixels);
+
+        if (baseName.empty())
+        {
+            baseName  = name;
+            baseImage = image;
+            return;
+        }
+
+        for (size_t idx = 0; idx < image.size() && mismatch.empty(); ++idx)
+        {
+            if (!EqualWithSafeRelError(image[idx], baseImage[idx], relError, minExpected))
+            {
+                std::ostringstream oss;
+                oss.precision(9);
+                oss << name << " differs from " << baseName << " at index " << idx
+                    << " (input " << rgbaImage[idx] << "): "
+                    << image[idx] << " vs. " << baseImage[idx];
+                mismatch = oss.str();
+            }
+        }
+    });
+
+    return mismatch;
+}
+
 } // namespace OCIO_NAMESPACE
@@ -6,6 +6,8 @@
 
 
 #include <fstream>
+#include <functional>
+#include <vector>
 
 #ifdef __has_include
 # if __has_include(<version>)
@@ -150,6 +152,19 @@ std::string CreateTemporaryDirectory(const std::string & name);
  */
 void RemoveTemporaryDirectory(const std::string & directoryPath);
 
+// Calls the test function for each instruction set supported by the CPU, from the base one (i.e.
+// the SSE2 or scalar code) to the widest one. The CPUInfo flags are restricted accordingly so that
+// the CPU renderers created by the test function select the matching runtime-dispatched kernels.
+void ForEachCPUInstructionSet(const std::function<void(const std::string & name)> & testFunc);
+
+// Applies the CPU renderers created by createRenderer to the RGBA image for each instruction set
+// of ForEachCPUInstructionSet() and compares the results to the base instruction set ones using
+// EqualWithSafeRelError(). Returns an empty string if they all match, or the first mismatch.
+std::string CompareCPUInstructionSets(const std::function<ConstOpCPURcPtr()> & createRenderer,
+                                      const std::vector<float> & rgbaImage,
+                                      float relError,
+                                      float minExpected);
+
 }
 // namespace OCIO_NAMESPACE
 
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdio>
+#include <fstream>
+
+#include "fileformats/FileFormatBinaryOps.cpp"
+
+#include "ops/exposurecontrast/ExposureContrastOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(FileFormatBinaryOps, format_info)
+{
+    OCIO::FormatInfoVec formatInfoVec;
+    OCIO::LocalFileFormat tester;
+    tester.getFormatInfo(formatInfoVec);
+
+    OCIO_REQUIRE_EQUAL(1, formatInfoVec.size());
+    OCIO_CHECK_EQUAL(OCIO::FILEFORMAT_BINARY_OPS, formatInfoVec[0].name);
+    OCIO_CHECK_EQUAL("ociob", formatInfoVec[0].extension);
+    OCIO_CHECK_EQUAL(OCIO::FORMAT_CAPABILITY_READ | OCIO::FORMAT_CAPABILITY_WRITE,
+                     formatInfoVec[0].capabilities);
+    OCIO_CHECK_ASSERT(tester.isBinary());
+}
+
+namespace
+{
+
+OCIO::GroupTransformRcPtr CreateTestTransform()
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->getFormatMetadata().addAttribute(OCIO::METADATA_ID, "binary_test");
+    group->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, "A description");
+
+    auto mat = OCIO::MatrixTransform::Create();
+    const double m44[16]{ 0.9, 0.1, 0.0,  0.0,
+                          0.05, 0.9, 0.05, 0.0,
+                          0.0, 0.1, 0.9,  0.0,
+                          0.0, 0.0, 0.0,  1.0 };
+    const double offset[4]{ 0.01, 0.02, 0.03, 0. };
+    mat->setMatrix(m44);
+    mat->setOffset(offset);
+    mat->getFormatMetadata().setName("matrix");
+    group->appendTransform(mat);
+
+    auto lut1d = OCIO::Lut1DTransform::Create(65536, true);
+    for (unsigned long i = 0; i < 65536; ++i)
+    {
+        float r, g, b;
+        lut1d->getValue(i, r, g, b);
+        lut1d->setValue(i, r * 0.5f, g * 0.75f, b);
+    }
+    lut1d->setHueAdjust(OCIO::HUE_DW3);
+    group->appendTransform(lut1d);
+
+    auto log = OCIO::LogAffineTransform::Create();
+    log->setBase(10.);
+    const double linOffset[3]{ 0.1, 0.1, 0.1 };
+    log->setLinSideOffsetValue(linOffset);
+    group->appendTransform(log);
+
+    auto lut3d = OCIO::Lut3DTransform::Create(17);
+    for (unsigned long r = 0; r < 17; ++r)
+    {
+        for (unsigned long g = 0; g < 17; ++g)
+        {
+            for (unsigned long b = 0; b < 17; ++b)
+            {
+                lut3d->setValue(r, g, b, std::sqrt(r / 16.f), g / 16.f, (b / 16.f) * (r / 16.f));
+            }
+        }
+    }
+    lut3d->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    lut3d->getFormatMetadata().setID("lut3d");
+    group->appendTransform(lut3d);
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+    group->appendTransform(ec);
+
+    return group;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(FileFormatBinaryOps, round_trip)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::GroupTransformRcPtr group = CreateTestTransform();
+
+    std::ostringstream oss;
+    OCIO_CHECK_NO_THROW(group->write(config, OCIO::FILEFORMAT_BINARY_OPS, oss));
+
+    OCIO::OpRcPtrVec refOps;
+    OCIO::BuildGroupOps(refOps, *config, config->getCurrentContext(), *group,
+                        OCIO::TRANSFORM_DIR_FORWARD);
+    refOps.finalize();
+
+    std::istringstream iss(oss.str());
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::ReadOpsFromBinary(ops, iss, "memory"));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO_REQUIRE_EQUAL(ops.size(), refOps.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        // The LUT values and matrix coefficients are stored as-is so the cacheIDs are identical.
+        OCIO_CHECK_EQUAL(ops[i]->getCacheID(), refOps[i]->getCacheID());
+    }
+
+    OCIO::ConstOpRcPtr op = ops[0];
+    OCIO::ConstOpRcPtr refOp = refOps[0];
+    OCIO_CHECK_ASSERT(*op->data() == *refOp->data());
+    OCIO_CHECK_EQUAL(std::string(op->data()->getName()), "matrix");
+
+    // The half domain contains NaNs so compare the raw values.
+    op = ops[1];
+    refOp = refOps[1];
+    auto lut1d = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(op->data());
+    auto refLut1d = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(refOp->data());
+    OCIO_REQUIRE_ASSERT(lut1d);
+    OCIO_CHECK_ASSERT(lut1d->isInputHalfDomain());
+    OCIO_CHECK_EQUAL(lut1d->getHueAdjust(), OCIO::HUE_DW3);
+    const auto & values = lut1d->getArray().getValues();
+    const auto & refValues = refLut1d->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), refValues.size());
+    OCIO_CHECK_EQUAL(0, memcmp(values.data(), refValues.data(), values.size() * sizeof(float)));
+
+    op = ops[2];
+    refOp = refOps[2];
+    OCIO_CHECK_ASSERT(*op->data() == *refOp->data());
+
+    op = ops[3];
+    refOp = refOps[3];
+    OCIO_CHECK_ASSERT(*op->data() == *refOp->data());
+    OCIO_CHECK_EQUAL(std::string(op->data()->getID()), "lut3d");
+
+    // Dynamic properties are only equal to themselves.
+    op = ops[4];
+    OCIO_CHECK_ASSERT(op->isDynamic());
+    auto ec = OCIO::DynamicPtrCast<const OCIO::ExposureContrastOpData>(op->data());
+    OCIO_REQUIRE_ASSERT(ec);
+    OCIO_CHECK_EQUAL(ec->getExposure(), 0.5);
+
+    const auto & metadata = ops.getFormatMetadata();
+    OCIO_CHECK_EQUAL(std::string(metadata.getID()), "binary_test");
+    OCIO_REQUIRE_EQUAL(metadata.getNumChildrenElements(), 1);
+    OCIO_CHECK_EQUAL(std::string(metadata.getChildElement(0).getElementValue()),
+                     "A description");
+}
+
+OCIO_ADD_TEST(FileFormatBinaryOps, ctf_records_round_trip)
+{
+    // The ops stored as CTF records use parameters which need all the significant digits of a
+    // double (or of a float) to be restored exactly.
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto log = OCIO::LogAffineTransform::Create();
+    log->setBase(1. + 1. / 3.);
+    const double logSlope[3]{ 1. / 3., 2. / 3., 0.1 + 0.2 };
+    log->setLogSideSlopeValue(logSlope);
+    group->appendTransform(log);
+
+    auto cdl = OCIO::CDLTransform::Create();
+    const double slope[3]{ 1. / 7., 1.1, 0.3 };
+    cdl->setSlope(slope);
+    cdl->setSat(1. / 3.);
+    group->appendTransform(cdl);
+
+    auto exponent = OCIO::ExponentWithLinearTransform::Create();
+    const double gamma[4]{ 2.4 / 1.1, 2.4, 2.4, 1. };
+    const double offset[4]{ 0.055 / 3., 0.055, 0.055, 0. };
+    exponent->setGamma(gamma);
+    exponent->setOffset(offset);
+    group->appendTransform(exponent);
+
+    auto range = OCIO::RangeTransform::Create();
+    range->setMinInValue(-1. / 3.);
+    range->setMaxInValue(1. / 7.);
+    range->setMinOutValue(1. / 9.);
+    range->setMaxOutValue(1.1);
+    group->appendTransform(range);
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(1. / 3.);
+    ec->setContrast(1. / 7.);
+    group->appendTransform(ec);
+
+    auto curve = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 1.f / 3.f, 0.1f },
+                                                     { 2.f / 3.f, 0.7f / 3.f }, { 1.f, 1.f } });
+    auto rgbCurve = OCIO::GradingRGBCurveTransform::Create(OCIO::GRADING_LIN);
+    rgbCurve->setValue(OCIO::GradingRGBCurve::Create(curve, curve, curve, curve));
+    group->appendTransform(rgbCurve);
+
+    std::ostringstream oss;
+    OCIO_CHECK_NO_THROW(group->write(config, OCIO::FILEFORMAT_BINARY_OPS, oss));
+
+    OCIO::OpRcPtrVec refOps;
+    OCIO::BuildGroupOps(refOps, *config, config->getCurrentContext(), *group,
+                        OCIO::TRANSFORM_DIR_FORWARD);
+    refOps.finalize();
+
+    std::istringstream iss(oss.str());
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::ReadOpsFromBinary(ops, iss, "memory"));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+
+    OCIO_REQUIRE_EQUAL(ops.size(), refOps.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        OCIO::ConstOpRcPtr op = ops[i];
+        OCIO::ConstOpRcPtr refOp = refOps[i];
+        OCIO_CHECK_EQUAL(op->getCacheID(), refOp->getCacheID());
+        OCIO_CHECK_ASSERT(*op->data() == *refOp->data());
+    }
+}
+
+OCIO_ADD_TEST(FileFormatBinaryOps, array_alignment)
+{
+    OCIO::OpRcPtrVec ops;
+
+    auto lut = std::make_shared<OCIO::Lut3DOpData>(2);
+    lut->getFormatMetadata().setName("odd length name");
+    lut->getArray().getValues()[0] = 1234.5678f;
+    OCIO::CreateLut3DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    std::ostringstream oss;
+    OCIO_CHECK_NO_THROW(OCIO::WriteOpsToBinary(ops, oss));
+    const std::string buffer = oss.str();
+
+    const float marker = 1234.5678f;
+    const size_t pos = buffer.find(std::string(reinterpret_cast<const char *>(&marker),
+                                               sizeof(float)));
+    OCIO_REQUIRE_ASSERT(pos != std::string::npos);
+    OCIO_CHECK_EQUAL(pos % OCIO::BINARY_OPS_ARRAY_ALIGNMENT, 0);
+}
+
+OCIO_ADD_TEST(FileFormatBinaryOps, errors)
+{
+    OCIO::OpRcPtrVec ops;
+    const double scale[4]{ 2., 2., 2., 1. };
+    OCIO::CreateScaleOp(ops, scale, OCIO::TRANSFORM_DIR_FORWARD);
+    ops.finalize();
+
+    std::ostringstream oss;
+    OCIO::WriteOpsToBinary(ops, oss);
+    const std::string buffer = oss.str();
+
+    {
+        std::string bad = buffer;
+        bad[0] = 'X';
+        std::istringstream iss(bad);
+        OCIO::OpRcPtrVec readOps;
+        OCIO_CHECK_THROW_WHAT(OCIO::ReadOpsFromBinary(readOps, iss, "bad.ociob"),
+                              OCIO::Exception,
+                              "Error parsing OCIO binary op list (bad.ociob). "
+                              "Not an OCIO binary op list.");
+    }
+    {
+        std::string bad = buffer;
+        bad[8] = 2;
+        std::istringstream iss(bad);
+        OCIO::OpRcPtrVec readOps;
+        OCIO_CHECK_THROW_WHAT(OCIO::ReadOpsFromBinary(readOps, iss, "bad.ociob"),
+                              OCIO::Exception,
+                              "Unsupported version 2.");
+    }
+    {
+        std::istringstream iss(buffer.substr(0, buffer.size() - 1));
+        OCIO::OpRcPtrVec readOps;
+        OCIO_CHECK_THROW_WHAT(OCIO::ReadOpsFromBinary(readOps, iss, "bad.ociob"),
+                              OCIO::Exception,
+                              "Unexpected end of file.");
+    }
+}
+
+namespace
+{
+
+// Write the header of a binary op list holding a single record.
+void WriteSingleRecordHeader(OCIO::BinaryWriter & writer, OCIO::RecordType type)
+{
+    writer.writeBytes(OCIO::BINARY_OPS_MAGIC, sizeof(OCIO::BINARY_OPS_MAGIC));
+    writer.writeUInt32(OCIO::BINARY_OPS_VERSION);
+    writer.writeUInt32(OCIO::BINARY_OPS_BYTE_ORDER);
+    writer.writeMetadata(OCIO::FormatMetadataImpl(OCIO::METADATA_ROOT, ""));
+    writer.writeUInt32(1);
+
+    writer.writeUInt32(type);
+    writer.writeMetadata(OCIO::FormatMetadataImpl(OCIO::METADATA_ROOT, ""));
+}
+
+std::string CreateMatrixRecord(uint32_t fileOutBitDepth)
+{
+    std::ostringstream oss;
+    OCIO::BinaryWriter writer(oss);
+    WriteSingleRecordHeader(writer, OCIO::RECORD_MATRIX);
+    writer.writeUInt32(OCIO::TRANSFORM_DIR_FORWARD);
+    writer.writeUInt32(OCIO::BIT_DEPTH_F32);
+    writer.writeUInt32(fileOutBitDepth);
+
+    const double values[20]{ 1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1. };
+    writer.writeBytes(values, sizeof(values));
+    return oss.str();
+}
+
+std::string CreateLut1DRecord(uint32_t interpolation, uint32_t halfFlags, uint32_t hueAdjust)
+{
+    std::ostringstream oss;
+    OCIO::BinaryWriter writer(oss);
+    WriteSingleRecordHeader(writer, OCIO::RECORD_LUT1D);
+    writer.writeUInt32(interpolation);
+    writer.writeUInt32(OCIO::TRANSFORM_DIR_FORWARD);
+    writer.writeUInt32(halfFlags);
+    writer.writeUInt32(hueAdjust);
+    writer.writeUInt32(OCIO::BIT_DEPTH_F32);
+    writer.writeUInt32(2);
+    writer.writeUInt32(3);
+
+    const float values[6]{ 0.f, 0.f, 0.f, 1.f, 1.f, 1.f };
+    writer.align();
+    writer.writeBytes(values, sizeof(values));
+    return oss.str();
+}
+
+void CheckReadError(const std::string & buffer, const std::string & error)
+{
+    std::istringstream iss(buffer);
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_THROW_WHAT(OCIO::ReadOpsFromBinary(ops, iss, "bad.ociob"),
+                          OCIO::Exception,
+                          "Error parsing OCIO binary op list (bad.ociob). " + error);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(FileFormatBinaryOps, invalid_enums)
+{
+    {
+        std::istringstream iss(CreateMatrixRecord(OCIO::BIT_DEPTH_UINT10));
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::ReadOpsFromBinary(ops, iss, "good.ociob"));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op = ops[0];
+        auto matrix = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(op->data());
+        OCIO_REQUIRE_ASSERT(matrix);
+        OCIO_CHECK_EQUAL(matrix->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+    }
+    CheckReadError(CreateMatrixRecord(42), "Invalid bit-depth 42.");
+
+    {
+        std::istringstream iss(CreateLut1DRecord(OCIO::INTERP_NEAREST,
+                                                 OCIO::Lut1DOpData::LUT_STANDARD,
+                                                 OCIO::HUE_DW3));
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::ReadOpsFromBinary(ops, iss, "good.ociob"));
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+        OCIO::ConstOpRcPtr op = ops[0];
+        auto lut = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(op->data());
+        OCIO_REQUIRE_ASSERT(lut);
+        OCIO_CHECK_EQUAL(lut->getInterpolation(), OCIO::INTERP_NEAREST);
+        OCIO_CHECK_EQUAL(lut->getHueAdjust(), OCIO::HUE_DW3);
+    }
+    CheckReadError(CreateLut1DRecord(5, OCIO::Lut1DOpData::LUT_STANDARD, OCIO::HUE_NONE),
+                   "Invalid interpolation 5.");
+    CheckReadError(CreateLut1DRecord(OCIO::INTERP_LINEAR, 4, OCIO::HUE_NONE),
+                   "Invalid LUT 1D half flags 4.");
+    CheckReadError(CreateLut1DRecord(OCIO::INTERP_LINEAR, OCIO::Lut1DOpData::LUT_STANDARD, 3),
+                   "Invalid LUT 1D hue adjust 3.");
+}
+
+OCIO_ADD_TEST(FileFormatBinaryOps, file_transform)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::GroupTransformRcPtr group = CreateTestTransform();
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ociob");
+    {
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::binary);
+        OCIO_CHECK_NO_THROW(group->write(config, OCIO::FILEFORMAT_BINARY_OPS, ostream));
+    }
+
+    auto file = OCIO::FileTransform::Create();
+    file->setSrc(filename.c_str());
+
+    float src[8]{ 0.1f, 0.2f, 0.3f, 1.0f,
+                  0.8f, 0.5f, 0.02f, 0.5f };
+
+    for (auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        file->setDirection(dir);
+        group->setDirection(dir);
+
+        OCIO::ConstCPUProcessorRcPtr fileCPU, groupCPU;
+        OCIO_CHECK_NO_THROW(fileCPU = config->getProcessor(file)->getDefaultCPUProcessor());
+        OCIO_CHECK_NO_THROW(groupCPU = config->getProcessor(group)->getDefaultCPUProcessor());
+
+        float fileDst[8], groupDst[8];
+        OCIO::PackedImageDesc srcDesc(src, 2, 1, 4);
+        OCIO::PackedImageDesc fileDesc(fileDst, 2, 1, 4);
+        OCIO::PackedImageDesc groupDesc(groupDst, 2, 1, 4);
+        fileCPU->apply(srcDesc, fileDesc);
+        groupCPU->apply(srcDesc, groupDesc);
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+            OCIO_CHECK_EQUAL(fileDst[i], groupDst[i]);
+        }
+    }
+
+    std::remove(filename.c_str());
+}
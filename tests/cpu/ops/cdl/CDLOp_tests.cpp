@@ -796,3 +796,29 @@ OCIO_ADD_TEST(CDLOp, create_transform)
     }
 }
 
+
+OCIO_ADD_TEST(CDLOp, instruction_sets)
+{
+    // The SIMD kernels selected at runtime must match the base instruction set results, including
+    // for the trailing pixels which do not fill a whole SIMD register.
+    std::vector<float> rgbaImage(37 * 4);
+    for (size_t idx = 0; idx < rgbaImage.size(); ++idx)
+    {
+        rgbaImage[idx] = -0.1f + 1.5f * float(idx) / float(rgbaImage.size());
+    }
+
+    const OCIO::CDLOpData::ChannelParams slopeParams(1.35, 1.1, 0.71);
+    const OCIO::CDLOpData::ChannelParams offsetParams(0.05, -0.23, 0.11);
+    const OCIO::CDLOpData::ChannelParams powerParams(0.93, 0.81, 1.27);
+
+    for (const auto style : { OCIO::CDLOpData::CDL_V1_2_FWD,
+                              OCIO::CDLOpData::CDL_V1_2_REV,
+                              OCIO::CDLOpData::CDL_NO_CLAMP_FWD,
+                              OCIO::CDLOpData::CDL_NO_CLAMP_REV })
+    {
+        OCIO::ConstCDLOpDataRcPtr cdl = std::make_shared<OCIO::CDLOpData>(
+            style, slopeParams, offsetParams, powerParams, 1.23);
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&cdl]() { return OCIO::GetCDLCPURenderer(cdl, true); }, rgbaImage, 1e-5f, 1e-3f), "");
+    }
+}
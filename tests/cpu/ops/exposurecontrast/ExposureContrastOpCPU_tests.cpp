@@ -5,6 +5,7 @@
 #include "ops/exposurecontrast/ExposureContrastOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -430,3 +431,34 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log_params)
     TestLogParamForStyle(OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV, true);
 }
 
+
+OCIO_ADD_TEST(ExposureContrastOpCPU, instruction_sets)
+{
+    // The SIMD kernels selected at runtime must match the base instruction set results, including
+    // for the trailing pixels which do not fill a whole SIMD register.
+    std::vector<float> rgbaImage(37 * 4);
+    for (size_t idx = 0; idx < rgbaImage.size(); ++idx)
+    {
+        rgbaImage[idx] = -0.1f + 1.5f * float(idx) / float(rgbaImage.size());
+    }
+
+    for (const auto style : { OCIO::ExposureContrastOpData::STYLE_LINEAR,
+                              OCIO::ExposureContrastOpData::STYLE_LINEAR_REV,
+                              OCIO::ExposureContrastOpData::STYLE_VIDEO,
+                              OCIO::ExposureContrastOpData::STYLE_VIDEO_REV,
+                              OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC,
+                              OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV })
+    {
+        OCIO::ExposureContrastOpDataRcPtr ec
+            = std::make_shared<OCIO::ExposureContrastOpData>(style);
+        ec->setExposure(0.8);
+        ec->setContrast(1.3);
+        ec->setGamma(1.1);
+        ec->setPivot(0.18);
+
+        OCIO::ConstExposureContrastOpDataRcPtr constEc = ec;
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&constEc]() { return OCIO::GetExposureContrastCPURenderer(constEc); },
+            rgbaImage, 1e-5f, 1e-3f), "");
+    }
+}
@@ -542,6 +542,111 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, aces_output_transform_20)
                        funcData2,
                        1e-4f,
                        __LINE__);
+
+    // Fast power enabled i.e. the batched SIMD renderer when available. The number of samples
+    // is not a multiple of the SIMD width so the remainder processing is also covered.
+    memcpy(&input2_32f[0], &input_32f[0], sizeof(float)*num_samples * 4);
+
+    ApplyFixedFunction(&input2_32f[0], &expected_32f[0], num_samples,
+                       funcData,
+                       5e-5f,
+                       __LINE__,
+                       true);
+
+    ApplyFixedFunction(&input2_32f[0], &input_32f[0], num_samples,
+                       funcData2,
+                       1e-4f,
+                       __LINE__,
+                       true);
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, aces_output_transform_20_simd)
+{
+    // Compare every available SIMD implementation against the scalar renderer.
+
+    const int lut_size = 13;
+    const long num_samples = lut_size * lut_size * lut_size;
+
+    // Display-referred values for the inverse direction.
+    std::vector<float> display_32f(num_samples * 4);
+    GenerateIdentityLut3D(display_32f.data(), lut_size, 4, OCIO::LUT3DORDER_FAST_RED);
+
+    // Scene-referred values for the forward direction, covering negative values and values
+    // mapping above the display peak.
+    std::vector<float> scene_32f(display_32f);
+    for (long idx = 0; idx < num_samples; ++idx)
+    {
+        scene_32f[4 * idx + 0] = scene_32f[4 * idx + 0] * 8.f - 0.5f;
+        scene_32f[4 * idx + 1] = scene_32f[4 * idx + 1] * 8.f - 0.5f;
+        scene_32f[4 * idx + 2] = scene_32f[4 * idx + 2] * 8.f - 0.5f;
+        scene_32f[4 * idx + 3] = float(idx % 3) * 0.5f;
+    }
+
+    OCIO::FixedFunctionOpData::Params params = {
+        // Peak luminance
+        1000.f,
+        // P3D65 gamut
+        0.680, 0.320, 0.265, 0.690, 0.150, 0.060, 0.3127, 0.3290
+    };
+
+    for (const bool fwd : { true, false })
+    {
+        OCIO::ConstFixedFunctionOpDataRcPtr funcData
+            = std::make_shared<OCIO::FixedFunctionOpData>(
+                fwd ? OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD
+                    : OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV,
+                params);
+
+        const std::vector<float> & input_32f = fwd ? scene_32f : display_32f;
+
+        std::vector<float> expected_32f(num_samples * 4);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetFixedFunctionCPURenderer(funcData, false);
+        op->apply(input_32f.data(), expected_32f.data(), num_samples);
+
+        std::vector<OCIO::ACES2OutputTransformApplyFunc *> applyFuncs;
+#if OCIO_USE_SSE2
+        if (OCIO::CPUInfo::instance().hasSSE2())
+        {
+            applyFuncs.push_back(OCIO::SSE2GetACES2OutputTransformApplyFunc(fwd));
+        }
+#endif
+#if OCIO_USE_AVX2
+        if (OCIO::CPUInfo::instance().hasAVX2())
+        {
+            applyFuncs.push_back(OCIO::AVX2GetACES2OutputTransformApplyFunc(fwd));
+        }
+#endif
+#if OCIO_USE_AVX512
+        if (OCIO::CPUInfo::instance().hasAVX512())
+        {
+            applyFuncs.push_back(OCIO::AVX512GetACES2OutputTransformApplyFunc(fwd));
+        }
+#endif
+
+        for (auto applyFunc : applyFuncs)
+        {
+            const OCIO::Renderer_ACES_OutputTransform20_SIMD renderer(funcData, applyFunc);
+
+            // In-place processing.
+            std::vector<float> output_32f(input_32f);
+            renderer.apply(output_32f.data(), output_32f.data(), num_samples);
+
+            for (long idx = 0; idx < num_samples * 4; ++idx)
+            {
+                float computedError = 0.0f;
+                if (!OCIO::EqualWithSafeRelError(output_32f[idx], expected_32f[idx],
+                                                 1e-4f, 1.0f, &computedError))
+                {
+                    std::ostringstream errorMsg;
+                    errorMsg.precision(9);
+                    errorMsg << "Index: " << idx << " - Values: " << output_32f[idx]
+                             << " expected: " << expected_32f[idx]
+                             << " - Error: " << computedError;
+                    OCIO_CHECK_ASSERT_MESSAGE(0, errorMsg.str());
+                }
+            }
+        }
+    }
 }
 
 // NB: The ACES 2 FixedFunction takes linear ACES2065-1 values and produces linear RGB values
@@ -760,3 +760,48 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+OCIO_ADD_TEST(GammaOpCPU, instruction_sets)
+{
+    // The SIMD kernels selected at runtime must match the base instruction set results, including
+    // for the trailing pixels which do not fill a whole SIMD register.
+    std::vector<float> rgbaImage(37 * 4);
+    for (size_t idx = 0; idx < rgbaImage.size(); ++idx)
+    {
+        rgbaImage[idx] = -0.5f + 2.f * float(idx) / float(rgbaImage.size());
+    }
+
+    const OCIO::GammaOpData::Params redParams   = { 2.2 };
+    const OCIO::GammaOpData::Params greenParams = { 1.8 };
+    const OCIO::GammaOpData::Params blueParams  = { 2.6 };
+    const OCIO::GammaOpData::Params alphaParams = { 1.0 };
+
+    for (const auto style : { OCIO::GammaOpData::BASIC_FWD,
+                              OCIO::GammaOpData::BASIC_REV,
+                              OCIO::GammaOpData::BASIC_MIRROR_FWD,
+                              OCIO::GammaOpData::BASIC_MIRROR_REV,
+                              OCIO::GammaOpData::BASIC_PASS_THRU_FWD,
+                              OCIO::GammaOpData::BASIC_PASS_THRU_REV })
+    {
+        OCIO::ConstGammaOpDataRcPtr gamma
+            = std::make_shared<OCIO::GammaOpData>(style, redParams, greenParams,
+                                                  blueParams, alphaParams);
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&gamma]() { return OCIO::GetGammaRenderer(gamma, true); }, rgbaImage, 1e-5f, 1e-3f),
+            "");
+    }
+
+    const OCIO::GammaOpData::Params monParams = { 2.4, 0.055 };
+    for (const auto style : { OCIO::GammaOpData::MONCURVE_FWD,
+                              OCIO::GammaOpData::MONCURVE_REV,
+                              OCIO::GammaOpData::MONCURVE_MIRROR_FWD,
+                              OCIO::GammaOpData::MONCURVE_MIRROR_REV })
+    {
+        OCIO::ConstGammaOpDataRcPtr gamma
+            = std::make_shared<OCIO::GammaOpData>(style, monParams, monParams,
+                                                  monParams, monParams);
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&gamma]() { return OCIO::GetGammaRenderer(gamma, true); }, rgbaImage, 1e-5f, 1e-3f),
+            "");
+    }
+}
@@ -101,3 +101,74 @@ OCIO_ADD_TEST(GradingBSplineCurve, equals)
     curve4->getControlPoint(2).m_y = 0.9f;
     OCIO_CHECK_ASSERT(!(*curve1 == *curve4));
 }
+
+OCIO_ADD_TEST(GradingBSplineCurve, segment_lookup)
+{
+    // A dense curve with unevenly spaced control points, so some grid cells hold several knots
+    // and others none.
+    constexpr size_t numCtrlPnts = 20;
+    auto curve = OCIO::GradingBSplineCurve::Create(numCtrlPnts);
+    for (size_t i = 0; i < numCtrlPnts; ++i)
+    {
+        const float x = static_cast<float>(i * i) / 40.f - 2.f;
+        curve->getControlPoint(i).m_x = x;
+        curve->getControlPoint(i).m_y = x + 0.2f * std::sin(3.f * x);
+    }
+    OCIO_CHECK_NO_THROW(curve->validate());
+
+    auto curveImpl = dynamic_cast<const OCIO::GradingBSplineCurveImpl *>(curve.get());
+    OCIO_REQUIRE_ASSERT(curveImpl);
+
+    // Put the curve after an identity one to validate the offsets.
+    auto identity = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 1.f, 1.f } });
+    auto identityImpl = dynamic_cast<const OCIO::GradingBSplineCurveImpl *>(identity.get());
+
+    OCIO::GradingBSplineCurveImpl::KnotsCoefs knotsCoefs(2);
+    identityImpl->computeKnotsAndCoefs(knotsCoefs, 0, false);
+    curveImpl->computeKnotsAndCoefs(knotsCoefs, 1, false);
+
+    const int knotsCnt = knotsCoefs.m_knotsOffsetsArray[3];
+    const float * knots = knotsCoefs.m_knotsArray.data() + knotsCoefs.m_knotsOffsetsArray[2];
+    OCIO_REQUIRE_ASSERT(knotsCnt > static_cast<int>(numCtrlPnts));
+
+    // Segment found by a linear scan of the knots.
+    auto scanSegment = [&](float x)
+    {
+        int i;
+        for (i = 0; i < knotsCnt - 2; ++i)
+        {
+            if (x < knots[i + 1])
+                break;
+        }
+        return i;
+    };
+
+    std::vector<float> values;
+    for (int i = 0; i < knotsCnt; ++i)
+    {
+        values.push_back(knots[i]);
+        values.push_back(std::nextafter(knots[i], -1e6f));
+        values.push_back(std::nextafter(knots[i], 1e6f));
+    }
+    for (int i = 0; i <= 10000; ++i)
+    {
+        values.push_back(knots[0] + (knots[knotsCnt - 1] - knots[0]) * i / 10000.f);
+    }
+
+    for (const float x : values)
+    {
+        if (x <= knots[0] || x >= knots[knotsCnt - 1])
+        {
+            continue;
+        }
+        OCIO_CHECK_EQUAL(knotsCoefs.findSegment(1, x), scanSegment(x));
+    }
+
+    // The identity curve is not affected.
+    OCIO_CHECK_EQUAL(knotsCoefs.evalCurve(0, 0.3f, 0.3f), 0.3f);
+    OCIO_CHECK_EQUAL(knotsCoefs.m_segmentGridScale[0], 0.f);
+
+    // NaN goes through.
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    OCIO_CHECK_ASSERT(std::isnan(knotsCoefs.evalCurve(1, qnan, qnan)));
+}
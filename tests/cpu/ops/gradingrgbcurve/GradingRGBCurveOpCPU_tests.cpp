@@ -440,3 +440,87 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, slopes)
     OCIO_CHECK_NO_THROW(op->apply(rev_input_32f, rev_input_32f, num_samples));
     ValidateImage(rev_expected_32f, rev_input_32f, num_samples, __LINE__);
 }
+
+OCIO_ADD_TEST(GradingRGBCurveOpCPU, dense_curves)
+{
+    // Dense curves evaluated on many pixels, so the vectorized renderers (when available) are
+    // compared with the scalar evaluation of the curves.
+    auto createCurve = [](size_t numCtrlPnts, float scale)
+    {
+        auto curve = OCIO::GradingBSplineCurve::Create(numCtrlPnts);
+        for (size_t i = 0; i < numCtrlPnts; ++i)
+        {
+            const float x = static_cast<float>(i * i) / static_cast<float>(numCtrlPnts)
+                            - 3.f;
+            curve->getControlPoint(i).m_x = x;
+            curve->getControlPoint(i).m_y = scale * x + 0.1f * std::sin(2.f * x);
+        }
+        return OCIO::ConstGradingBSplineCurveRcPtr(curve);
+    };
+
+    OCIO::ConstGradingBSplineCurveRcPtr r = createCurve(12, 1.1f);
+    OCIO::ConstGradingBSplineCurveRcPtr g = createCurve(9, 0.9f);
+    OCIO::ConstGradingBSplineCurveRcPtr b
+        = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 1.f, 1.f } });
+    OCIO::ConstGradingBSplineCurveRcPtr m = createCurve(10, 1.f);
+
+    constexpr long numPixels = 1003;
+    std::vector<float> image(4 * numPixels);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        image[4 * i + 0] = -4.f + 10.f * static_cast<float>(i) / numPixels;
+        image[4 * i + 1] = 5.f - 9.f * static_cast<float>(i) / numPixels;
+        image[4 * i + 2] = 0.01f * static_cast<float>(i % 101);
+        image[4 * i + 3] = static_cast<float>(i);
+    }
+    image[0] = std::numeric_limits<float>::infinity();
+    image[1] = -std::numeric_limits<float>::infinity();
+
+    for (const auto style : { OCIO::GRADING_LOG, OCIO::GRADING_LIN })
+    {
+        auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(style, r, g, b, m);
+        OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
+
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+        OCIO_REQUIRE_ASSERT(op);
+
+        const auto & knotsCoefs = gc->getDynamicPropertyInternal()->getKnotsCoefs();
+        const bool linToLog = style == OCIO::GRADING_LIN;
+
+        std::vector<float> expected(image);
+        for (long i = 0; i < numPixels; ++i)
+        {
+            float * pix = &expected[4 * i];
+            if (linToLog)
+            {
+                OCIO::LinLog(pix, pix);
+            }
+            for (int c = 0; c < 3; ++c)
+            {
+                pix[c] = knotsCoefs.evalCurve(c, pix[c], pix[c]);
+                pix[c] = knotsCoefs.evalCurve(static_cast<int>(OCIO::RGB_MASTER), pix[c], pix[c]);
+            }
+            if (linToLog)
+            {
+                OCIO::LogLin(pix);
+            }
+            pix[3] = image[4 * i + 3];
+        }
+
+        std::vector<float> res(image);
+        OCIO_CHECK_NO_THROW(op->apply(res.data(), res.data(), numPixels));
+
+        for (long i = 0; i < 4 * numPixels; ++i)
+        {
+            if (std::isinf(expected[i]))
+            {
+                OCIO_CHECK_EQUAL(expected[i], res[i]);
+            }
+            else
+            {
+                OCIO_CHECK_CLOSE(expected[i], res[i], 1e-5f * std::max(1.f, std::fabs(expected[i])));
+            }
+        }
+    }
+}
@@ -620,3 +620,35 @@ OCIO_ADD_TEST(LogOpCPU, cameralog2lin_test)
     OCIO_CHECK_ASSERT(OCIO::IsNan(rgba[10]));
 }
 
+
+OCIO_ADD_TEST(LogOpCPU, instruction_sets)
+{
+    // The SIMD kernels selected at runtime must match the base instruction set results, including
+    // for the trailing pixels which do not fill a whole SIMD register.
+    std::vector<float> rgbaImage(37 * 4);
+    for (size_t idx = 0; idx < rgbaImage.size(); ++idx)
+    {
+        rgbaImage[idx] = -0.1f + 1.5f * float(idx) / float(rgbaImage.size());
+    }
+
+    const OCIO::LogOpData::Params redParams   = { 0.5, 0.1, 1.1, 0.01 };
+    const OCIO::LogOpData::Params greenParams = { 0.4, 0.2, 1.2, 0.02 };
+    const OCIO::LogOpData::Params blueParams  = { 0.6, 0.3, 0.9, 0.03 };
+    OCIO::LogOpData::Params camParams = redParams;
+    camParams.push_back(0.1);
+    camParams.push_back(1.1);
+
+    for (const auto dir : { OCIO::TRANSFORM_DIR_FORWARD, OCIO::TRANSFORM_DIR_INVERSE })
+    {
+        OCIO::ConstLogOpDataRcPtr log
+            = std::make_shared<OCIO::LogOpData>(2., redParams, greenParams, blueParams, dir);
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&log]() { return OCIO::GetLogRenderer(log, true); }, rgbaImage, 1e-5f, 1e-3f), "");
+
+        OCIO::ConstLogOpDataRcPtr camLog
+            = std::make_shared<OCIO::LogOpData>(10., camParams, camParams, camParams, dir);
+        OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+            [&camLog]() { return OCIO::GetLogRenderer(camLog, true); }, rgbaImage, 1e-5f, 1e-3f),
+            "");
+    }
+}
@@ -1759,6 +1759,144 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_identity_half_code)
     }
 }
 
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_half_code_batch)
+{
+    // The processing of several pixels may use a SIMD implementation which must give the
+    // same results as a scalar interpolation between the half codes (except for the rounding
+    // differences of the fused multiply-add). One pixel uses the same implementation as
+    // several pixels so the results are identical whatever the image is split into.
+
+    OCIO::Lut1DOpDataRcPtr lutData
+        = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                              65536, false);
+    float * values = &lutData->getArray().getValues()[0];
+    for (unsigned long i = 0; i < 65536; ++i)
+    {
+        values[i * 3 + 0] = float(i) * 1e-5f;
+        values[i * 3 + 1] = 1.0f - float(i) * 2e-5f;
+        values[i * 3 + 2] = float(i % 1000) * 0.001f;
+    }
+
+    OCIO_CHECK_NO_THROW(lutData->validate());
+    OCIO_CHECK_NO_THROW(lutData->finalize());
+    OCIO::ConstLut1DOpDataRcPtr constLut = lutData;
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    std::vector<float> src{ 0.f, -0.f, qnan, inf, -inf, 65504.f, -65504.f, 65519.f, 65520.f,
+                            -65520.f, 1e10f, -1e10f, 1e-10f, -1e-10f, 5.9604645e-08f, 3e-8f };
+
+    // Half values, and values between two consecutive half values.
+    for (unsigned i = 0; i < 65536; i += 7)
+    {
+        half h1, h2;
+        h1.setBits((unsigned short)i);
+        h2.setBits((unsigned short)(i + 1));
+        if (!h1.isNan() && !h1.isInfinity())
+        {
+            src.push_back(h1);
+            if (!h2.isNan() && !h2.isInfinity())
+            {
+                src.push_back(h1 + (h2 - h1) * 0.3f);
+                src.push_back(h1 + (h2 - h1) * 0.5f);
+            }
+        }
+    }
+
+    // Make an odd number of RGBA pixels.
+    while (src.size() % 4 != 0)
+    {
+        src.push_back(0.25f);
+    }
+    src.insert(src.end(), { 0.1f, 0.2f, 0.3f, 0.4f });
+    const long numPixels = long(src.size() / 4);
+
+    // Scalar interpolation of the LUT values.
+    std::vector<float> expected(src.size());
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        const size_t channel = i % 4;
+        if (channel == 3)
+        {
+            expected[i] = src[i];
+            continue;
+        }
+
+        const OCIO::IndexPair vals = OCIO::IndexPair::GetEdgeFloatValues(src[i]);
+        expected[i] = OCIO::lerpf(values[vals.valB * 3 + channel],
+                                  values[vals.valA * 3 + channel],
+                                  1.0f - vals.fraction);
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32));
+
+        std::vector<float> ref(src.size()), dst(src.size());
+        for (long p = 0; p < numPixels; ++p)
+        {
+            cpuOp->apply(&src[p * 4], &ref[p * 4], 1);
+        }
+        cpuOp->apply(src.data(), dst.data(), numPixels);
+
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            if (OCIO::IsNan(expected[i]))
+            {
+                OCIO_CHECK_ASSERT(OCIO::IsNan(dst[i]));
+                OCIO_CHECK_ASSERT(OCIO::IsNan(ref[i]));
+            }
+            else if (std::isinf(expected[i]))
+            {
+                OCIO_CHECK_EQUAL(dst[i], expected[i]);
+                OCIO_CHECK_EQUAL(ref[i], expected[i]);
+            }
+            else
+            {
+                OCIO_CHECK_CLOSE(dst[i], expected[i], 1e-6f);
+                OCIO_CHECK_EQUAL(ref[i], dst[i]);
+            }
+        }
+    }
+
+    {
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut,
+                                                           OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F16));
+
+        std::vector<half> ref(src.size()), dst(src.size());
+        for (long p = 0; p < numPixels; ++p)
+        {
+            cpuOp->apply(&src[p * 4], &ref[p * 4], 1);
+        }
+        cpuOp->apply(src.data(), dst.data(), numPixels);
+
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            const half expectedHalf(expected[i]);
+            if (expectedHalf.isNan())
+            {
+                OCIO_CHECK_ASSERT(dst[i].isNan());
+                OCIO_CHECK_ASSERT(ref[i].isNan());
+            }
+            else if (expectedHalf.isInfinity())
+            {
+                OCIO_CHECK_EQUAL(dst[i].bits(), expectedHalf.bits());
+                OCIO_CHECK_EQUAL(ref[i].bits(), expectedHalf.bits());
+            }
+            else
+            {
+                OCIO_CHECK_CLOSE((float)dst[i], (float)expectedHalf, 1e-3f);
+                OCIO_CHECK_EQUAL(ref[i].bits(), dst[i].bits());
+            }
+        }
+    }
+}
+
 OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_identity)
 {
     // By default, this constructor creates an 'identity lut'.
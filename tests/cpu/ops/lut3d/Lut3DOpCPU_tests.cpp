@@ -55,3 +55,167 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+OCIO_ADD_TEST(InvLut3DRenderer, batched_search)
+{
+    // A monotonic LUT with some cross-talk between the channels.
+    constexpr unsigned long dim = 17;
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(dim);
+    float * values = &lut->getArray().getValues()[0];
+    for (unsigned long r = 0; r < dim; ++r)
+    {
+        for (unsigned long g = 0; g < dim; ++g)
+        {
+            for (unsigned long b = 0; b < dim; ++b)
+            {
+                const float R = r / float(dim - 1);
+                const float G = g / float(dim - 1);
+                const float B = b / float(dim - 1);
+                float * rgb = values + 3 * ((r * dim + g) * dim + b);
+                rgb[0] = 0.8f * std::pow(R, 1.8f) + 0.1f * G + 0.1f * B;
+                rgb[1] = 0.1f * R + 0.8f * std::sqrt(G) + 0.1f * B;
+                rgb[2] = 0.05f * R + 0.05f * G + 0.9f * B * B;
+            }
+        }
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    OCIO::InvLut3DRenderer renderer(lutConst);
+
+    // Smooth gradients (i.e. coherent pixels), random values and out of range values. An odd
+    // number of pixels leaves a partial packet at the end.
+    constexpr long numPixels = 1001;
+    std::vector<float> src(numPixels * 4);
+    std::srand(42);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        float * pix = &src[i * 4];
+        if (i < 500)
+        {
+            pix[0] = i / 499.f;
+            pix[1] = 0.5f * i / 499.f + 0.25f;
+            pix[2] = 1.f - i / 499.f;
+        }
+        else if (i < 990)
+        {
+            pix[0] = std::rand() / float(RAND_MAX);
+            pix[1] = std::rand() / float(RAND_MAX);
+            pix[2] = std::rand() / float(RAND_MAX);
+        }
+        else
+        {
+            pix[0] = -0.5f + 0.2f * (i - 990);
+            pix[1] = 2.f - 0.3f * (i - 990);
+            pix[2] = 0.5f;
+        }
+        pix[3] = i / float(numPixels);
+    }
+
+    // Processing one pixel at a time is a plain search of the tree for each pixel.
+    std::vector<float> ref(numPixels * 4);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        renderer.apply(&src[i * 4], &ref[i * 4], 1);
+    }
+
+    std::vector<float> dst(numPixels * 4);
+    renderer.apply(src.data(), dst.data(), numPixels);
+
+    // In-place processing.
+    std::vector<float> inPlace(src);
+    renderer.apply(inPlace.data(), inPlace.data(), numPixels);
+
+    for (long i = 0; i < numPixels * 4; ++i)
+    {
+        OCIO_CHECK_EQUAL(dst[i], ref[i]);
+        OCIO_CHECK_EQUAL(inPlace[i], dst[i]);
+    }
+
+    // The inverse of the LUT values are the grid positions.
+    for (unsigned long idx : { 0ul, 100ul, 2000ul, 4912ul })
+    {
+        const unsigned long r = idx / (dim * dim);
+        const unsigned long g = (idx / dim) % dim;
+        const unsigned long b = idx % dim;
+
+        float pix[8] = { values[idx * 3], values[idx * 3 + 1], values[idx * 3 + 2], 1.f,
+                         values[idx * 3], values[idx * 3 + 1], values[idx * 3 + 2], 1.f };
+        renderer.apply(pix, pix, 2);
+        for (int p = 0; p < 2; ++p)
+        {
+            OCIO_CHECK_CLOSE(pix[p * 4 + 0], r / float(dim - 1), 1e-4f);
+            OCIO_CHECK_CLOSE(pix[p * 4 + 1], g / float(dim - 1), 1e-4f);
+            OCIO_CHECK_CLOSE(pix[p * 4 + 2], b / float(dim - 1), 1e-4f);
+        }
+    }
+}
+
+OCIO_ADD_TEST(InvLut3DRenderer, folding_lut)
+{
+    // A non-injective LUT: the red values below 0.5 only come from the falling half of the
+    // fold but the other ones come from both halves, so their inverse depends on which LUT cube
+    // is searched first.
+    constexpr unsigned long dim = 9;
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(dim);
+    auto fold = [](float x) { return x < 0.5f ? 0.5f + x : 2.f * (1.f - x); };
+    for (unsigned long r = 0; r < dim; ++r)
+    {
+        for (unsigned long g = 0; g < dim; ++g)
+        {
+            for (unsigned long b = 0; b < dim; ++b)
+            {
+                const float R = r / float(dim - 1);
+                const float G = g / float(dim - 1);
+                const float B = b / float(dim - 1);
+                lut->setValue(r, g, b, fold(R), 0.9f * G + 0.1f * fold(R), B);
+            }
+        }
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(lut));
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                             OCIO::BIT_DEPTH_F32,
+                                                             OCIO::OPTIMIZATION_NONE));
+
+    // Smooth gradients: a red ramp crossing 0.5 goes on from a cube of the falling half to
+    // values also in the rising half.
+    constexpr long width = 61;
+    constexpr long height = 37;
+    constexpr long numPixels = width * height;
+    std::vector<float> src(numPixels * 4);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        src[i * 4 + 0] = (i % 97) / 96.f;
+        src[i * 4 + 1] = (i % 31) / 30.f;
+        src[i * 4 + 2] = i / float(numPixels - 1);
+        src[i * 4 + 3] = 1.f;
+    }
+
+    std::vector<float> ref(numPixels * 4);
+    for (long i = 0; i < numPixels; ++i)
+    {
+        OCIO::PackedImageDesc srcPixel(&src[i * 4], 1, 1, 4);
+        OCIO::PackedImageDesc refPixel(&ref[i * 4], 1, 1, 4);
+        cpu->apply(srcPixel, refPixel);
+    }
+
+    const OCIO::PackedImageDesc srcDesc(src.data(), width, height, 4);
+
+    std::vector<float> dst(numPixels * 4);
+    OCIO::PackedImageDesc dstDesc(dst.data(), width, height, 4);
+    cpu->apply(srcDesc, dstDesc);
+
+    std::vector<float> dstThreads(numPixels * 4);
+    OCIO::PackedImageDesc dstThreadsDesc(dstThreads.data(), width, height, 4);
+    cpu->apply(srcDesc, dstThreadsDesc, 5u);
+
+    for (long i = 0; i < numPixels * 4; ++i)
+    {
+        OCIO_CHECK_EQUAL(dst[i], ref[i]);
+        OCIO_CHECK_EQUAL(dstThreads[i], ref[i]);
+    }
+}
@@ -312,6 +312,113 @@ OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
     OCIO_CHECK_EQUAL(invFastLutData->getArray().getLength(), 48);
 }
 
+namespace
+{
+
+// Restore the inverse 3D LUT grid size at the end of a test.
+struct InverseGridSizeGuard
+{
+    InverseGridSizeGuard() : m_gridSize(OCIO::GetInverseLut3DGridSize()) {}
+    ~InverseGridSizeGuard() { OCIO::SetInverseLut3DGridSize(m_gridSize); }
+
+    unsigned m_gridSize;
+};
+
+} // anon.
+
+OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_grid_size)
+{
+    InverseGridSizeGuard guard;
+    OCIO_CHECK_EQUAL(OCIO::GetInverseLut3DGridSize(), 48);
+
+    OCIO_CHECK_THROW_WHAT(OCIO::SetInverseLut3DGridSize(1), OCIO::Exception,
+                          "Inverse 3D LUT grid size '1' must be in the [2, 129] range.");
+    OCIO_CHECK_THROW_WHAT(OCIO::SetInverseLut3DGridSize(130), OCIO::Exception,
+                          "Inverse 3D LUT grid size '130' must be in the [2, 129] range.");
+    OCIO_CHECK_EQUAL(OCIO::GetInverseLut3DGridSize(), 48);
+
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(17);
+    for (auto & val : lut->getArray().getValues())
+    {
+        val *= val;
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO::ConstLut3DOpDataRcPtr invLut = lut;
+
+    OCIO_CHECK_NO_THROW(OCIO::SetInverseLut3DGridSize(65));
+    OCIO::Lut3DOpDataRcPtr invFastLut;
+    OCIO_CHECK_NO_THROW(invFastLut = OCIO::MakeFastLut3DFromInverse(invLut));
+    OCIO_REQUIRE_ASSERT(invFastLut);
+    OCIO_CHECK_EQUAL(invFastLut->getArray().getLength(), 65);
+    OCIO_CHECK_EQUAL(invFastLut->getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+
+    // The inverse of the squared values is the square root.
+    const auto & values = invFastLut->getArray().getValues();
+    const float step = 1.0f / 64.0f;
+    OCIO_CHECK_CLOSE(values[3 * (64 * 65 * 65 + 16 * 65 + 4) + 0], 1.0f, 1e-3f);
+    OCIO_CHECK_CLOSE(values[3 * (64 * 65 * 65 + 16 * 65 + 4) + 1], std::sqrt(16.f * step), 1e-3f);
+    OCIO_CHECK_CLOSE(values[3 * (64 * 65 * 65 + 16 * 65 + 4) + 2], std::sqrt(4.f * step), 1e-3f);
+}
+
+OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_cache)
+{
+    InverseGridSizeGuard guard;
+    OCIO::ClearLut3DInverseCaches();
+
+    const OCIO::CacheStatistics stats = OCIO::g_fastInverseCache.getStatistics();
+
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(5);
+    for (auto & val : lut->getArray().getValues())
+    {
+        val *= val;
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    lut->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    lut->getFormatMetadata().setName("first");
+    OCIO::ConstLut3DOpDataRcPtr invLut = lut;
+
+    OCIO::Lut3DOpDataRcPtr invFastLut1 = OCIO::MakeFastLut3DFromInverse(invLut);
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numMisses, stats.m_numMisses + 1);
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numHits, stats.m_numHits);
+    OCIO_CHECK_EQUAL(invFastLut1->getName(), "first");
+
+    // The same LUT values hit the cache even with different metadata and file bit-depth, which
+    // are then taken from the requested LUT.
+    OCIO::Lut3DOpDataRcPtr lut2 = lut->clone();
+    lut2->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT12);
+    lut2->getFormatMetadata().setName("second");
+    OCIO::ConstLut3DOpDataRcPtr invLut2 = lut2;
+
+    OCIO::Lut3DOpDataRcPtr invFastLut2 = OCIO::MakeFastLut3DFromInverse(invLut2);
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numMisses, stats.m_numMisses + 1);
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numHits, stats.m_numHits + 1);
+
+    OCIO_CHECK_NE(invFastLut1.get(), invFastLut2.get());
+    OCIO_CHECK_ASSERT(*invFastLut1 == *invFastLut2);
+    OCIO_CHECK_EQUAL(invFastLut1->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+    OCIO_CHECK_EQUAL(invFastLut2->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT12);
+    OCIO_CHECK_EQUAL(invFastLut2->getName(), "second");
+
+    // The cached result is identical to an uncached one.
+    OCIO::Lut3DOpDataRcPtr uncached = OCIO::ComposeFastLut3DFromInverse(invLut, 48);
+    OCIO_CHECK_ASSERT(*invFastLut1 == *uncached);
+
+    // The grid size is part of the key.
+    OCIO::SetInverseLut3DGridSize(17);
+    OCIO::Lut3DOpDataRcPtr invFastLut3 = OCIO::MakeFastLut3DFromInverse(invLut);
+    OCIO_CHECK_EQUAL(invFastLut3->getArray().getLength(), 17);
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numMisses, stats.m_numMisses + 2);
+
+    // The entries account for the size of their LUT values, within a byte budget.
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numBytes,
+                     (48 * 48 * 48 + 17 * 17 * 17) * 3 * sizeof(float));
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_maxBytes,
+                     OCIO::FastInverseCache::MaxBytes);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::g_fastInverseCache.getStatistics().m_numEntries, 0);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
 {
     OCIO::ConstLut3DOpDataRcPtr lutRef = std::make_shared<OCIO::Lut3DOpData>(5);
@@ -5,6 +5,7 @@
 #include "ops/matrix/MatrixOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -120,3 +121,29 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+OCIO_ADD_TEST(MatrixOpCPU, instruction_sets)
+{
+    // The SIMD kernels selected at runtime must match the base instruction set results, including
+    // for the trailing pixels which do not fill a whole SIMD register.
+    std::vector<float> rgbaImage(37 * 4);
+    for (size_t idx = 0; idx < rgbaImage.size(); ++idx)
+    {
+        rgbaImage[idx] = -0.5f + 2.5f * float(idx) / float(rgbaImage.size());
+    }
+
+    OCIO::MatrixOpDataRcPtr mat(OCIO::MatrixOpData::CreateDiagonalMatrix(2.0));
+    mat->setArrayValue(1, 0.25);
+    mat->setArrayValue(3, 0.5);
+    mat->setArrayValue(8, -0.3);
+
+    OCIO::ConstMatrixOpDataRcPtr m = mat;
+    OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+        [&m]() { return OCIO::GetMatrixRenderer(m); }, rgbaImage, 1e-6f, 1e-3f), "");
+
+    mat->setOffsetValue(0, 0.1);
+    mat->setOffsetValue(2, -0.2);
+    mat->setOffsetValue(3, 0.3);
+    OCIO_CHECK_EQUAL(OCIO::CompareCPUInstructionSets(
+        [&m]() { return OCIO::GetMatrixRenderer(m); }, rgbaImage, 1e-6f, 1e-3f), "");
+}
@@ -157,3 +157,27 @@ END METADATA
         self.assertEqual(len(fmts), 12)
         self.assertEqual("cinespace", fmts[4][0])
         self.assertEqual("3dl", fmts[1][1])
+
+    def test_bake_display_views(self):
+        """
+        Test baking several display / view pairs at once.
+        """
+        bake = OCIO.Baker()
+        cfg = OCIO.Config().CreateFromStream(self.SIMPLE_PROFILE)
+        bake.setConfig(cfg)
+        bake.setFormat("cinespace")
+        bake.setInputSpace("lnh")
+        bake.setShaperSize(4)
+        bake.setCubeSize(2)
+
+        self.assertEqual(1, bake.getNumThreads())
+        bake.setNumThreads(2)
+        self.assertEqual(2, bake.getNumThreads())
+
+        luts = bake.bakeDisplayViews([("TestDisplay", "TestView")] * 3)
+        self.assertEqual(len(luts), 3)
+        for lut in luts:
+            self.assert_lut_match(lut, self.EXPECTED_LUT)
+
+        with self.assertRaises(OCIO.Exception):
+            bake.bakeDisplayViews([("TestDisplay", "UnknownView")])
@@ -292,6 +292,57 @@ class CPUProcessorTest(unittest.TestCase):
             [2.0, 2.0, 2.0]
         )
 
+    def test_dynamic_property_snapshot(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        tr = OCIO.ExposureContrastTransform(
+            style=OCIO.EXPOSURE_CONTRAST_LINEAR,
+            dynamicExposure=True
+        )
+
+        proc = self.config.getProcessor(tr)
+        cpu_proc = proc.getDefaultCPUProcessor()
+
+        snapshot = cpu_proc.createDynamicPropertySnapshot()
+        self.assertTrue(snapshot.isDynamic())
+        self.assertTrue(snapshot.hasDynamicProperty(OCIO.DYNAMIC_PROPERTY_EXPOSURE))
+        self.assertFalse(snapshot.hasDynamicProperty(OCIO.DYNAMIC_PROPERTY_GAMMA))
+
+        # Change the snapshot exposure to +1 stops, the processor one is unchanged.
+        snapshot.getDynamicProperty(OCIO.DYNAMIC_PROPERTY_EXPOSURE).setDouble(1.0)
+
+        arr = np.ones(3 * 4, dtype=np.float32)
+        cpu_proc.apply(OCIO.PackedImageDesc(arr, 2, 2, 3), snapshot)
+        for v in arr:
+            self.assertAlmostEqual(v, 2.0, delta=self.FLOAT_DELTA)
+
+        self.assertEqual(
+            cpu_proc.applyRGB([1.0, 1.0, 1.0]),
+            [1.0, 1.0, 1.0]
+        )
+
+        # An editable copy holds its own values.
+        copy = snapshot.createEditableCopy()
+        copy.getDynamicProperty(OCIO.DYNAMIC_PROPERTY_EXPOSURE).setDouble(2.0)
+        self.assertEqual(
+            snapshot.getDynamicProperty(OCIO.DYNAMIC_PROPERTY_EXPOSURE).getDouble(), 1.0
+        )
+
+        src = np.ones(3 * 4, dtype=np.float32)
+        dst = np.zeros(3 * 4, dtype=np.float32)
+        cpu_proc.apply(OCIO.PackedImageDesc(src, 2, 2, 3),
+                       OCIO.PackedImageDesc(dst, 2, 2, 3),
+                       copy, 2)
+        for v in dst:
+            self.assertAlmostEqual(v, 4.0, delta=self.FLOAT_DELTA)
+
+        # A snapshot only applies to the processor it comes from.
+        other_proc = proc.getOptimizedCPUProcessor(OCIO.OPTIMIZATION_LOSSLESS)
+        with self.assertRaises(OCIO.Exception):
+            other_proc.apply(OCIO.PackedImageDesc(src, 2, 2, 3), snapshot)
+
     def test_apply(self):
         if not np:
             logger.warning("NumPy not found. Skipping test!")
@@ -321,6 +372,35 @@ class CPUProcessorTest(unittest.TestCase):
                 delta=self.FLOAT_DELTA
             )
 
+    def test_apply_num_threads(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        for num_threads in (0, 1, 2, 8):
+            # Wrap buffers in ImageDesc
+            arr = self.float_rgb_3d.copy()
+            image = OCIO.PackedImageDesc(arr, 7, 3, 3)
+            dst_arr = np.zeros_like(self.float_rgb_3d)
+            dst_image = OCIO.PackedImageDesc(dst_arr, 7, 3, 3)
+
+            # Forward transform modifies values in place
+            self.default_cpu_proc_fwd.apply(image, num_threads)
+            # Inverse transform roundtrips values in dst
+            self.default_cpu_proc_inv.apply(image, dst_image, num_threads)
+
+            for i in range(arr.size):
+                self.assertAlmostEqual(
+                    arr.flat[i],
+                    self.float_rgb_3d.flat[i] * 0.5,
+                    delta=self.FLOAT_DELTA
+                )
+                self.assertAlmostEqual(
+                    dst_arr.flat[i],
+                    self.float_rgb_3d.flat[i],
+                    delta=self.FLOAT_DELTA
+                )
+
     def test_apply_src_dst(self):
         if not np:
             logger.warning("NumPy not found. Skipping test!")
@@ -694,3 +774,207 @@ class CPUProcessorTest(unittest.TestCase):
             # Expect runtime error for non-C-contiguous array
             with self.assertRaises(RuntimeError):
                 cpu_proc_fwd.applyRGBA(arr_copy)
+
+    def test_apply_rgb_buffer_strided(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # A (height, width, channels) image bigger than the processed views.
+        image = np.linspace(0.0, 1.0, 9 * 8 * 5, dtype=np.float32).reshape([9, 8, 5])
+
+        for view in (
+            lambda arr: arr[..., :3],                  # RGB of a 5-channel image
+            lambda arr: arr[1:8:2, ::3, 1:4],          # Crop with steps
+            lambda arr: arr[::-1, ::-1, 2::-1],        # Flipped image with BGR channels
+            lambda arr: arr[..., :3].transpose(1, 0, 2),
+            lambda arr: arr[2, :, :3],                 # (N, 3) array
+            lambda arr: arr.reshape(-1)[::2][:60],     # 1D array
+            lambda arr: arr[..., 1],                   # 3 values per row, not contiguous
+        ):
+            arr = image.copy()
+
+            if view(arr).shape[-1] != 3 and view(arr).ndim > 1:
+                # Only the pixel-sized last dimension describes strided pixels.
+                with self.assertRaises(RuntimeError):
+                    self.default_cpu_proc_fwd.applyRGB(view(arr))
+                continue
+
+            # Process in place and check that the values outside the view are unchanged.
+            self.default_cpu_proc_fwd.applyRGB(view(arr))
+
+            expected = image.copy()
+            view(expected)[...] *= 0.5
+
+            for i in range(arr.size):
+                self.assertAlmostEqual(
+                    arr.flat[i], 
+                    expected.flat[i],
+                    delta=self.FLOAT_DELTA
+                )
+
+    def test_apply_rgb_buffer_src_dst(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        for arr, cpu_proc_fwd in [
+            (self.float_rgb_1d, self.default_cpu_proc_fwd),
+            (self.float_rgb_3d, self.default_cpu_proc_fwd),
+            (self.half_rgb_2d, self.half_cpu_proc_fwd),
+            (self.uint16_rgb_3d, self.uint16_cpu_proc_fwd),
+            (self.uint8_rgb_2d, self.uint8_cpu_proc_fwd),
+        ]:
+            src_arr = arr.copy()
+
+            # A new array is returned when dst is None.
+            dst_arr1 = cpu_proc_fwd.applyRGB(src_arr, None)
+            self.assertEqual(dst_arr1.shape, arr.shape)
+            self.assertEqual(dst_arr1.dtype, arr.dtype)
+
+            # The values are written in a provided dst array (e.g. a strided view).
+            if arr.ndim == 1:
+                dst_arr2 = np.zeros(arr.size * 2, dtype=arr.dtype)[::2]
+            else:
+                dst_image = np.zeros(arr.shape[:-1] + (5,), dtype=arr.dtype)
+                dst_arr2 = dst_image[..., 1:4]
+            cpu_proc_fwd.applyRGB(src_arr, dst_arr2, 2)
+
+            for i in range(arr.size):
+                # The src array is unchanged.
+                self.assertEqual(src_arr.flat[i], arr.flat[i])
+
+                if arr.dtype in (np.float32, np.float16):
+                    expected = arr.flat[i] * 0.5
+                    delta = self.FLOAT_DELTA
+                else:
+                    expected = arr.flat[i] // 2
+                    delta = self.UINT_DELTA
+
+                self.assertAlmostEqual(dst_arr1.flat[i], expected, delta=delta)
+                self.assertAlmostEqual(
+                    dst_arr2.reshape(-1)[i], 
+                    expected, 
+                    delta=delta
+                )
+
+            # The src and dst arrays must have the same shape.
+            with self.assertRaises(RuntimeError):
+                cpu_proc_fwd.applyRGB(src_arr, np.zeros(arr.size + 3, dtype=arr.dtype))
+
+    def test_apply_buffer_src_dst_transposed(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        for arr, apply in [
+            (self.float_rgb_3d, self.default_cpu_proc_fwd.applyRGB),
+            (self.float_rgba_3d, self.default_cpu_proc_fwd.applyRGBA),
+        ]:
+            expected = arr.copy()
+            expected[..., :3] *= 0.5
+
+            # The allocated dst array has the layout of a transposed src, and a
+            # Fortran-ordered src is processed as a C-contiguous copy.
+            for layout in (
+                lambda a: a.transpose(1, 0, 2),
+                np.asfortranarray,
+            ):
+                src_arr = layout(arr.copy())
+                expected_arr = layout(expected)
+
+                dst_arr = apply(src_arr, None)
+                self.assertEqual(dst_arr.shape, src_arr.shape)
+                self.assertEqual(dst_arr.dtype, src_arr.dtype)
+
+                for i in range(arr.size):
+                    # The src array is unchanged.
+                    self.assertEqual(src_arr.flat[i], layout(arr).flat[i])
+                    self.assertAlmostEqual(
+                        dst_arr.flat[i], 
+                        expected_arr.flat[i],
+                        delta=self.FLOAT_DELTA
+                    )
+
+    def test_apply_rgba_buffer_num_threads(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # Large enough for the flattened buffers to be split into several rows, plus a
+        # partial last row.
+        arr = np.linspace(0.0, 1.0, 4 * 2500, dtype=np.float32)
+
+        for num_threads in (0, 1, 2, 8):
+            arr_copy = arr.copy()
+            self.default_cpu_proc_fwd.applyRGBA(arr_copy, num_threads)
+
+            dst_arr = self.default_cpu_proc_inv.applyRGBA(
+                arr_copy.reshape([50, 50, 4]), 
+                None, 
+                numThreads=num_threads
+            )
+
+            for i in range(0, arr.size, 4):
+                for c in range(3):
+                    self.assertAlmostEqual(
+                        arr_copy[i + c], 
+                        arr[i + c] * 0.5,
+                        delta=self.FLOAT_DELTA
+                    )
+                self.assertAlmostEqual(
+                    arr_copy[i + 3], 
+                    arr[i + 3],
+                    delta=self.FLOAT_DELTA
+                )
+
+            for i in range(arr.size):
+                self.assertAlmostEqual(
+                    dst_arr.flat[i], 
+                    arr[i],
+                    delta=self.FLOAT_DELTA
+                )
+
+    def test_profiling(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        matrix = OCIO.MatrixTransform.Scale([0.5, 0.5, 0.5, 1.0])
+        matrix.getFormatMetadata().setName('look matrix')
+        exponent = OCIO.ExponentTransform([2.2, 2.2, 2.2, 1.0])
+
+        proc = self.config.getProcessor(OCIO.GroupTransform([matrix, exponent]))
+        cpu_proc = proc.getOptimizedCPUProcessor(OCIO.OPTIMIZATION_NONE)
+
+        self.assertFalse(cpu_proc.isProfilingEnabled())
+        self.assertEqual(cpu_proc.getNumProfiledOps(), 2)
+        self.assertEqual(cpu_proc.getProfiledOpType(0), '<MatrixOffsetOp>')
+        self.assertEqual(cpu_proc.getProfiledOpType(1), '<GammaOp>')
+        self.assertEqual(
+            cpu_proc.getProfiledOpFormatMetadata(0).getName(), 'look matrix'
+        )
+
+        with self.assertRaises(OCIO.Exception):
+            cpu_proc.getProfiledOpTime(2)
+
+        cpu_proc.setProfilingEnabled(True)
+        self.assertTrue(cpu_proc.isProfilingEnabled())
+
+        arr = np.linspace(0.0, 1.0, 4 * 100, dtype=np.float32)
+        cpu_proc.applyRGBA(arr)
+
+        for i in range(2):
+            self.assertEqual(cpu_proc.getProfiledOpNumPixels(i), 100)
+            self.assertEqual(cpu_proc.getProfiledOpNumBytes(i), 100 * 32)
+            self.assertGreater(cpu_proc.getProfiledOpTime(i), 0.0)
+        self.assertGreater(cpu_proc.getProfiledPackTime(), 0.0)
+        self.assertGreater(cpu_proc.getProfiledUnpackTime(), 0.0)
+
+        cpu_proc.resetProfiling()
+        cpu_proc.setProfilingEnabled(False)
+        cpu_proc.applyRGBA(arr)
+
+        self.assertEqual(cpu_proc.getProfiledOpNumPixels(0), 0)
+        self.assertEqual(cpu_proc.getProfiledOpTime(0), 0.0)
+        self.assertEqual(cpu_proc.getProfiledPackTime(), 0.0)
@@ -404,3 +404,32 @@ class FileRulesTest(unittest.TestCase):
         self.assertEqual(ruleIndex, 1) # Default rule.
         csName, ruleIndex = cfg.getColorSpaceFromFilepath('')
         self.assertEqual(ruleIndex, 1) # Default rule.
+
+    def test_using_rules_batch(self):
+        """
+        Test Config.getColorSpacesFromFilepaths().
+        """
+        cfg = OCIO.Config.CreateRaw()
+        cs = OCIO.ColorSpace(name = 'cs1')
+        cfg.addColorSpace(cs)
+        cs = OCIO.ColorSpace(name = 'cs2')
+        cfg.addColorSpace(cs)
+
+        rules = OCIO.FileRules()
+        rules.insertRule(0, 'A', 'cs1', '/mnt/plates/*', 'exr')
+        rules.insertPathSearchRule(1)
+        rules.insertRule(2, 'B', 'cs2', '*', 'png')
+        cfg.setFileRules(rules)
+
+        filePaths = ['/mnt/plates/pic.EXR', '/mnt/other/pic_cs1.png', '/mnt/other/pic.png',
+                     '/mnt/other/pic.exr', '']
+
+        results = cfg.getColorSpacesFromFilepaths(filePaths)
+        self.assertEqual(results, [('cs1', 0), ('cs1', 1), ('cs2', 2), ('default', 3),
+                                   ('default', 3)])
+
+        # Identical to the single file path method.
+        for filePath, result in zip(filePaths, results):
+            self.assertEqual(cfg.getColorSpaceFromFilepath(filePath), result)
+
+        self.assertEqual(cfg.getColorSpacesFromFilepaths([]), [])
@@ -17,6 +17,7 @@ class FileTransformTest(unittest.TestCase, TransformsBaseTest):
     TEST_DST = 'bar'
     DEFAULT_FORMATS = [('flame', '3dl'),
                        ('lustre', '3dl'),
+                       ('OpenColorIO Binary Op List', 'ociob'),
                        ('ColorCorrection', 'cc'),
                        ('ColorCorrectionCollection', 'ccc'),
                        ('ColorDecisionList', 'cdl'),
@@ -111,7 +112,7 @@ class FileTransformTest(unittest.TestCase, TransformsBaseTest):
             self.assertEqual(format_name, name)
             self.assertEqual(format_ext, ext)
 
-        self.assertEqual(format_iterator.__len__(), 24)
+        self.assertEqual(format_iterator.__len__(), 25)
 
     def test_interpolation(self):
         """
@@ -38,3 +38,33 @@ class OpenColorIOTest(unittest.TestCase):
         OCIO.SetEnvVariable(value='TOTO', name='MY_ENVAR')
         self.assertTrue(OCIO.IsEnvVariablePresent(name='MY_ENVAR'))
         self.assertEqual(OCIO.GetEnvVariable(name='MY_ENVAR'), 'TOTO')
+
+    def test_cpu_processor_block_size(self):
+        """
+        Test Get/SetCPUProcessorBlockSize().
+        """
+        defaultBlockSize = OCIO.GetCPUProcessorBlockSize()
+        self.assertEqual(defaultBlockSize, 1024)
+
+        OCIO.SetCPUProcessorBlockSize(numPixels=0)
+        self.assertEqual(OCIO.GetCPUProcessorBlockSize(), 0)
+
+        OCIO.SetCPUProcessorBlockSize(defaultBlockSize)
+        self.assertEqual(OCIO.GetCPUProcessorBlockSize(), defaultBlockSize)
+
+    def test_inverse_lut3d_grid_size(self):
+        """
+        Test Get/SetInverseLut3DGridSize().
+        """
+        defaultGridSize = OCIO.GetInverseLut3DGridSize()
+        self.assertEqual(defaultGridSize, 48)
+
+        OCIO.SetInverseLut3DGridSize(gridSize=65)
+        self.assertEqual(OCIO.GetInverseLut3DGridSize(), 65)
+
+        with self.assertRaises(OCIO.Exception):
+            OCIO.SetInverseLut3DGridSize(130)
+        self.assertEqual(OCIO.GetInverseLut3DGridSize(), 65)
+
+        OCIO.SetInverseLut3DGridSize(defaultGridSize)
+        self.assertEqual(OCIO.GetInverseLut3DGridSize(), defaultGridSize)
@@ -69,4 +69,63 @@ colorspaces:
       # Confirm that the processor is the same.
       procE = cfg.getProcessor("cs3", "disp1", "view1", OCIO.TRANSFORM_DIR_FORWARD)
 
-      self.assertEqual(procD, procE)
\ No newline at end of file
+      self.assertEqual(procD, procE)
+
+    def test_processor_cache_capacity(self):
+      CONFIG = """ocio_profile_version: 2
+
+search_path: """ + TEST_DATAFILES_DIR + """
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: cs1
+
+colorspaces:
+  - !<ColorSpace>
+    name: cs1
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<MatrixTransform> {offset: [0.11, 0.12, 0.13, 0]}
+
+  - !<ColorSpace>
+    name: cs3
+    from_scene_reference: !<FileTransform> {src: lut1d_green.ctf}
+"""
+
+      cfg = OCIO.Config.CreateFromStream(CONFIG)
+      cfg.setProcessorCacheCapacity(maxEntries=1, maxBytes=0)
+
+      procA = cfg.getProcessor("cs1", "cs2")
+      self.assertEqual(procA, cfg.getProcessor("cs1", "cs2"))
+
+      stats = cfg.getProcessorCacheStatistics()
+      self.assertEqual(stats.numEntries, 1)
+      self.assertEqual(stats.maxEntries, 1)
+      self.assertEqual(stats.numHits, 1)
+      self.assertEqual(stats.numMisses, 1)
+      self.assertEqual(stats.numEvictions, 0)
+
+      # The least recently used processor is evicted.
+      cfg.getProcessor("cs1", "cs3")
+
+      stats = cfg.getProcessorCacheStatistics()
+      self.assertEqual(stats.numEntries, 1)
+      self.assertEqual(stats.numEvictions, 1)
+      self.assertGreater(stats.numBytes, 0)
+
+      self.assertNotEqual(procA, cfg.getProcessor("cs1", "cs2"))
+
+      # The global LUT file cache.
+      OCIO.SetFileCacheCapacity(maxEntries=10, maxBytes=0)
+      self.assertEqual(OCIO.GetFileCacheStatistics().maxEntries, 10)
+      OCIO.SetFileCacheCapacity(maxEntries=0, maxBytes=0)
+
+      # The global GPU shader cache, which is bounded by default.
+      stats = OCIO.GetGpuShaderCacheStatistics()
+      self.assertGreater(stats.maxEntries, 0)
+      self.assertGreater(stats.maxBytes, 0)
+      OCIO.SetGpuShaderCacheCapacity(maxEntries=10, maxBytes=0)
+      self.assertEqual(OCIO.GetGpuShaderCacheStatistics().maxEntries, 10)
+      OCIO.SetGpuShaderCacheCapacity(maxEntries=stats.maxEntries, maxBytes=stats.maxBytes)
@@ -140,6 +140,41 @@ class ProcessorTest(unittest.TestCase):
         self.assertEqual(t1.getTransformType(), OCIO.TRANSFORM_TYPE_MATRIX)
         self.assertEqual(t1.getOffset(), [3, 2, 1.5, 0])
 
+    def test_patched_processor(self):
+        # Test createPatchedProcessor() function.
+
+        cfg = OCIO.Config().CreateRaw()
+        group = OCIO.GroupTransform()
+        group.appendTransform(OCIO.ExponentTransform(value = [2.2, 2.2, 2.2, 1.]))
+        group.appendTransform(OCIO.MatrixTransform(offset = [0.1, 0.2, 0.3, 0.]))
+        group.appendTransform(OCIO.RangeTransform(minInValue = 0., minOutValue = 0.))
+
+        p = cfg.getProcessor(group)
+        self.assertEqual(p.getNumTransforms(), 3)
+
+        m = OCIO.MatrixTransform(offset = [0.3, 0.2, 0.1, 0.])
+        pPatched = p.createPatchedProcessor(1, m)
+        self.assertEqual(pPatched.getNumTransforms(), 3)
+
+        group = OCIO.GroupTransform()
+        group.appendTransform(OCIO.ExponentTransform(value = [2.2, 2.2, 2.2, 1.]))
+        group.appendTransform(m)
+        group.appendTransform(OCIO.RangeTransform(minInValue = 0., minOutValue = 0.))
+        pExpected = cfg.getProcessor(group)
+
+        pixel = [0.5, 0.4, 0.3]
+        patchedPixel = pPatched.getDefaultCPUProcessor().applyRGB(pixel)
+        expectedPixel = pExpected.getDefaultCPUProcessor().applyRGB(pixel)
+        for i in range(3):
+            self.assertAlmostEqual(patchedPixel[i], expectedPixel[i], delta=1e-6)
+
+        # The original processor is unchanged.
+        pixel = [0.5, 0.4, 0.3]
+        self.assertNotEqual(p.getDefaultCPUProcessor().applyRGB(pixel), patchedPixel)
+
+        with self.assertRaises(OCIO.Exception):
+            p.createPatchedProcessor(3, m)
+
     def test_format_meta_data(self):
         # Test FormatMetadata related functions.
 